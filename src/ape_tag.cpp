@@ -22,14 +22,25 @@
 
 #include "ape_tag.h"
 #include "types.h"
+#include "utils.h"
+#include "sink.h"
+#include "binary_cache.h"
+#include "unicode_support.h"
+#include "log.h"
 
 #include <cstdio>
 #include <cstring>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
-//Macros
-#define LOG(...) fprintf(stderr, __VA_ARGS__)
+//Const
+static const size_t ID3V1_SIZE = 128;
+static const unsigned int APE_VERSION_1 = 1000;
+static const unsigned int APE_VERSION_2 = 2000;
+static const unsigned int APE_FLAG_HAS_HEADER = 0x80000000;
+static const unsigned int APE_FLAG_IS_HEADER  = 0x20000000;
+static const unsigned int APE_ITEM_TYPE_MASK  = 0x00000006;
 
 ///////////////////////////////////////////////////////////////////////////////
 // APE structs
@@ -60,6 +71,11 @@ inline static void write_uint32(unsigned char* dest, const unsigned int value)
 	dest[3] = (unsigned char) ((((unsigned int)(0xFF000000)) & (value)) >> 24);
 }
 
+inline static unsigned int read_uint32(const unsigned char* src)
+{
+	return ((unsigned int)src[0]) | (((unsigned int)src[1]) << 8) | (((unsigned int)src[2]) << 16) | (((unsigned int)src[3]) << 24);
+}
+
 inline static void append_uint32(std::vector<unsigned char> &dest, const unsigned int value)
 {
 	dest.resize(dest.size() + 4);
@@ -74,130 +90,748 @@ inline static void append_nbytes(std::vector<unsigned char> &dest, const unsigne
 	memcpy(pos, data, len * sizeof(unsigned char));
 }
 
-inline static void date2string(const TagDate &date, char *buffer)
+inline static void init_header(ape_header_t *header, const size_t data_size, const size_t n_items, const bool is_footer)
+{
+	static const unsigned int flags_header = 0xA0000001;
+	static const unsigned int flags_footer = 0x80000001;
+
+	memset(header, 0, sizeof(ape_header_t));
+	memcpy(&header->id[0], APE_ID, 8);
+
+	write_uint32(&header->version [0], 2000);
+	write_uint32(&header->length  [0], data_size + sizeof(ape_header_t));
+	write_uint32(&header->tagCount[0], n_items);
+	write_uint32(&header->flags   [0], is_footer ? flags_footer: flags_header);
+}
+
+typedef enum
+{
+	APE_READ_OK,
+	APE_READ_NONE,
+	APE_READ_INVALID
+}
+ape_read_t;
+
+typedef struct
 {
-	if(date.getY() < 1)
+	const char *key;
+	unsigned int flags;
+	size_t valueStart;
+	size_t length;
+}
+ape_item_t;
+
+//Only complete APEv2 tags are accepted, the header must mirror the footer
+static ape_read_t read_tag(FILE *file, std::vector<unsigned char> &items, size_t &count)
+{
+	//Locate the footer, which is either at the very end or in front of an ID3v1 tag
+	ape_header_t footer, header;
+	__int64 footerPos = -1;
+	if(_fseeki64(file, 0, SEEK_END) == 0)
+	{
+		const __int64 fileSize = _ftelli64(file);
+		unsigned char tail[ID3V1_SIZE + sizeof(ape_header_t)];
+		const size_t tailSize = (fileSize < (__int64) sizeof(tail)) ? ((size_t) fileSize) : sizeof(tail);
+		if((fileSize >= 0) && (_fseeki64(file, fileSize - tailSize, SEEK_SET) == 0) && (fread(tail, sizeof(unsigned char), tailSize, file) == tailSize))
+		{
+			const bool hasId3v1 = (tailSize >= ID3V1_SIZE) && (memcmp(&tail[tailSize - ID3V1_SIZE], "TAG", 3) == 0);
+			const size_t footerEnd = tailSize - (hasId3v1 ? ID3V1_SIZE : 0);
+			if(footerEnd >= sizeof(ape_header_t))
+			{
+				memcpy(&footer, &tail[footerEnd - sizeof(ape_header_t)], sizeof(ape_header_t));
+				footerPos = fileSize - (tailSize - footerEnd) - sizeof(ape_header_t);
+			}
+		}
+	}
+
+	if((footerPos < 0) || (memcmp(footer.id, APE_ID, 8) != 0))
+	{
+		return APE_READ_NONE;
+	}
+
+	const unsigned int length = read_uint32(footer.length);
+	const unsigned int flags = read_uint32(footer.flags);
+	bool valid = (read_uint32(footer.version) == APE_VERSION_2) && (flags & APE_FLAG_HAS_HEADER) && (!(flags & APE_FLAG_IS_HEADER)) && (length >= sizeof(ape_header_t)) && (((__int64) length) <= footerPos);
+	if(valid)
 	{
-		throw std::runtime_error("Invalid date specification!");
+		const __int64 headerPos = footerPos + sizeof(ape_header_t) - length - sizeof(ape_header_t);
+		valid = (_fseeki64(file, headerPos, SEEK_SET) == 0) && (fread(&header, sizeof(ape_header_t), 1, file) == 1);
+		valid = valid && (memcmp(header.id, APE_ID, 8) == 0) && (read_uint32(header.version) == APE_VERSION_2) && (read_uint32(header.length) == length);
+		valid = valid && (read_uint32(header.tagCount) == read_uint32(footer.tagCount)) && (read_uint32(header.flags) & APE_FLAG_IS_HEADER);
 	}
-	
-	if(date.getM() > 0)
+	if(valid)
 	{
-		if(date.getD() > 0)
+		items.resize(length - sizeof(ape_header_t));
+		valid = items.empty() || (fread(items.data(), sizeof(unsigned char), items.size(), file) == items.size());
+		count = read_uint32(footer.tagCount);
+	}
+
+	return valid ? APE_READ_OK : APE_READ_INVALID;
+}
+
+typedef struct
+{
+	unsigned int version;
+	size_t count;
+	std::vector<unsigned char> items;
+}
+ape_stacked_t;
+
+//Collects all APE tags that are stacked in front of 'tagEnd', the newest tag comes first. APEv1 tags
+//have a footer only, APEv2 tags may lack the header, a header that is present must mirror the footer
+static ape_read_t read_stack(FILE *file, const uint64_t tagEnd, std::vector<ape_stacked_t> &tags, uint64_t &tagStart)
+{
+	uint64_t pos = tagEnd;
+	tags.clear();
+
+	while(pos >= sizeof(ape_header_t))
+	{
+		ape_header_t footer, header;
+		if((_fseeki64(file, pos - sizeof(ape_header_t), SEEK_SET) != 0) || (fread(&footer, sizeof(ape_header_t), 1, file) != 1))
+		{
+			return APE_READ_INVALID;
+		}
+		if(memcmp(footer.id, APE_ID, 8) != 0)
+		{
+			break;
+		}
+
+		const unsigned int version = read_uint32(footer.version);
+		const unsigned int length = read_uint32(footer.length);
+		const unsigned int flags = (version == APE_VERSION_2) ? read_uint32(footer.flags) : 0; /*reserved in APEv1*/
+		const uint64_t headerSize = (flags & APE_FLAG_HAS_HEADER) ? sizeof(ape_header_t) : 0;
+		if(((version != APE_VERSION_1) && (version != APE_VERSION_2)) || (flags & APE_FLAG_IS_HEADER) || (length < sizeof(ape_header_t)) || (length + headerSize > pos))
+		{
+			return APE_READ_INVALID;
+		}
+
+		const uint64_t start = pos - length - headerSize;
+		if(headerSize)
+		{
+			bool valid = (_fseeki64(file, start, SEEK_SET) == 0) && (fread(&header, sizeof(ape_header_t), 1, file) == 1);
+			valid = valid && (memcmp(header.id, APE_ID, 8) == 0) && (read_uint32(header.version) == version) && (read_uint32(header.length) == length);
+			valid = valid && (read_uint32(header.tagCount) == read_uint32(footer.tagCount)) && (read_uint32(header.flags) & APE_FLAG_IS_HEADER);
+			if(!valid)
+			{
+				return APE_READ_INVALID;
+			}
+		}
+
+		tags.push_back(ape_stacked_t());
+		ape_stacked_t &tag = tags.back();
+		tag.version = version;
+		tag.count = read_uint32(footer.tagCount);
+		tag.items.resize(length - sizeof(ape_header_t));
+		if((_fseeki64(file, pos - length, SEEK_SET) != 0) || ((!tag.items.empty()) && (fread(tag.items.data(), sizeof(unsigned char), tag.items.size(), file) != tag.items.size())))
 		{
-			sprintf(buffer, "%04u-%02u-%02u", date.getY(), date.getM(), date.getD());
+			return APE_READ_INVALID;
+		}
+
+		pos = start;
+	}
+
+	tagStart = pos;
+	return tags.empty() ? APE_READ_NONE : APE_READ_OK;
+}
+
+//Text that is not valid UTF-8 is taken as Windows-1252, which is what APEv1 writers commonly used
+static bool is_utf8(const unsigned char *str, const size_t length)
+{
+	for(size_t pos = 0; pos < length;)
+	{
+		const unsigned int c = str[pos++];
+		const size_t extra = (c < 0x80) ? 0 : ((c >= 0xC2) && (c < 0xE0)) ? 1 : ((c >= 0xE0) && (c < 0xF0)) ? 2 : ((c >= 0xF0) && (c < 0xF5)) ? 3 : 4;
+		if((extra > 3) || (extra > length - pos))
+		{
+			return false;
+		}
+		for(size_t i = 0; i < extra; i++)
+		{
+			if((str[pos++] & 0xC0) != 0x80) return false;
+		}
+	}
+	return true;
+}
+
+static void append_cp1252(std::vector<unsigned char> &dest, const unsigned char *str, const size_t length)
+{
+	static const unsigned short CP1252_80[32] =
+	{
+		0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+		0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178
+	};
+
+	for(size_t pos = 0; pos < length; pos++)
+	{
+		const unsigned int cp = ((str[pos] >= 0x80) && (str[pos] < 0xA0)) ? CP1252_80[str[pos] - 0x80] : str[pos];
+		if(cp < 0x80)
+		{
+			dest.push_back((unsigned char) cp);
+		}
+		else if(cp < 0x800)
+		{
+			dest.push_back((unsigned char)(0xC0 | (cp >> 6)));
+			dest.push_back((unsigned char)(0x80 | (cp & 0x3F)));
 		}
 		else
 		{
-			sprintf(buffer, "%04u-%02u", date.getY(), date.getM());
+			dest.push_back((unsigned char)(0xE0 | (cp >> 12)));
+			dest.push_back((unsigned char)(0x80 | ((cp >> 6) & 0x3F)));
+			dest.push_back((unsigned char)(0x80 | (cp & 0x3F)));
 		}
 	}
-	else
+}
+
+//Parses the item at 'pos' and advances 'pos' to the next item, fails if the item is truncated
+static bool next_item(const unsigned char *const items, const size_t size, size_t &pos, ape_item_t &item)
+{
+	if((pos > size) || (size - pos < 9))
+	{
+		return false;
+	}
+
+	item.length = read_uint32(&items[pos]);
+	item.flags = read_uint32(&items[pos + 4]);
+	item.key = (const char*) &items[pos + 8];
+
+	const unsigned char *const keyEnd = (const unsigned char*) memchr(item.key, '\0', size - (pos + 8));
+	if(!keyEnd)
+	{
+		return false;
+	}
+
+	item.valueStart = (keyEnd - items) + 1;
+	if(item.length > size - item.valueStart)
 	{
-		sprintf(buffer, "%04u", date.getY());
+		return false;
 	}
+
+	pos = item.valueStart + item.length;
+	return true;
 }
 
-inline static void init_header(ape_header_t *header, const size_t data_size, const size_t n_items, const bool is_footer)
+//Binary items are stored as the file name, a NUL character and the content of the file
+static const char *binary_name(const char *fileName)
 {
-	static const unsigned int flags_header = 0xA0000001;
-	static const unsigned int flags_footer = 0x80000001;
+	const char *name = fileName;
+	for(const char *pos = fileName; *pos; pos++)
+	{
+		if((*pos == '\\') || (*pos == '/') || (*pos == ':')) name = pos + 1;
+	}
+	return name;
+}
 
-	memset(header, 0, sizeof(ape_header_t));
-	memcpy(&header->id[0], APE_ID, 8);
+//Appends length, flags, key and value of the item, returns the value as a string or NULL on failure
+static const char *encode_item(std::vector<unsigned char> &dest, const TagItem *item, const BinaryData &data, char *buffer)
+{
+	static const unsigned int flags_str = 0x00000001;
+	static const unsigned int flags_bin = 0x00000003;
 
-	write_uint32(&header->version [0], 2000);
-	write_uint32(&header->length  [0], data_size + sizeof(ape_header_t));
-	write_uint32(&header->tagCount[0], n_items);
-	write_uint32(&header->flags   [0], is_footer ? flags_footer: flags_header);
+	const char *key = item->getTagKey();
+
+	if(item->getTagData()->type() == TAG_TYPE_BINARY)
+	{
+		if(!data)
+		{
+			return NULL;
+		}
+		const char *const name = binary_name(item->getTagData()->toString());
+		const size_t nameLen = strlen(name) + 1;
+
+		append_uint32(dest, nameLen + data->size());
+		append_uint32(dest, flags_bin);
+		append_nbytes(dest, ((const unsigned char*)key), strlen(key) + 1);
+		append_nbytes(dest, ((const unsigned char*)name), nameLen);
+		append_nbytes(dest, data->data(), data->size());
+
+		sprintf(buffer, "<binary, %u bytes>", (unsigned int) data->size());
+		return buffer;
+	}
+
+	const char *str = item2string(item, buffer);
+
+	//Determine length
+	const size_t len = strlen(str);
+
+	//Write length, flags, key and the data
+	append_uint32(dest, len);
+	append_uint32(dest, flags_str);
+	append_nbytes(dest, ((const unsigned char*)key), strlen(key) + 1);
+	append_nbytes(dest, ((const unsigned char*)str), len);
+
+	return str;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // CLI Parser
 ///////////////////////////////////////////////////////////////////////////////
 
-bool ApeTagger::writeTags(FILE* file, const std::vector<TagItem*> &items)
+//The tag is streamed item by item, so that at most one item is buffered at a time
+bool ApeTagger::writeTags(OutputSink &sink, const std::vector<TagItem*> &items, const std::vector<BinaryData> &binaries)
+{
+	ape_header_t header;
+	const size_t dataSize = measure(items, binaries) - (2 * sizeof(ape_header_t));
+
+	init_header(&header, dataSize, items.size(), false);
+	bool success = sink.write(&header, sizeof(ape_header_t));
+
+	std::vector<unsigned char> itemData;
+	for(size_t i = 0; success && (i < items.size()); i++)
+	{
+		itemData.clear();
+		success = appendTag(itemData, items[i], binaries[i]) && sink.write(itemData.data(), itemData.size());
+	}
+	LOG_VERBOSE("\n");
+
+	init_header(&header, dataSize, items.size(), true);
+	success = success && sink.write(&header, sizeof(ape_header_t));
+
+	if(!success)
+	{
+		LOG("File operation has failed:\nUnable to write tag data to destination file!\n\n");
+	}
+	return success;
+}
+
+bool ApeTagger::serialize(const std::vector<TagItem*> &items, const std::vector<BinaryData> &binaries, std::vector<unsigned char> &dest)
 {
-	std::vector<unsigned char> tagData;
+	ape_header_t header;
+	dest.clear();
+
+	//Reserve space for the header
+	dest.resize(sizeof(ape_header_t));
 
 	//Write all tags to internal buffer
-	for(std::vector<TagItem*>::const_iterator iter = items.cbegin(); iter != items.cend(); iter++)
+	for(size_t i = 0; i < items.size(); i++)
 	{
-		if(!appendTag(tagData, *iter))
+		if(!appendTag(dest, items[i], binaries[i]))
 		{
 			return false;
 		}
 	}
-	LOG("\n");
+	LOG_VERBOSE("\n");
+
+	const size_t dataSize = dest.size() - sizeof(ape_header_t);
 
-	//Prepare the APE header
-	ape_header_t header;
-		
 	//Write header
-	init_header(&header, tagData.size(), items.size(), false);
-	if(fwrite(&header, sizeof(ape_header_t), 1, file) != 1)
+	init_header(&header, dataSize, items.size(), false);
+	memcpy(dest.data(), &header, sizeof(ape_header_t));
+
+	//Write footer
+	init_header(&header, dataSize, items.size(), true);
+	append_nbytes(dest, ((const unsigned char*)&header), sizeof(ape_header_t));
+
+	return true;
+}
+
+//Loads the content of each binary item, so that all steps of one tag use the same data even if the file changes
+bool ApeTagger::loadBinaries(const std::vector<TagItem*> &items, std::vector<BinaryData> &binaries)
+{
+	binaries.assign(items.size(), BinaryData());
+	for(size_t i = 0; i < items.size(); i++)
 	{
-		LOG("File operation has failed:\nUnable to write header to destination file!\n\n");
+		if(items[i]->getTagData()->type() == TAG_TYPE_BINARY)
+		{
+			binaries[i] = BinaryCache::load(items[i]->getTagData()->toString());
+			if(!binaries[i])
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+//Returns the exact size of the tag that serialize() would create, including header and footer
+size_t ApeTagger::measure(const std::vector<TagItem*> &items, const std::vector<BinaryData> &binaries)
+{
+	char tempBuffer[ITEM_BUFFER_SIZE];
+	size_t size = 2 * sizeof(ape_header_t);
+	for(size_t i = 0; i < items.size(); i++)
+	{
+		if(items[i]->getTagData()->type() == TAG_TYPE_BINARY)
+		{
+			size += 8 + strlen(items[i]->getTagKey()) + 1 + strlen(binary_name(items[i]->getTagData()->toString())) + 1 + (binaries[i] ? binaries[i]->size() : 0);
+			continue;
+		}
+		size += 8 + strlen(items[i]->getTagKey()) + 1 + strlen(item2string(items[i], tempBuffer));
+	}
+	return size;
+}
+
+bool ApeTagger::readRaw(const char *fileName, std::vector<unsigned char> &items, size_t &count)
+{
+	FILE *file = fopen_utf8(fileName, "rbR");
+	if(!file)
+	{
+		LOG("Failed to open file for reading:\n%s\n\nInvalid file specified or access denied!\n\n", fileName);
 		return false;
 	}
 
-	//Write actual data
-	if(fwrite(tagData.data(), sizeof(unsigned char), tagData.size(), file) != tagData.size())
+	const ape_read_t result = read_tag(file, items, count);
+	fclose(file);
+
+	if(result == APE_READ_NONE)
 	{
-		LOG("File operation has failed:\nUnable to write tag data to destination file!\n\n");
+		LOG("Failed to read APE tag:\n%s\n\nFile does not contain an APE tag!\n\n", fileName);
+	}
+	else if(result == APE_READ_INVALID)
+	{
+		LOG("Failed to read APE tag:\n%s\n\nTag is not a valid APEv2 tag with header and footer!\n\n", fileName);
+	}
+	return (result == APE_READ_OK);
+}
+
+//A file without an APE tag is not an error, 'dest' stays empty in that case
+bool ApeTagger::readText(const char *fileName, std::vector<std::pair<std::string, std::string>> &dest)
+{
+	dest.clear();
+
+	FILE *file = fopen_utf8(fileName, "rbR");
+	if(!file)
+	{
+		LOG("Failed to open file for reading:\n%s\n\nInvalid file specified or access denied!\n\n", fileName);
 		return false;
 	}
-	
+
+	std::vector<unsigned char> items;
+	size_t count = 0;
+	const ape_read_t result = read_tag(file, items, count);
+	fclose(file);
+
+	if(result != APE_READ_OK)
+	{
+		if(result == APE_READ_INVALID)
+		{
+			LOG("Failed to read APE tag:\n%s\n\nTag is not a valid APEv2 tag with header and footer!\n\n", fileName);
+		}
+		return (result == APE_READ_NONE);
+	}
+
+	size_t pos = 0;
+	for(size_t i = 0; i < count; i++)
+	{
+		ape_item_t item;
+		if(!next_item(items.data(), items.size(), pos, item))
+		{
+			LOG("Failed to read APE tag:\n%s\n\nItem %u is truncated!\n\n", fileName, (unsigned int)(i + 1));
+			return false;
+		}
+		if(item.flags & APE_ITEM_TYPE_MASK)
+		{
+			continue; /*binary items are skipped*/
+		}
+
+		//Multiple values of one item are separated by NUL characters
+		const char *value = (const char*) &items[item.valueStart];
+		const char *const valueEnd = value + item.length;
+		for(;;)
+		{
+			const char *const next = (const char*) memchr(value, '\0', valueEnd - value);
+			dest.push_back(std::make_pair(std::string(item.key), std::string(value, next ? next : valueEnd)));
+			if(!next)
+			{
+				break;
+			}
+			value = next + 1;
+		}
+	}
+
+	return true;
+}
+
+bool ApeTagger::mergeRaw(const std::vector<unsigned char> &items, const size_t count, const std::vector<TagItem*> &overrides, std::vector<unsigned char> &dest)
+{
+	ape_header_t header;
+	dest.clear();
+
+	//Reserve space for the header
+	dest.resize(sizeof(ape_header_t));
+
+	//Items that are not overridden are copied as they are, including binary items
+	size_t pos = 0, copied = 0;
+	for(size_t i = 0; i < count; i++)
+	{
+		const size_t itemStart = pos;
+		ape_item_t item;
+		if(!next_item(items.data(), items.size(), pos, item))
+		{
+			LOG("Failed to read APE tag:\nItem %u is truncated!\n\n", (unsigned int)(i + 1));
+			return false;
+		}
+
+		bool overridden = false;
+		for(std::vector<TagItem*>::const_iterator iter = overrides.cbegin(); iter != overrides.cend(); iter++)
+		{
+			if(_stricmp(item.key, (*iter)->getTagKey()) == 0)
+			{
+				overridden = true;
+				break;
+			}
+		}
+
+		if(!overridden)
+		{
+			append_nbytes(dest, &items[itemStart], pos - itemStart);
+			copied++;
+			if(item.flags & APE_ITEM_TYPE_MASK)
+			{
+				LOG_VERBOSE("%-11s : <binary, %u bytes>\n", item.key, (unsigned int) item.length);
+			}
+			else
+			{
+				LOG_VERBOSE("%-11s : %.*s\n", item.key, (int) item.length, (const char*) &items[item.valueStart]);
+			}
+		}
+	}
+
+	if(pos != items.size())
+	{
+		LOG("Failed to read APE tag:\nItem data does not match the tag size!\n\n");
+		return false;
+	}
+
+	//Write the overrides
+	std::vector<BinaryData> binaries;
+	if(!loadBinaries(overrides, binaries))
+	{
+		return false;
+	}
+	for(size_t i = 0; i < overrides.size(); i++)
+	{
+		if(!appendTag(dest, overrides[i], binaries[i]))
+		{
+			return false;
+		}
+	}
+	LOG_VERBOSE("\n");
+
+	const size_t dataSize = dest.size() - sizeof(ape_header_t);
+	const size_t itemCount = copied + overrides.size();
+
+	//Write header
+	init_header(&header, dataSize, itemCount, false);
+	memcpy(dest.data(), &header, sizeof(ape_header_t));
+
 	//Write footer
-	init_header(&header, tagData.size(), items.size(), true);
-	if(fwrite(&header, sizeof(ape_header_t), 1, file) != 1)
+	init_header(&header, dataSize, itemCount, true);
+	append_nbytes(dest, ((const unsigned char*)&header), sizeof(ape_header_t));
+
+	return true;
+}
+
+//Checks a tag that has been read back against the tag that was written, both have the given size
+bool ApeTagger::verify(const unsigned char *actual, const unsigned char *expected, const size_t size, const char *fileName)
+{
+	if(size < 2 * sizeof(ape_header_t))
 	{
-		LOG("File operation has failed:\nUnable to write footer to destination file!\n\n");
+		LOG("Verification has failed:\n%s\n\nTag data is truncated!\n\n", fileName);
+		return false;
+	}
+
+	ape_header_t header, footer, written;
+	memcpy(&header, actual, sizeof(ape_header_t));
+	memcpy(&footer, &actual[size - sizeof(ape_header_t)], sizeof(ape_header_t));
+	memcpy(&written, &expected[size - sizeof(ape_header_t)], sizeof(ape_header_t));
+
+	const unsigned int length = read_uint32(footer.length);
+	const unsigned int count = read_uint32(footer.tagCount);
+	bool valid = (memcmp(header.id, APE_ID, 8) == 0) && (memcmp(footer.id, APE_ID, 8) == 0);
+	valid = valid && (read_uint32(header.version) == APE_VERSION_2) && (read_uint32(footer.version) == APE_VERSION_2);
+	valid = valid && (read_uint32(header.flags) & APE_FLAG_IS_HEADER) && (!(read_uint32(footer.flags) & APE_FLAG_IS_HEADER));
+	valid = valid && (read_uint32(header.length) == length) && (read_uint32(header.tagCount) == count);
+	if(!valid)
+	{
+		LOG("Verification has failed:\n%s\n\nHeader and footer of the APE tag do not match!\n\n", fileName);
+		return false;
+	}
+	if((length != read_uint32(written.length)) || (count != read_uint32(written.tagCount)) || (read_uint32(footer.flags) != read_uint32(written.flags)))
+	{
+		LOG("Verification has failed:\n%s\n\nLength, item count or flags differ from the tag that was written!\n\n", fileName);
+		return false;
+	}
+
+	//Each item must decode and must be equal to the item that was written
+	const unsigned char *const actualItems = &actual[sizeof(ape_header_t)];
+	const unsigned char *const expectedItems = &expected[sizeof(ape_header_t)];
+	const size_t itemsSize = size - (2 * sizeof(ape_header_t));
+	size_t actualPos = 0, expectedPos = 0;
+	for(unsigned int i = 0; i < count; i++)
+	{
+		ape_item_t actualItem, expectedItem;
+		if(!next_item(expectedItems, itemsSize, expectedPos, expectedItem))
+		{
+			throw std::runtime_error("Bad tag data!");
+		}
+		if(!next_item(actualItems, itemsSize, actualPos, actualItem))
+		{
+			LOG("Verification has failed:\n%s\n\nItem %u is truncated!\n\n", fileName, i + 1);
+			return false;
+		}
+		valid = (actualItem.flags == expectedItem.flags) && (strcmp(actualItem.key, expectedItem.key) == 0) && (actualItem.length == expectedItem.length);
+		if((!valid) || (memcmp(&actualItems[actualItem.valueStart], &expectedItems[expectedItem.valueStart], actualItem.length) != 0))
+		{
+			LOG("Verification has failed:\n%s\n\nItem \"%s\" differs from the value that was written!\n\n", fileName, expectedItem.key);
+			return false;
+		}
+	}
+
+	if(actualPos != itemsSize)
+	{
+		LOG("Verification has failed:\n%s\n\nItem data does not match the tag size!\n\n", fileName);
 		return false;
 	}
 
 	return true;
 }
 
-bool ApeTagger::appendTag(std::vector<unsigned char> &dest, TagItem* item)
+//Compares the tag at the current position of 'file' with the items, which are encoded one by one
+bool ApeTagger::verifyStream(FILE *file, const std::vector<TagItem*> &items, const std::vector<BinaryData> &binaries, const char *fileName)
 {
-	static const unsigned int flags_str = 0x00000001;
-	static const unsigned int flags_bin = 0x00000003;
+	const size_t dataSize = measure(items, binaries) - (2 * sizeof(ape_header_t));
+	ape_header_t expected, actual;
 
-	char tempBuffer[32];
+	init_header(&expected, dataSize, items.size(), false);
+	if((fread(&actual, sizeof(ape_header_t), 1, file) != 1) || (memcmp(&actual, &expected, sizeof(ape_header_t)) != 0))
+	{
+		LOG("Verification has failed:\n%s\n\nHeader of the APE tag differs from the header that was written!\n\n", fileName);
+		return false;
+	}
 
-	const char *key = item->getTagKey();
-	const char *str = NULL;
-
-	//Set the data source
-	switch(item->getTagData()->type())
-	{
-	case TAG_TYPE_STRING:
-		str = item->getTagData()->toString();
-		break;
-	case TAG_TYPE_NUMBER:
-		sprintf(tempBuffer, "%u", item->getTagData()->toNumber());
-		str = &tempBuffer[0];
-		break;
-	case TAG_TYPE_DATE:
-		date2string(item->getTagData()->toDate(), tempBuffer);
-		str = &tempBuffer[0];
-		break;
-	default:
-		throw std::runtime_error("Bad item type!");
+	//Equal bytes decode to equal items, so each item is compared as it was encoded
+	std::vector<unsigned char> expectedItem, actualItem;
+	for(size_t i = 0; i < items.size(); i++)
+	{
+		char tempBuffer[ITEM_BUFFER_SIZE];
+		expectedItem.clear();
+		if(!encode_item(expectedItem, items[i], binaries[i], tempBuffer))
+		{
+			return false;
+		}
+		actualItem.resize(expectedItem.size());
+		if((fread(actualItem.data(), sizeof(unsigned char), actualItem.size(), file) != actualItem.size()) || (memcmp(actualItem.data(), expectedItem.data(), expectedItem.size()) != 0))
+		{
+			LOG("Verification has failed:\n%s\n\nItem \"%s\" differs from the value that was written!\n\n", fileName, items[i]->getTagKey());
+			return false;
+		}
 	}
 
-	//Determine length
-	const size_t len = strlen(str);
+	init_header(&expected, dataSize, items.size(), true);
+	if((fread(&actual, sizeof(ape_header_t), 1, file) != 1) || (memcmp(&actual, &expected, sizeof(ape_header_t)) != 0))
+	{
+		LOG("Verification has failed:\n%s\n\nFooter of the APE tag differs from the footer that was written!\n\n", fileName);
+		return false;
+	}
 
-	//Write length, flags, key and the data
-	append_uint32(dest, len);
-	append_uint32(dest, flags_str);
-	append_nbytes(dest, ((const unsigned char*)key), strlen(key) + 1);
-	append_nbytes(dest, ((const unsigned char*)str), len);
+	return true;
+}
+
+//Stacked tags are collapsed into one APEv2 tag, the newest value of each key is kept. APEv1 text is
+//converted to UTF-8. A single APEv2 tag with header and footer is current and 'dest' stays empty.
+ApeMigration ApeTagger::migrate(FILE *file, const uint64_t tagEnd, std::vector<unsigned char> &dest, uint64_t &tagStart, const char *fileName)
+{
+	std::vector<ape_stacked_t> tags;
+	const ape_read_t result = read_stack(file, tagEnd, tags, tagStart);
+	dest.clear();
+
+	if(result != APE_READ_OK)
+	{
+		if(result == APE_READ_INVALID)
+		{
+			LOG("Failed to read APE tag:\n%s\n\nTag is malformed and cannot be migrated!\n\n", fileName);
+			return APE_MIGRATE_FAILED;
+		}
+		return APE_MIGRATE_NONE;
+	}
+
+	if((tags.size() == 1) && (tags.front().version == APE_VERSION_2) && (tagEnd - tagStart == tags.front().items.size() + (2 * sizeof(ape_header_t))))
+	{
+		return APE_MIGRATE_CURRENT;
+	}
+
+	//Reserve space for the header
+	dest.resize(sizeof(ape_header_t));
+
+	std::vector<std::string> keys;
+	unsigned int versionOne = 0;
+	for(std::vector<ape_stacked_t>::const_iterator tag = tags.cbegin(); tag != tags.cend(); tag++)
+	{
+		if(tag->version == APE_VERSION_1)
+		{
+			versionOne++;
+		}
+
+		size_t pos = 0;
+		for(size_t i = 0; i < tag->count; i++)
+		{
+			const size_t itemStart = pos;
+			ape_item_t item;
+			if(!next_item(tag->items.data(), tag->items.size(), pos, item))
+			{
+				LOG("Failed to read APE tag:\n%s\n\nItem %u is truncated!\n\n", fileName, (unsigned int)(i + 1));
+				dest.clear();
+				return APE_MIGRATE_FAILED;
+			}
+
+			bool replaced = false;
+			for(std::vector<std::string>::const_iterator key = keys.cbegin(); key != keys.cend(); key++)
+			{
+				if(_stricmp(key->c_str(), item.key) == 0)
+				{
+					replaced = true;
+					break;
+				}
+			}
+			if(replaced)
+			{
+				continue; /*a newer tag has the same key*/
+			}
+			keys.push_back(item.key);
+
+			const unsigned char *const value = &tag->items[item.valueStart];
+			if((tag->version == APE_VERSION_2) || is_utf8(value, item.length))
+			{
+				append_nbytes(dest, &tag->items[itemStart], pos - itemStart);
+				continue;
+			}
+
+			//The length is only known after the conversion
+			const size_t lengthPos = dest.size();
+			append_uint32(dest, 0);
+			append_uint32(dest, item.flags);
+			append_nbytes(dest, ((const unsigned char*)item.key), strlen(item.key) + 1);
+			const size_t valuePos = dest.size();
+			append_cp1252(dest, value, item.length);
+			write_uint32(&dest[lengthPos], dest.size() - valuePos);
+		}
+	}
+
+	const size_t dataSize = dest.size() - sizeof(ape_header_t);
+
+	//Write header
+	ape_header_t header;
+	init_header(&header, dataSize, keys.size(), false);
+	memcpy(dest.data(), &header, sizeof(ape_header_t));
+
+	//Write footer
+	init_header(&header, dataSize, keys.size(), true);
+	append_nbytes(dest, ((const unsigned char*)&header), sizeof(ape_header_t));
+
+	LOG_VERBOSE("Migrating %u APE tag(s), %u of them APEv1, to one APEv2 tag with %u item(s):\n%s\n\n", (unsigned int) tags.size(), versionOne, (unsigned int) keys.size(), fileName);
+	return APE_MIGRATE_DONE;
+}
+
+bool ApeTagger::appendTag(std::vector<unsigned char> &dest, TagItem* item, const BinaryData &data)
+{
+	char tempBuffer[ITEM_BUFFER_SIZE];
+	const char *const str = encode_item(dest, item, data, tempBuffer);
+	if(!str)
+	{
+		return false;
+	}
 
 	//Logging
-	LOG("%-11s : %s\n", key, str);
+	LOG_VERBOSE("%-11s : %s\n", item->getTagKey(), str);
 
 	return true;
 }
@@ -23,18 +23,42 @@
 #ifndef APE_TAGGER_H_INCLUDED
 #define APE_TAGGER_H_INCLUDED
 
+#include "binary_cache.h"
+
 #include <cstdio>
 #include <vector>
+#include <string>
+#include <utility>
+#include <stdint.h>
 
 class TagItem;
+class OutputSink;
+
+typedef enum
+{
+	APE_MIGRATE_NONE,
+	APE_MIGRATE_CURRENT,
+	APE_MIGRATE_DONE,
+	APE_MIGRATE_FAILED
+}
+ApeMigration;
 
 class ApeTagger
 {
 public:
-	static bool writeTags(FILE* file, const std::vector<TagItem*> &items);
+	static bool loadBinaries(const std::vector<TagItem*> &items, std::vector<BinaryData> &binaries);
+	static bool writeTags(OutputSink &sink, const std::vector<TagItem*> &items, const std::vector<BinaryData> &binaries);
+	static bool serialize(const std::vector<TagItem*> &items, const std::vector<BinaryData> &binaries, std::vector<unsigned char> &dest);
+	static size_t measure(const std::vector<TagItem*> &items, const std::vector<BinaryData> &binaries);
+	static bool readRaw(const char *fileName, std::vector<unsigned char> &items, size_t &count);
+	static bool readText(const char *fileName, std::vector<std::pair<std::string, std::string>> &dest);
+	static bool mergeRaw(const std::vector<unsigned char> &items, const size_t count, const std::vector<TagItem*> &overrides, std::vector<unsigned char> &dest);
+	static bool verify(const unsigned char *actual, const unsigned char *expected, const size_t size, const char *fileName);
+	static bool verifyStream(FILE *file, const std::vector<TagItem*> &items, const std::vector<BinaryData> &binaries, const char *fileName);
+	static ApeMigration migrate(FILE *file, const uint64_t tagEnd, std::vector<unsigned char> &dest, uint64_t &tagStart, const char *fileName);
 
 private:
-	static bool appendTag(std::vector<unsigned char> &dest, TagItem* item);
+	static bool appendTag(std::vector<unsigned char> &dest, TagItem* item, const BinaryData &data);
 };
 
 #endif //APE_TAGGER_H_INCLUDED
@@ -0,0 +1,300 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "binary_cache.h"
+#include "unicode_support.h"
+#include "log.h"
+
+//CRT includes
+#include <cstdio>
+#include <cstring>
+#include <io.h>
+#include <list>
+#include <map>
+#include <string>
+#include <mutex>
+#include <condition_variable>
+
+//Windows includes
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+//Const
+static const uint64_t MAX_FILE_SIZE = 16U << 20;
+
+///////////////////////////////////////////////////////////////////////////////
+// Types
+///////////////////////////////////////////////////////////////////////////////
+
+//The file index is the NTFS equivalent of an inode number
+typedef struct
+{
+	DWORD volume;
+	DWORD indexHigh;
+	DWORD indexLow;
+	uint64_t size;
+	uint64_t time;
+}
+file_identity_t;
+
+typedef struct
+{
+	uint64_t hash;
+	BinaryData data;
+}
+cache_blob_t;
+
+typedef std::list<cache_blob_t> blob_list_t;
+
+typedef struct
+{
+	file_identity_t identity;
+	uint64_t hash;
+	std::weak_ptr<const std::vector<unsigned char>> data;
+	bool loading;
+}
+cache_path_t;
+
+///////////////////////////////////////////////////////////////////////////////
+// Cache
+///////////////////////////////////////////////////////////////////////////////
+
+//The LRU list owns the cached copies, a path refers to its copy weakly, so an
+//evicted copy stays valid for as long as a job is still using it
+static struct binary_cache_t
+{
+	binary_cache_t(void)
+	:
+		limit(0), used(0), reads(0), hits(0)
+	{
+	}
+
+	std::mutex mutex;
+	std::condition_variable loaded;
+	std::map<std::string, cache_path_t> paths;
+	std::multimap<uint64_t, blob_list_t::iterator> hashes;
+	blob_list_t lru;
+	uint64_t limit;
+	uint64_t used;
+	unsigned int reads;
+	unsigned int hits;
+}
+g_cache;
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+static uint64_t hash_data(const std::vector<unsigned char> &data)
+{
+	uint64_t hash = 0xCBF29CE484222325ULL;
+	for(std::vector<unsigned char>::const_iterator iter = data.cbegin(); iter != data.cend(); iter++)
+	{
+		hash = (hash ^ (*iter)) * 0x00000100000001B3ULL;
+	}
+	return hash;
+}
+
+static bool same_identity(const file_identity_t &a, const file_identity_t &b)
+{
+	return (a.volume == b.volume) && (a.indexHigh == b.indexHigh) && (a.indexLow == b.indexLow) && (a.size == b.size) && (a.time == b.time);
+}
+
+static bool get_identity(FILE *file, file_identity_t &identity)
+{
+	BY_HANDLE_FILE_INFORMATION info;
+	if(!GetFileInformationByHandle((HANDLE) _get_osfhandle(_fileno(file)), &info))
+	{
+		return false;
+	}
+
+	identity.volume = info.dwVolumeSerialNumber;
+	identity.indexHigh = info.nFileIndexHigh;
+	identity.indexLow = info.nFileIndexLow;
+	identity.size = (((uint64_t) info.nFileSizeHigh) << 32) | info.nFileSizeLow;
+	identity.time = (((uint64_t) info.ftLastWriteTime.dwHighDateTime) << 32) | info.ftLastWriteTime.dwLowDateTime;
+	return true;
+}
+
+static bool read_data(FILE *file, const uint64_t size, std::vector<unsigned char> &data)
+{
+	data.resize((size_t) size);
+	return data.empty() || (fread(data.data(), sizeof(unsigned char), data.size(), file) == data.size());
+}
+
+//Moves the copy to the front of the LRU list, if it is still cached
+static void touch(const BinaryData &data, const uint64_t hash)
+{
+	const std::pair<std::multimap<uint64_t, blob_list_t::iterator>::iterator, std::multimap<uint64_t, blob_list_t::iterator>::iterator> range = g_cache.hashes.equal_range(hash);
+	for(std::multimap<uint64_t, blob_list_t::iterator>::iterator iter = range.first; iter != range.second; iter++)
+	{
+		if(iter->second->data == data)
+		{
+			g_cache.lru.splice(g_cache.lru.begin(), g_cache.lru, iter->second);
+			return;
+		}
+	}
+}
+
+//Returns an existing copy with the same content or adds the new one
+static BinaryData insert(const std::shared_ptr<std::vector<unsigned char>> &data, const uint64_t hash)
+{
+	const std::pair<std::multimap<uint64_t, blob_list_t::iterator>::iterator, std::multimap<uint64_t, blob_list_t::iterator>::iterator> range = g_cache.hashes.equal_range(hash);
+	for(std::multimap<uint64_t, blob_list_t::iterator>::iterator iter = range.first; iter != range.second; iter++)
+	{
+		const BinaryData &other = iter->second->data;
+		if((other->size() == data->size()) && (data->empty() || (memcmp(other->data(), data->data(), data->size()) == 0)))
+		{
+			g_cache.lru.splice(g_cache.lru.begin(), g_cache.lru, iter->second);
+			return other;
+		}
+	}
+
+	cache_blob_t blob;
+	blob.hash = hash;
+	blob.data = data;
+	g_cache.lru.push_front(blob);
+	g_cache.hashes.insert(std::make_pair(hash, g_cache.lru.begin()));
+	g_cache.used += data->size();
+
+	//Evict the least recently used copies, the new one is kept in any case
+	while(g_cache.limit && (g_cache.used > g_cache.limit) && (g_cache.lru.size() > 1))
+	{
+		blob_list_t::iterator last = --g_cache.lru.end();
+		const std::pair<std::multimap<uint64_t, blob_list_t::iterator>::iterator, std::multimap<uint64_t, blob_list_t::iterator>::iterator> evict = g_cache.hashes.equal_range(last->hash);
+		for(std::multimap<uint64_t, blob_list_t::iterator>::iterator iter = evict.first; iter != evict.second; iter++)
+		{
+			if(iter->second == last)
+			{
+				g_cache.hashes.erase(iter);
+				break;
+			}
+		}
+		g_cache.used -= last->data->size();
+		g_cache.lru.erase(last);
+	}
+
+	return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Public functions
+///////////////////////////////////////////////////////////////////////////////
+
+void BinaryCache::setLimit(const uint64_t limit)
+{
+	std::lock_guard<std::mutex> lock(g_cache.mutex);
+	g_cache.limit = limit;
+}
+
+//Concurrent lookups of the same path wait for the thread that is reading it
+BinaryData BinaryCache::load(const char *fileName)
+{
+	FILE *file = fopen_utf8(fileName, "rb");
+	if(!file)
+	{
+		LOG("Failed to open file for reading:\n%s\n\nInvalid file specified or access denied!\n\n", fileName);
+		return BinaryData();
+	}
+
+	file_identity_t identity;
+	if(!get_identity(file, identity))
+	{
+		LOG("Failed to query file information:\n%s\n\n", fileName);
+		fclose(file);
+		return BinaryData();
+	}
+	if(identity.size > MAX_FILE_SIZE)
+	{
+		LOG("Binary item is too large:\n%s\n\nFiles of up to %u MiB are supported!\n\n", fileName, (unsigned int)(MAX_FILE_SIZE >> 20));
+		fclose(file);
+		return BinaryData();
+	}
+
+	const std::string key(fileName);
+	std::unique_lock<std::mutex> lock(g_cache.mutex);
+
+	std::map<std::string, cache_path_t>::iterator entry = g_cache.paths.find(key);
+	while((entry != g_cache.paths.end()) && entry->second.loading)
+	{
+		g_cache.loaded.wait(lock);
+		entry = g_cache.paths.find(key);
+	}
+
+	if((entry != g_cache.paths.end()) && same_identity(entry->second.identity, identity))
+	{
+		BinaryData data = entry->second.data.lock();
+		if(data)
+		{
+			touch(data, entry->second.hash);
+			g_cache.hits++;
+			lock.unlock();
+			fclose(file);
+			return data;
+		}
+	}
+
+	//Read the file without holding the lock
+	cache_path_t &pending = g_cache.paths[key];
+	pending.identity = identity;
+	pending.hash = 0;
+	pending.data.reset();
+	pending.loading = true;
+	g_cache.reads++;
+	lock.unlock();
+
+	std::shared_ptr<std::vector<unsigned char>> buffer(new std::vector<unsigned char>());
+	const bool success = read_data(file, identity.size, *buffer);
+	const uint64_t hash = success ? hash_data(*buffer) : 0;
+	fclose(file);
+
+	lock.lock();
+	BinaryData data;
+	if(success)
+	{
+		data = insert(buffer, hash);
+		cache_path_t &loaded = g_cache.paths[key];
+		loaded.hash = hash;
+		loaded.data = data;
+		loaded.loading = false;
+	}
+	else
+	{
+		g_cache.paths.erase(key);
+		LOG("Failed to read file:\n%s\n\n", fileName);
+	}
+	g_cache.loaded.notify_all();
+	return data;
+}
+
+unsigned int BinaryCache::getReads(void)
+{
+	std::lock_guard<std::mutex> lock(g_cache.mutex);
+	return g_cache.reads;
+}
+
+unsigned int BinaryCache::getHits(void)
+{
+	std::lock_guard<std::mutex> lock(g_cache.mutex);
+	return g_cache.hits;
+}
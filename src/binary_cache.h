@@ -0,0 +1,50 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TAG_BINARY_CACHE_H_INCLUDED
+#define TAG_BINARY_CACHE_H_INCLUDED
+
+#include <vector>
+#include <memory>
+#include <stdint.h>
+
+typedef std::shared_ptr<const std::vector<unsigned char>> BinaryData;
+
+// Process-wide cache for the files that binary items are loaded from, so that
+// the cover art of an album is read once, not once per track. Files are keyed
+// by path and checked against volume, file index, size and modification time
+// on every lookup, a file that has been replaced is read again. The content is
+// hashed as well, files with identical content share one copy. The data is
+// read-only and can be used by any number of threads, copies that are not in
+// use are evicted in LRU order once the cache exceeds its limit. A limit of
+// zero means no limit.
+class BinaryCache
+{
+public:
+	static void setLimit(const uint64_t limit);
+	static BinaryData load(const char *fileName);
+
+	static unsigned int getReads(void);
+	static unsigned int getHits(void);
+};
+
+#endif //TAG_BINARY_CACHE_H_INCLUDED
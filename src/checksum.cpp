@@ -0,0 +1,238 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "checksum.h"
+#include "unicode_support.h"
+#include "trace.h"
+
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <intrin.h>
+#include <nmmintrin.h>
+
+//Const
+static const uint32_t CRC32C_POLY = 0x82F63B78;
+static const size_t   READ_BUFFER_SIZE = 4 * 1024 * 1024;
+static const uint64_t MIN_CHUNK_SIZE = 32 * 1024 * 1024;
+
+///////////////////////////////////////////////////////////////////////////////
+// CRC-32C
+///////////////////////////////////////////////////////////////////////////////
+
+static const struct crc32c_init_t
+{
+	crc32c_init_t(void)
+	{
+		for(uint32_t i = 0; i < 256; i++)
+		{
+			uint32_t crc = i;
+			for(int k = 0; k < 8; k++)
+			{
+				crc = (crc & 1) ? ((crc >> 1) ^ CRC32C_POLY) : (crc >> 1);
+			}
+			table[i] = crc;
+		}
+
+		int info[4];
+		__cpuid(info, 1);
+		hasSSE42 = ((info[2] & (1 << 20)) != 0);
+	}
+
+	uint32_t table[256];
+	bool hasSSE42;
+}
+g_crc32c;
+
+static uint32_t crc32c_update_sw(uint32_t crc, const unsigned char *data, size_t len)
+{
+	while(len--)
+	{
+		crc = g_crc32c.table[(crc ^ (*data++)) & 0xFF] ^ (crc >> 8);
+	}
+	return crc;
+}
+
+static uint32_t crc32c_update_hw(uint32_t crc, const unsigned char *data, size_t len)
+{
+	while(len && (((uintptr_t)data) & 7))
+	{
+		crc = _mm_crc32_u8(crc, *data++); len--;
+	}
+#ifdef _M_X64
+	uint64_t crc64 = crc;
+	for(; len >= 8; len -= 8, data += 8)
+	{
+		crc64 = _mm_crc32_u64(crc64, *((const uint64_t*)data));
+	}
+	crc = (uint32_t) crc64;
+#else
+	for(; len >= 4; len -= 4, data += 4)
+	{
+		crc = _mm_crc32_u32(crc, *((const uint32_t*)data));
+	}
+#endif
+	while(len--)
+	{
+		crc = _mm_crc32_u8(crc, *data++);
+	}
+	return crc;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// CRC combination (GF(2) matrix method, as in zlib's crc32_combine)
+///////////////////////////////////////////////////////////////////////////////
+
+static uint32_t gf2_matrix_times(const uint32_t *mat, uint32_t vec)
+{
+	uint32_t sum = 0;
+	for(; vec; vec >>= 1, mat++)
+	{
+		if(vec & 1) sum ^= *mat;
+	}
+	return sum;
+}
+
+static void gf2_matrix_square(uint32_t *square, const uint32_t *mat)
+{
+	for(int n = 0; n < 32; n++)
+	{
+		square[n] = gf2_matrix_times(mat, mat[n]);
+	}
+}
+
+//Returns the CRC of the concatenation of two blocks, given the CRC values of both blocks and the length of the second one
+static uint32_t crc32c_combine(uint32_t crc1, const uint32_t crc2, uint64_t len2)
+{
+	uint32_t even[32], odd[32];
+	if(len2 == 0)
+	{
+		return crc1;
+	}
+
+	//Operator for a single zero bit
+	odd[0] = CRC32C_POLY;
+	for(int n = 1; n < 32; n++)
+	{
+		odd[n] = 1U << (n - 1);
+	}
+
+	gf2_matrix_square(even, odd); /*two zero bits*/
+	gf2_matrix_square(odd, even); /*four zero bits*/
+
+	//Apply len2 zero bytes to crc1, the first squaring yields the operator for one zero byte
+	do
+	{
+		gf2_matrix_square(even, odd);
+		if(len2 & 1) crc1 = gf2_matrix_times(even, crc1);
+		if(!(len2 >>= 1)) break;
+
+		gf2_matrix_square(odd, even);
+		if(len2 & 1) crc1 = gf2_matrix_times(odd, crc1);
+		len2 >>= 1;
+	}
+	while(len2);
+
+	return crc1 ^ crc2;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Checksum
+///////////////////////////////////////////////////////////////////////////////
+
+//The span is recorded on the calling thread, the short-lived chunk threads do not get a trace buffer
+bool Checksum::compute(const char *fileName, const uint64_t offset, const uint64_t length, const unsigned int threads, uint32_t &crc)
+{
+	TRACE_SPAN("crc32c", fileName);
+
+	uint64_t chunks = (length + MIN_CHUNK_SIZE - 1) / MIN_CHUNK_SIZE;
+	if(chunks > threads) chunks = threads;
+	if(chunks < 2)
+	{
+		return computeRange(fileName, offset, length, crc);
+	}
+
+	//Each chunk is hashed from its own file handle, to keep the reads sequential
+	const uint64_t chunkSize = (length + chunks - 1) / chunks;
+	std::vector<uint32_t> partial((size_t) chunks, 0);
+	std::vector<char> success((size_t) chunks, 0);
+	std::vector<std::thread> workers;
+
+	for(size_t i = 0; i < chunks; i++)
+	{
+		const uint64_t start = i * chunkSize;
+		const uint64_t size = ((start + chunkSize) > length) ? (length - start) : chunkSize;
+		workers.push_back(std::thread([&, i, start, size]()
+		{
+			success[i] = computeRange(fileName, offset + start, size, partial[i]) ? 1 : 0;
+		}));
+	}
+
+	bool ok = true;
+	crc = 0;
+	for(size_t i = 0; i < chunks; i++)
+	{
+		workers[i].join();
+		ok = ok && success[i];
+		const uint64_t start = i * chunkSize;
+		crc = (i > 0) ? crc32c_combine(crc, partial[i], ((start + chunkSize) > length) ? (length - start) : chunkSize) : partial[i];
+	}
+
+	return ok;
+}
+
+bool Checksum::computeRange(const char *fileName, const uint64_t offset, const uint64_t length, uint32_t &crc)
+{
+	//Sequential scan hint, enables aggressive read-ahead and lets the cache drop pages behind the scan
+	FILE *file = fopen_utf8(fileName, "rbS");
+	if(!file)
+	{
+		return false;
+	}
+
+	if(_fseeki64(file, offset, SEEK_SET) != 0)
+	{
+		fclose(file);
+		return false;
+	}
+
+	std::vector<unsigned char> buffer((length < READ_BUFFER_SIZE) ? ((size_t) length) : READ_BUFFER_SIZE);
+	uint64_t remaining = length;
+	uint32_t state = 0xFFFFFFFF;
+
+	while(remaining > 0)
+	{
+		const size_t len = (remaining < buffer.size()) ? ((size_t) remaining) : buffer.size();
+		if(fread(buffer.data(), sizeof(unsigned char), len, file) != len)
+		{
+			fclose(file);
+			return false;
+		}
+		state = g_crc32c.hasSSE42 ? crc32c_update_hw(state, buffer.data(), len) : crc32c_update_sw(state, buffer.data(), len);
+		remaining -= len;
+	}
+
+	fclose(file);
+	crc = ~state;
+	return true;
+}
@@ -0,0 +1,44 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TAG_CHECKSUM_H_INCLUDED
+#define TAG_CHECKSUM_H_INCLUDED
+
+#include <stdint.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Payload Checksum
+///////////////////////////////////////////////////////////////////////////////
+
+// CRC-32C (Castagnoli) of a region of a file. The SSE4.2 CRC32 instruction is
+// used when available. Large regions are split into chunks that are hashed by
+// separate threads, the partial CRC values are then combined.
+class Checksum
+{
+public:
+	static bool compute(const char *fileName, const uint64_t offset, const uint64_t length, const unsigned int threads, uint32_t &crc);
+
+private:
+	static bool computeRange(const char *fileName, const uint64_t offset, const uint64_t length, uint32_t &crc);
+};
+
+#endif //TAG_CHECKSUM_H_INCLUDED
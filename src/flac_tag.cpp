@@ -0,0 +1,316 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "flac_tag.h"
+#include "types.h"
+#include "vorbis_comment.h"
+#include "utils.h"
+#include "unicode_support.h"
+#include "log.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// FLAC constants
+///////////////////////////////////////////////////////////////////////////////
+
+static const char FLAC_ID[4] = { 'f', 'L', 'a', 'C' };
+
+static const unsigned int FLAC_BLOCK_STREAMINFO = 0;
+static const unsigned int FLAC_BLOCK_PADDING    = 1;
+static const unsigned int FLAC_BLOCK_COMMENT    = 4;
+static const unsigned int FLAC_BLOCK_INVALID    = 127;
+
+static const unsigned int FLAC_MAX_LENGTH  = 0xFFFFFF;
+static const unsigned int FLAC_NEW_PADDING = 8192;
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+inline static void append_nbytes(std::vector<unsigned char> &dest, const unsigned char *data, const size_t len)
+{
+	dest.insert(dest.end(), data, data + len);
+}
+
+inline static void append_block_header(std::vector<unsigned char> &dest, const unsigned int type, const unsigned int length, const bool last)
+{
+	dest.push_back((unsigned char)((last ? 0x80 : 0x00) | (type & 0x7F)));
+	dest.push_back((unsigned char)((length >> 16) & 0xFF));
+	dest.push_back((unsigned char)((length >>  8) & 0xFF));
+	dest.push_back((unsigned char)((length >>  0) & 0xFF));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// FLAC Tagger
+///////////////////////////////////////////////////////////////////////////////
+
+bool FlacTagger::writeTags(const char *fileName, const std::vector<TagItem*> &items)
+{
+	FILE *file = fopen_utf8(fileName, "r+b");
+	if(!file)
+	{
+		LOG("File operation has failed:\nUnable to open the FLAC file for update!\n\n");
+		return false;
+	}
+
+	//Parse the metadata block chain
+	uint64_t start = 0;
+	std::vector<block_t> blocks;
+	if(!readBlocks(file, start, blocks))
+	{
+		LOG("File operation has failed:\nThe file is not a valid FLAC stream!\n\n");
+		fclose(file);
+		return false;
+	}
+
+	//Locate the existing VORBIS_COMMENT block
+	size_t commentIdx = SIZE_MAX;
+	for(size_t i = 0; i < blocks.size(); i++)
+	{
+		if(blocks[i].type == FLAC_BLOCK_COMMENT)
+		{
+			commentIdx = i;
+			break;
+		}
+	}
+
+	//Merge the existing comments with the new items
+	std::vector<unsigned char> vendor, vorbisComment;
+	std::vector<std::vector<unsigned char>> comments;
+	if(commentIdx != SIZE_MAX)
+	{
+		if(!readComments(file, blocks[commentIdx], vendor, comments))
+		{
+			LOG("File operation has failed:\nThe existing VORBIS_COMMENT block is malformed!\n\n");
+			fclose(file);
+			return false;
+		}
+	}
+	VorbisComment::build(items, vendor, comments, vorbisComment);
+	LOG_VERBOSE("\n");
+
+	if(vorbisComment.size() > FLAC_MAX_LENGTH)
+	{
+		LOG("Tag data is too large to fit into a FLAC metadata block!\n\n");
+		fclose(file);
+		return false;
+	}
+
+	//Determine the region that may be overwritten: existing comment (plus adjacent padding) or the first padding block
+	size_t spanIdx = commentIdx;
+	if(spanIdx == SIZE_MAX)
+	{
+		for(size_t i = 0; i < blocks.size(); i++)
+		{
+			if(blocks[i].type == FLAC_BLOCK_PADDING)
+			{
+				spanIdx = i;
+				break;
+			}
+		}
+	}
+
+	if(spanIdx != SIZE_MAX)
+	{
+		size_t spanEnd = spanIdx;
+		uint64_t spanSize = 4 + blocks[spanIdx].length;
+		if((spanIdx + 1 < blocks.size()) && (blocks[spanIdx + 1].type == FLAC_BLOCK_PADDING))
+		{
+			spanSize += 4 + blocks[++spanEnd].length;
+		}
+
+		const uint64_t required = 4 + vorbisComment.size();
+		const bool spanLast = blocks[spanEnd].last;
+
+		if((required == spanSize) || (required + 4 <= spanSize))
+		{
+			std::vector<unsigned char> buffer;
+			buffer.reserve((size_t) spanSize);
+			append_block_header(buffer, FLAC_BLOCK_COMMENT, vorbisComment.size(), spanLast && (required == spanSize));
+			append_nbytes(buffer, vorbisComment.data(), vorbisComment.size());
+			if(required < spanSize)
+			{
+				const unsigned int padding = (unsigned int)(spanSize - required - 4);
+				append_block_header(buffer, FLAC_BLOCK_PADDING, padding, spanLast);
+				buffer.resize(buffer.size() + padding, 0x00);
+			}
+
+			bool success = (_fseeki64(file, blocks[spanIdx].offset, SEEK_SET) == 0);
+			success = success && (fwrite(buffer.data(), sizeof(unsigned char), buffer.size(), file) == buffer.size());
+			success = (fclose(file) == 0) && success;
+
+			if(!success)
+			{
+				LOG("File operation has failed:\nUnable to update the metadata blocks in place!\n\n");
+			}
+			return success;
+		}
+	}
+
+	//Padding is exhausted, so the whole file needs to be re-written
+	LOG_VERBOSE("Not enough padding available, re-writing the complete file!\n\n");
+
+	const std::string tempName = std::string(fileName) + ".tmp";
+	const bool success = rewriteFile(tempName.c_str(), file, start, blocks, vorbisComment);
+	fclose(file);
+
+	if(!success)
+	{
+		unlink_utf8(tempName.c_str());
+		return false;
+	}
+	if(rename_utf8(tempName.c_str(), fileName) != 0)
+	{
+		LOG("File operation has failed:\nUnable to replace the original file!\n\n");
+		unlink_utf8(tempName.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+bool FlacTagger::readBlocks(FILE *file, uint64_t &start, std::vector<block_t> &blocks)
+{
+	unsigned char buffer[10];
+	start = 0;
+
+	//Skip ID3v2 tag, if any
+	if((_fseeki64(file, 0, SEEK_SET) != 0) || (fread(buffer, sizeof(unsigned char), 10, file) != 10))
+	{
+		return false;
+	}
+	start = get_id3v2_size(buffer);
+
+	if((_fseeki64(file, start, SEEK_SET) != 0) || (fread(buffer, sizeof(unsigned char), 4, file) != 4) || (memcmp(buffer, FLAC_ID, 4) != 0))
+	{
+		return false;
+	}
+
+	uint64_t offset = start + 4;
+	bool last = false;
+
+	while(!last)
+	{
+		if((_fseeki64(file, offset, SEEK_SET) != 0) || (fread(buffer, sizeof(unsigned char), 4, file) != 4))
+		{
+			return false;
+		}
+
+		block_t block;
+		block.offset = offset;
+		block.type   = buffer[0] & 0x7F;
+		block.last   = ((buffer[0] & 0x80) != 0);
+		block.length = (((unsigned int)buffer[1]) << 16) | (((unsigned int)buffer[2]) << 8) | ((unsigned int)buffer[3]);
+
+		if((block.type == FLAC_BLOCK_INVALID) || (blocks.empty() && (block.type != FLAC_BLOCK_STREAMINFO)))
+		{
+			return false;
+		}
+
+		blocks.push_back(block);
+		offset += 4 + block.length;
+		last = block.last;
+	}
+
+	return true;
+}
+
+bool FlacTagger::readComments(FILE *file, const block_t &block, std::vector<unsigned char> &vendor, std::vector<std::vector<unsigned char>> &comments)
+{
+	std::vector<unsigned char> buffer(block.length);
+	if((_fseeki64(file, block.offset + 4, SEEK_SET) != 0) || (fread(buffer.data(), sizeof(unsigned char), buffer.size(), file) != buffer.size()))
+	{
+		return false;
+	}
+
+	return VorbisComment::parse(buffer.data(), buffer.size(), vendor, comments);
+}
+
+bool FlacTagger::rewriteFile(const char *tempName, FILE *file, const uint64_t start, const std::vector<block_t> &blocks, const std::vector<unsigned char> &vorbisComment)
+{
+	uint64_t fileSize = 0;
+	if(!get_file_size(file, fileSize))
+	{
+		return false;
+	}
+
+	FILE *temp = fopen_utf8(tempName, "wb");
+	if(!temp)
+	{
+		LOG("File operation has failed:\nUnable to create temporary file!\n\n");
+		return false;
+	}
+
+	//Copy leading data (e.g. ID3v2 tag) and the stream marker
+	bool success = (_fseeki64(file, 0, SEEK_SET) == 0) && copy_file_data(file, temp, start);
+	success = success && (fwrite(FLAC_ID, sizeof(char), 4, temp) == 4);
+
+	//Write all metadata blocks, the new VORBIS_COMMENT replaces the old one or goes after the STREAMINFO
+	bool hasComment = false;
+	for(size_t i = 0; i < blocks.size(); i++)
+	{
+		hasComment = hasComment || (blocks[i].type == FLAC_BLOCK_COMMENT);
+	}
+
+	std::vector<unsigned char> buffer;
+	for(size_t i = 0; success && (i < blocks.size()); i++)
+	{
+		buffer.clear();
+		if((blocks[i].type != FLAC_BLOCK_PADDING) && (blocks[i].type != FLAC_BLOCK_COMMENT))
+		{
+			append_block_header(buffer, blocks[i].type, blocks[i].length, false);
+			success = success && (fwrite(buffer.data(), sizeof(unsigned char), buffer.size(), temp) == buffer.size());
+			success = success && (_fseeki64(file, blocks[i].offset + 4, SEEK_SET) == 0) && copy_file_data(file, temp, blocks[i].length);
+			buffer.clear();
+		}
+		if((blocks[i].type == FLAC_BLOCK_COMMENT) || ((i == 0) && (!hasComment)))
+		{
+			append_block_header(buffer, FLAC_BLOCK_COMMENT, vorbisComment.size(), false);
+			append_nbytes(buffer, vorbisComment.data(), vorbisComment.size());
+			success = success && (fwrite(buffer.data(), sizeof(unsigned char), buffer.size(), temp) == buffer.size());
+		}
+	}
+
+	//Add fresh padding for future updates
+	buffer.clear();
+	append_block_header(buffer, FLAC_BLOCK_PADDING, FLAC_NEW_PADDING, true);
+	buffer.resize(buffer.size() + FLAC_NEW_PADDING, 0x00);
+	success = success && (fwrite(buffer.data(), sizeof(unsigned char), buffer.size(), temp) == buffer.size());
+
+	//Copy the audio frames
+	const uint64_t audioOffset = blocks.back().offset + 4 + blocks.back().length;
+	success = success && (audioOffset <= fileSize);
+	success = success && (_fseeki64(file, audioOffset, SEEK_SET) == 0) && copy_file_data(file, temp, fileSize - audioOffset);
+
+	success = (fclose(temp) == 0) && success;
+	if(!success)
+	{
+		LOG("File operation has failed:\nUnable to write the temporary file!\n\n");
+	}
+
+	return success;
+}
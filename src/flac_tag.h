@@ -0,0 +1,52 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef FLAC_TAGGER_H_INCLUDED
+#define FLAC_TAGGER_H_INCLUDED
+
+#include <cstdio>
+#include <vector>
+#include <stdint.h>
+
+class TagItem;
+
+class FlacTagger
+{
+public:
+	static bool writeTags(const char *fileName, const std::vector<TagItem*> &items);
+
+private:
+	typedef struct
+	{
+		uint64_t offset;
+		unsigned int type;
+		unsigned int length;
+		bool last;
+	}
+	block_t;
+
+	static bool readBlocks(FILE *file, uint64_t &start, std::vector<block_t> &blocks);
+	static bool readComments(FILE *file, const block_t &block, std::vector<unsigned char> &vendor, std::vector<std::vector<unsigned char>> &comments);
+	static bool rewriteFile(const char *tempName, FILE *file, const uint64_t start, const std::vector<block_t> &blocks, const std::vector<unsigned char> &vorbisComment);
+};
+
+#endif //FLAC_TAGGER_H_INCLUDED
@@ -0,0 +1,553 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "id3_tag.h"
+#include "types.h"
+#include "keys.h"
+#include "utils.h"
+#include "unicode_support.h"
+#include "log.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+#include <vector>
+
+//Const
+static const size_t ID3V1_SIZE = 128;
+static const size_t ID3V2_HEADER_SIZE = 10;
+static const size_t ID3V2_NEW_PADDING = 4096;
+static const uint32_t ID3V2_MAX_SIZE = 0x0FFFFFFF;
+static const unsigned char ID3V1_NO_GENRE = 0xFF;
+static const unsigned char TEXT_ENCODING_UTF8 = 3;
+
+///////////////////////////////////////////////////////////////////////////////
+// ID3v1 fields and genres
+///////////////////////////////////////////////////////////////////////////////
+
+static const struct
+{
+	const char *key;
+	size_t offset;
+	size_t length;
+}
+g_id3v1Fields[] =
+{
+	{ "Title",    3, 30 },
+	{ "Artist",  33, 30 },
+	{ "Album",   63, 30 },
+	{ "Year",    93,  4 },
+	{ "Comment", 97, 30 },
+	{ NULL, 0, 0 }
+};
+
+//ID3v2.3 frames that do not exist in ID3v2.4, they are renamed or dropped (NULL) when a tag is upgraded.
+//TYER, TDAT and TIME are merged into a single TDRC frame.
+static const struct
+{
+	const char *v23;
+	const char *v24;
+}
+g_id3v23Frames[] =
+{
+	{ "TORY", "TDOR" },
+	{ "IPLS", "TIPL" },
+	{ "TRDA", NULL   },
+	{ "TSIZ", NULL   },
+	{ "RVAD", NULL   },
+	{ "EQUA", NULL   },
+	{ NULL,   NULL   }
+};
+
+//ID3v1 genres, including the Winamp extensions
+static const char *const g_id3v1Genres[] =
+{
+	"Blues", "Classic Rock", "Country", "Dance", "Disco", "Funk", "Grunge", "Hip-Hop", "Jazz", "Metal",
+	"New Age", "Oldies", "Other", "Pop", "R&B", "Rap", "Reggae", "Rock", "Techno", "Industrial",
+	"Alternative", "Ska", "Death Metal", "Pranks", "Soundtrack", "Euro-Techno", "Ambient", "Trip-Hop", "Vocal", "Jazz+Funk",
+	"Fusion", "Trance", "Classical", "Instrumental", "Acid", "House", "Game", "Sound Clip", "Gospel", "Noise",
+	"AlternRock", "Bass", "Soul", "Punk", "Space", "Meditative", "Instrumental Pop", "Instrumental Rock", "Ethnic", "Gothic",
+	"Darkwave", "Techno-Industrial", "Electronic", "Pop-Folk", "Eurodance", "Dream", "Southern Rock", "Comedy", "Cult", "Gangsta",
+	"Top 40", "Christian Rap", "Pop/Funk", "Jungle", "Native American", "Cabaret", "New Wave", "Psychadelic", "Rave", "Showtunes",
+	"Trailer", "Lo-Fi", "Tribal", "Acid Punk", "Acid Jazz", "Polka", "Retro", "Musical", "Rock & Roll", "Hard Rock",
+	"Folk", "Folk-Rock", "National Folk", "Swing", "Fast Fusion", "Bebob", "Latin", "Revival", "Celtic", "Bluegrass",
+	"Avantgarde", "Gothic Rock", "Progressive Rock", "Psychedelic Rock", "Symphonic Rock", "Slow Rock", "Big Band", "Chorus", "Easy Listening", "Acoustic",
+	"Humour", "Speech", "Chanson", "Opera", "Chamber Music", "Sonata", "Symphony", "Booty Bass", "Primus", "Porn Groove",
+	"Satire", "Slow Jam", "Club", "Tango", "Samba", "Folklore", "Ballad", "Power Ballad", "Rhythmic Soul", "Freestyle",
+	"Duet", "Punk Rock", "Drum Solo", "A capella", "Euro-House", "Dance Hall", NULL
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+inline static uint32_t read_syncsafe(const unsigned char *src)
+{
+	return ((src[0] & 0x7F) << 21) | ((src[1] & 0x7F) << 14) | ((src[2] & 0x7F) << 7) | (src[3] & 0x7F);
+}
+
+inline static void write_syncsafe(unsigned char *dest, const uint32_t value)
+{
+	dest[0] = (unsigned char)((value >> 21) & 0x7F);
+	dest[1] = (unsigned char)((value >> 14) & 0x7F);
+	dest[2] = (unsigned char)((value >>  7) & 0x7F);
+	dest[3] = (unsigned char)( value        & 0x7F);
+}
+
+inline static uint32_t read_uint32_be(const unsigned char *src)
+{
+	return (((uint32_t)src[0]) << 24) | (((uint32_t)src[1]) << 16) | (((uint32_t)src[2]) << 8) | ((uint32_t)src[3]);
+}
+
+inline static void append_nbytes(std::vector<unsigned char> &dest, const void *data, const size_t len)
+{
+	const unsigned char *const bytes = (const unsigned char*) data;
+	dest.insert(dest.end(), bytes, bytes + len);
+}
+
+static const char *id3v2_frame(const char *key, const char **description)
+{
+	for(int i = 0; g_tagSpec[i].key; i++)
+	{
+		if(strcmp(key, g_tagSpec[i].key) == 0)
+		{
+			*description = g_tagSpec[i].vorbis;
+			return g_tagSpec[i].id3v2 ? g_tagSpec[i].id3v2 : "TXXX";
+		}
+	}
+	throw std::runtime_error("Key has no ID3v2 mapping!");
+}
+
+//ID3v1 is limited to ISO-8859-1, other characters are replaced
+static void write_latin1(unsigned char *dest, const size_t length, const char *str)
+{
+	memset(dest, 0, length);
+	const unsigned char *src = (const unsigned char*) str;
+	for(size_t pos = 0; (pos < length) && (*src); pos++)
+	{
+		unsigned int cp = *src++;
+		if(cp >= 0xC0)
+		{
+			const size_t extra = (cp >= 0xF0) ? 3 : ((cp >= 0xE0) ? 2 : 1);
+			cp &= (0x3F >> extra);
+			for(size_t i = 0; (i < extra) && ((*src & 0xC0) == 0x80); i++)
+			{
+				cp = (cp << 6) | (*src++ & 0x3F);
+			}
+		}
+		else if(cp >= 0x80)
+		{
+			cp = '?'; /*stray continuation byte*/
+		}
+		dest[pos] = (cp < 0x100) ? ((unsigned char) cp) : '?';
+	}
+}
+
+static unsigned char genre_index(const char *genre)
+{
+	for(int i = 0; g_id3v1Genres[i]; i++)
+	{
+		if(_stricmp(genre, g_id3v1Genres[i]) == 0)
+		{
+			return (unsigned char) i;
+		}
+	}
+	return ID3V1_NO_GENRE;
+}
+
+//Extracts the ASCII description of a TXXX or COMM payload (behind the encoding and 'skip' bytes), in any of the text encodings
+static std::string frame_description(const unsigned char *data, const size_t length, const size_t skip)
+{
+	std::string description;
+	if(length < 1 + skip)
+	{
+		return description;
+	}
+
+	const bool wide = (data[0] == 1) || (data[0] == 2);
+	size_t pos = 1 + skip;
+	if(wide && (pos + 2 <= length) && (((data[pos] == 0xFF) && (data[pos + 1] == 0xFE)) || ((data[pos] == 0xFE) && (data[pos + 1] == 0xFF))))
+	{
+		pos += 2; /*skip the BOM*/
+	}
+	while(pos + (wide ? 1 : 0) < length)
+	{
+		const unsigned int c = wide ? (data[pos] | data[pos + 1]) : data[pos];
+		if(c == 0)
+		{
+			break;
+		}
+		description.push_back((char) c);
+		pos += wide ? 2 : 1;
+	}
+	return description;
+}
+
+//The digits of an ID3v2.3 date frame, which is either ISO-8859-1 or UTF-16 text
+static std::string frame_digits(const unsigned char *data, const size_t length)
+{
+	std::string digits;
+	for(size_t i = 1; i < length; i++)
+	{
+		if((data[i] >= '0') && (data[i] <= '9')) digits.push_back((char) data[i]);
+	}
+	return digits;
+}
+
+static void append_frame(std::vector<unsigned char> &dest, const char *id, const unsigned char *data, const size_t length)
+{
+	unsigned char frameHeader[ID3V2_HEADER_SIZE] = { 0 };
+	memcpy(frameHeader, id, 4);
+	write_syncsafe(&frameHeader[4], (uint32_t) length);
+	append_nbytes(dest, frameHeader, ID3V2_HEADER_SIZE);
+	append_nbytes(dest, data, length);
+}
+
+//Frames that will be replaced by one of the new items are not kept
+static bool is_replaced(const unsigned char *id, const unsigned char *data, const size_t length, const std::vector<TagItem*> &items)
+{
+	for(std::vector<TagItem*>::const_iterator iter = items.cbegin(); iter != items.cend(); iter++)
+	{
+		if((*iter)->getTagData()->type() == TAG_TYPE_BINARY)
+		{
+			continue;
+		}
+		const char *description;
+		const char *const frame = id3v2_frame((*iter)->getTagKey(), &description);
+		if(memcmp(id, frame, 4) != 0)
+		{
+			continue;
+		}
+		if(strcmp(frame, "TXXX") == 0)
+		{
+			if(_stricmp(frame_description(data, length, 0).c_str(), description) == 0) return true;
+		}
+		else if(strcmp(frame, "COMM") == 0)
+		{
+			if(frame_description(data, length, 3).empty()) return true; /*skip the language, keep named comments*/
+		}
+		else
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// ID3 Tagger
+///////////////////////////////////////////////////////////////////////////////
+
+//Writes a complete ID3v1.1 tag of 128 bytes, fields without a new item are taken from the existing tag
+void Id3Tagger::buildV1(const std::vector<TagItem*> &items, const unsigned char *existing, unsigned char *dest)
+{
+	if(existing)
+	{
+		memcpy(dest, existing, ID3V1_SIZE);
+	}
+	else
+	{
+		memset(dest, 0, ID3V1_SIZE);
+		memcpy(dest, "TAG", 3);
+		dest[127] = ID3V1_NO_GENRE;
+	}
+
+	//An ID3v1.1 track number takes the last two bytes of the comment field
+	unsigned int track = ((dest[125] == 0) && (dest[126] != 0)) ? dest[126] : 0;
+	for(std::vector<TagItem*>::const_iterator iter = items.cbegin(); iter != items.cend(); iter++)
+	{
+		if(strcmp((*iter)->getTagKey(), "Track") == 0)
+		{
+			track = ((*iter)->getTagData()->toNumber() < 256) ? (*iter)->getTagData()->toNumber() : 0;
+		}
+	}
+
+	char buffer[ITEM_BUFFER_SIZE];
+	for(std::vector<TagItem*>::const_iterator iter = items.cbegin(); iter != items.cend(); iter++)
+	{
+		const char *const key = (*iter)->getTagKey();
+		if(strcmp(key, "Genre") == 0)
+		{
+			dest[127] = genre_index(item2string(*iter, buffer));
+			continue;
+		}
+		for(int i = 0; g_id3v1Fields[i].key; i++)
+		{
+			if(strcmp(key, g_id3v1Fields[i].key) == 0)
+			{
+				const size_t length = ((g_id3v1Fields[i].offset == 97) && track) ? 28 : g_id3v1Fields[i].length;
+				write_latin1(&dest[g_id3v1Fields[i].offset], length, item2string(*iter, buffer));
+			}
+		}
+	}
+
+	if(track)
+	{
+		dest[125] = 0;
+		dest[126] = (unsigned char) track;
+	}
+}
+
+//Replaces the frames of the new items in the leading ID3v2 tag, in place if its padding permits
+bool Id3Tagger::writeV2(const char *fileName, const std::vector<TagItem*> &items, int64_t &delta)
+{
+	delta = 0;
+
+	FILE *file = fopen_utf8(fileName, "r+b");
+	if(!file)
+	{
+		LOG("Failed to open file for writing:\n%s\n\nInvalid file specified or access denied!\n\n", fileName);
+		return false;
+	}
+
+	uint64_t fileSize = 0;
+	unsigned char header[ID3V2_HEADER_SIZE];
+	if((!get_file_size(file, fileSize)) || (_fseeki64(file, 0, SEEK_SET) != 0))
+	{
+		LOG("File operation has failed:\n%s\n\nUnable to determine the file size!\n\n", fileName);
+		fclose(file);
+		return false;
+	}
+
+	const bool hasTag = (fileSize >= ID3V2_HEADER_SIZE) && (fread(header, sizeof(unsigned char), ID3V2_HEADER_SIZE, file) == ID3V2_HEADER_SIZE) && (memcmp(header, "ID3", 3) == 0);
+	uint64_t oldSize = 0;
+	std::vector<unsigned char> frames;
+	if(hasTag)
+	{
+		oldSize = get_id3v2_size(header);
+		if((oldSize > fileSize) || (!readFrames(file, header, items, frames)))
+		{
+			LOG_SUMMARY("Warning: Existing ID3v2 tag is not supported, its frames will be discarded:\n%s\n\n", fileName);
+			oldSize = (oldSize > fileSize) ? 0 : oldSize;
+			frames.clear();
+		}
+	}
+	buildFrames(items, frames);
+
+	//Re-use the space of the existing tag, otherwise make room for future updates
+	const bool inPlace = hasTag && (oldSize > 0) && (ID3V2_HEADER_SIZE + frames.size() <= oldSize);
+	const uint64_t newSize = inPlace ? oldSize : (ID3V2_HEADER_SIZE + frames.size() + ID3V2_NEW_PADDING);
+	if(newSize - ID3V2_HEADER_SIZE > ID3V2_MAX_SIZE)
+	{
+		LOG("Tag data is too large to fit into an ID3v2 tag!\n\n");
+		fclose(file);
+		return false;
+	}
+
+	std::vector<unsigned char> tag;
+	tag.reserve((size_t) newSize);
+	append_nbytes(tag, "ID3\x04\x00\x00", 6);
+	tag.resize(ID3V2_HEADER_SIZE);
+	write_syncsafe(&tag[6], (uint32_t)(newSize - ID3V2_HEADER_SIZE));
+	append_nbytes(tag, frames.data(), frames.size());
+	tag.resize((size_t) newSize, 0x00);
+
+	if(inPlace)
+	{
+		bool success = (_fseeki64(file, 0, SEEK_SET) == 0);
+		success = success && (fwrite(tag.data(), sizeof(unsigned char), tag.size(), file) == tag.size());
+		success = (fclose(file) == 0) && success;
+		if(!success)
+		{
+			LOG("File operation has failed:\nUnable to update the ID3v2 tag in place!\n\n");
+		}
+		return success;
+	}
+
+	//Padding is exhausted, so the whole file needs to be re-written
+	LOG_VERBOSE(hasTag ? "Not enough ID3v2 padding available, re-writing the complete file!\n\n" : "Adding a new ID3v2 tag, re-writing the complete file!\n\n");
+
+	const std::string tempName = std::string(fileName) + ".tmp";
+	const bool success = rewriteFile(tempName.c_str(), file, oldSize, tag);
+	fclose(file);
+
+	if(!success)
+	{
+		unlink_utf8(tempName.c_str());
+		return false;
+	}
+	if(rename_utf8(tempName.c_str(), fileName) != 0)
+	{
+		LOG("File operation has failed:\nUnable to replace the original file!\n\n");
+		unlink_utf8(tempName.c_str());
+		return false;
+	}
+
+	delta = ((int64_t) newSize) - ((int64_t) oldSize);
+	return true;
+}
+
+//Frames of ID3v2.3 tags are converted to the ID3v2.4 layout and IDs, unsynchronised or extended tags are not supported
+bool Id3Tagger::readFrames(FILE *file, const unsigned char *header, const std::vector<TagItem*> &items, std::vector<unsigned char> &kept)
+{
+	const unsigned int major = header[3];
+	if(((major != 3) && (major != 4)) || (header[5] & 0xC0))
+	{
+		return false;
+	}
+
+	std::vector<unsigned char> body(read_syncsafe(&header[6]));
+	if((_fseeki64(file, ID3V2_HEADER_SIZE, SEEK_SET) != 0) || (fread(body.data(), sizeof(unsigned char), body.size(), file) != body.size()))
+	{
+		return false;
+	}
+
+	size_t pos = 0;
+	std::string yearDigits, dateDigits, timeDigits;
+	while((pos + ID3V2_HEADER_SIZE <= body.size()) && (body[pos] != 0x00))
+	{
+		const unsigned char *const frame = &body[pos];
+		const size_t length = (major >= 4) ? read_syncsafe(&frame[4]) : read_uint32_be(&frame[4]);
+		if(length > body.size() - pos - ID3V2_HEADER_SIZE)
+		{
+			return false;
+		}
+
+		//ID3v2.3 frames are renamed to their ID3v2.4 counterpart, frames without one are dropped
+		const unsigned char *id = frame;
+		if(major < 4)
+		{
+			if(frame[9] != 0x00)
+			{
+				id = NULL; /*compressed, encrypted or grouped frames are dropped*/
+			}
+			else if(memcmp(frame, "TYER", 4) == 0)
+			{
+				yearDigits = frame_digits(&frame[ID3V2_HEADER_SIZE], length); id = NULL;
+			}
+			else if(memcmp(frame, "TDAT", 4) == 0)
+			{
+				dateDigits = frame_digits(&frame[ID3V2_HEADER_SIZE], length); id = NULL;
+			}
+			else if(memcmp(frame, "TIME", 4) == 0)
+			{
+				timeDigits = frame_digits(&frame[ID3V2_HEADER_SIZE], length); id = NULL;
+			}
+			for(int i = 0; id && g_id3v23Frames[i].v23; i++)
+			{
+				if(memcmp(frame, g_id3v23Frames[i].v23, 4) == 0)
+				{
+					id = (const unsigned char*) g_id3v23Frames[i].v24;
+					break;
+				}
+			}
+		}
+
+		if(id && (!is_replaced(id, &frame[ID3V2_HEADER_SIZE], length, items)))
+		{
+			if(major >= 4)
+			{
+				append_nbytes(kept, frame, ID3V2_HEADER_SIZE + length);
+			}
+			else
+			{
+				unsigned char frameHeader[ID3V2_HEADER_SIZE];
+				memcpy(frameHeader, id, 4);
+				write_syncsafe(&frameHeader[4], (uint32_t) length);
+				frameHeader[8] = (frame[8] >> 1) & 0x70;
+				frameHeader[9] = 0x00;
+				append_nbytes(kept, frameHeader, ID3V2_HEADER_SIZE);
+				append_nbytes(kept, &frame[ID3V2_HEADER_SIZE], length);
+			}
+		}
+
+		pos += ID3V2_HEADER_SIZE + length;
+	}
+
+	//The recording timeDigits is written as "yyyy[-MM-dd[THH:mm]]", TDAT is "DDMM" and TIME is "HHMM"
+	if((yearDigits.size() == 4) && (!is_replaced((const unsigned char*) "TDRC", NULL, 0, items)))
+	{
+		std::string value(1, '\0'); /*ISO-8859-1*/
+		value += yearDigits;
+		if(dateDigits.size() == 4)
+		{
+			value += "-" + dateDigits.substr(2, 2) + "-" + dateDigits.substr(0, 2);
+			if(timeDigits.size() == 4)
+			{
+				value += "T" + timeDigits.substr(0, 2) + ":" + timeDigits.substr(2, 2);
+			}
+		}
+		append_frame(kept, "TDRC", (const unsigned char*) value.data(), value.size());
+	}
+
+	return true;
+}
+
+//All text is written as UTF-8, which requires ID3v2.4
+void Id3Tagger::buildFrames(const std::vector<TagItem*> &items, std::vector<unsigned char> &dest)
+{
+	char buffer[ITEM_BUFFER_SIZE];
+	std::vector<unsigned char> payload;
+
+	for(std::vector<TagItem*>::const_iterator iter = items.cbegin(); iter != items.cend(); iter++)
+	{
+		if((*iter)->getTagData()->type() == TAG_TYPE_BINARY)
+		{
+			continue; /*binary items are only stored in APE tags*/
+		}
+		const char *description;
+		const char *const frame = id3v2_frame((*iter)->getTagKey(), &description);
+		const char *const value = item2string(*iter, buffer);
+
+		payload.assign(1, TEXT_ENCODING_UTF8);
+		if(strcmp(frame, "COMM") == 0)
+		{
+			append_nbytes(payload, "eng", 4); /*language and empty description*/
+		}
+		else if(strcmp(frame, "TXXX") == 0)
+		{
+			append_nbytes(payload, description, strlen(description) + 1);
+		}
+		append_nbytes(payload, value, strlen(value));
+
+		append_frame(dest, frame, payload.data(), payload.size());
+	}
+}
+
+bool Id3Tagger::rewriteFile(const char *tempName, FILE *file, const uint64_t oldSize, const std::vector<unsigned char> &tag)
+{
+	uint64_t fileSize = 0;
+	if(!get_file_size(file, fileSize))
+	{
+		return false;
+	}
+
+	FILE *temp = fopen_utf8(tempName, "wb");
+	if(!temp)
+	{
+		LOG("File operation has failed:\nUnable to create temporary file!\n\n");
+		return false;
+	}
+
+	//New tag, followed by everything behind the old tag
+	bool success = (fwrite(tag.data(), sizeof(unsigned char), tag.size(), temp) == tag.size());
+	success = success && (_fseeki64(file, oldSize, SEEK_SET) == 0) && copy_file_data(file, temp, fileSize - oldSize);
+
+	success = (fclose(temp) == 0) && success;
+	if(!success)
+	{
+		LOG("File operation has failed:\nUnable to write the temporary file!\n\n");
+	}
+
+	return success;
+}
@@ -0,0 +1,44 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef ID3_TAGGER_H_INCLUDED
+#define ID3_TAGGER_H_INCLUDED
+
+#include <cstdio>
+#include <vector>
+#include <stdint.h>
+
+class TagItem;
+
+class Id3Tagger
+{
+public:
+	static void buildV1(const std::vector<TagItem*> &items, const unsigned char *existing, unsigned char *dest);
+	static bool writeV2(const char *fileName, const std::vector<TagItem*> &items, int64_t &delta);
+
+private:
+	static bool readFrames(FILE *file, const unsigned char *header, const std::vector<TagItem*> &items, std::vector<unsigned char> &kept);
+	static void buildFrames(const std::vector<TagItem*> &items, std::vector<unsigned char> &dest);
+	static bool rewriteFile(const char *tempName, FILE *file, const uint64_t oldSize, const std::vector<unsigned char> &tag);
+};
+
+#endif //ID3_TAGGER_H_INCLUDED
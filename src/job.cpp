@@ -0,0 +1,615 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "job.h"
+#include "types.h"
+#include "utils.h"
+#include "ape_tag.h"
+#include "flac_tag.h"
+#include "mp4_tag.h"
+#include "ogg_tag.h"
+#include "id3_tag.h"
+#include "checksum.h"
+#include "trace.h"
+#include "sink.h"
+#include "memory_budget.h"
+#include "log.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <sys/stat.h>
+#include <io.h>
+
+#include "unicode_support.h"
+
+//Const
+static const size_t ID3V1_SIZE = 128;
+static const size_t APE_FOOTER_SIZE = 32;
+static const size_t TAIL_SIZE = ID3V1_SIZE + APE_FOOTER_SIZE;
+static const size_t ID3V2_HEADER_SIZE = 10;
+static const char *const CHECKSUM_KEY = "Payload CRC32C";
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+inline static unsigned int read_uint32_le(const unsigned char *src)
+{
+	return ((unsigned int)src[0]) | (((unsigned int)src[1]) << 8) | (((unsigned int)src[2]) << 16) | (((unsigned int)src[3]) << 24);
+}
+
+static FILE *open_file(const char *fileName, const char *mode)
+{
+	TRACE_SPAN("open", fileName);
+	return fopen_utf8(fileName, mode);
+}
+
+static OutputSink *open_sink(const SinkType type, const char *fileName, const uint64_t offset, const uint64_t length)
+{
+	TRACE_SPAN("open", fileName);
+	return OutputSink::create(type, fileName, offset, length);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Constructor & Destructor
+///////////////////////////////////////////////////////////////////////////////
+
+TagJob::TagJob(const char *fileName)
+:
+	m_fileSize(0), m_hasId3v1(false), m_apeTagSize(0), m_tagOffset(0), m_trailerSize(0), m_streamSize(0), m_reserved(0)
+{
+	if(fileName == NULL)
+	{
+		throw std::runtime_error("Invalid arguments!");
+	}
+	m_fileName = _strdup(fileName);
+}
+
+TagJob::~TagJob(void)
+{
+	while(!m_items.empty())
+	{
+		TagItem *tmp = m_items.back();
+		m_items.pop_back();
+		delete tmp; tmp = NULL;
+	}
+	free(m_fileName); m_fileName = NULL;
+
+	if(m_reserved)
+	{
+		MemoryBudget::release(m_reserved);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Processing steps
+///////////////////////////////////////////////////////////////////////////////
+
+bool TagJob::stat(void)
+{
+	TRACE_SPAN("stat", m_fileName);
+
+	struct _stat64 info;
+	if(stat64_utf8(m_fileName, &info) != 0)
+	{
+		LOG("Failed to access file:\n%s\n\nFile not found or access denied!\n\n", m_fileName);
+		return false;
+	}
+	if((info.st_mode & _S_IFMT) != _S_IFREG)
+	{
+		LOG("Failed to access file:\n%s\n\nNot a regular file!\n\n", m_fileName);
+		return false;
+	}
+
+	m_fileSize = info.st_size;
+	return true;
+}
+
+bool TagJob::readTail(void)
+{
+	TRACE_SPAN("read", m_fileName);
+
+	//Random access hint, so the cache manager does not read ahead beyond the tail
+	FILE *file = open_file(m_fileName, "rbR");
+	if(!file)
+	{
+		LOG("Failed to open file for reading:\n%s\n\nInvalid file specified or access denied!\n\n", m_fileName);
+		return false;
+	}
+
+	//Read the trailing bytes that may contain an ID3v1 tag and/or an APE footer
+	m_tail.resize((m_fileSize < TAIL_SIZE) ? ((size_t) m_fileSize) : TAIL_SIZE);
+	const bool success = (_fseeki64(file, m_fileSize - m_tail.size(), SEEK_SET) == 0) && (fread(m_tail.data(), sizeof(unsigned char), m_tail.size(), file) == m_tail.size());
+	fclose(file);
+
+	if(!success)
+	{
+		LOG("Failed to read from file:\n%s\n\nUnable to read the end of the file!\n\n", m_fileName);
+		return false;
+	}
+
+	m_hasId3v1 = (m_tail.size() >= ID3V1_SIZE) && (memcmp(&m_tail[m_tail.size() - ID3V1_SIZE], "TAG", 3) == 0);
+
+	const size_t footerEnd = m_tail.size() - (m_hasId3v1 ? ID3V1_SIZE : 0);
+	if((footerEnd >= APE_FOOTER_SIZE) && (memcmp(&m_tail[footerEnd - APE_FOOTER_SIZE], "APETAGEX", 8) == 0))
+	{
+		const unsigned char *const footer = &m_tail[footerEnd - APE_FOOTER_SIZE];
+		m_apeTagSize = read_uint32_le(&footer[12]) + ((read_uint32_le(&footer[20]) & 0x80000000) ? APE_FOOTER_SIZE : 0);
+	}
+
+	return true;
+}
+
+bool TagJob::checksum(const unsigned int threads)
+{
+	TRACE_SPAN("checksum", m_fileName);
+
+	FILE *file = open_file(m_fileName, "rb");
+	if(!file)
+	{
+		LOG("Failed to open file for reading:\n%s\n\nInvalid file specified or access denied!\n\n", m_fileName);
+		return false;
+	}
+
+	//The payload excludes a leading ID3v2 tag as well as the trailing APE and ID3v1 tags
+	unsigned char header[ID3V2_HEADER_SIZE];
+	const uint64_t payloadStart = (fread(header, sizeof(unsigned char), ID3V2_HEADER_SIZE, file) == ID3V2_HEADER_SIZE) ? get_id3v2_size(header) : 0;
+
+	//Earlier runs add their tag after the existing one, so the payload ends before the lowest tag of the stack
+	uint64_t payloadEnd = m_fileSize - (m_hasId3v1 ? ID3V1_SIZE : 0);
+	unsigned char footer[APE_FOOTER_SIZE];
+	bool valid = true;
+	while(valid && (payloadEnd >= APE_FOOTER_SIZE))
+	{
+		if((_fseeki64(file, payloadEnd - APE_FOOTER_SIZE, SEEK_SET) != 0) || (fread(footer, sizeof(unsigned char), APE_FOOTER_SIZE, file) != APE_FOOTER_SIZE) || (memcmp(footer, "APETAGEX", 8) != 0))
+		{
+			break;
+		}
+		const uint64_t tagSize = read_uint32_le(&footer[12]) + ((read_uint32_le(&footer[20]) & 0x80000000) ? APE_FOOTER_SIZE : 0);
+		valid = (tagSize >= APE_FOOTER_SIZE) && (tagSize <= payloadEnd);
+		payloadEnd -= valid ? tagSize : 0;
+	}
+	fclose(file);
+
+	if(!valid)
+	{
+		LOG("Failed to compute the payload checksum:\n%s\n\nAn existing APE tag is malformed!\n\n", m_fileName);
+		return false;
+	}
+	if(payloadStart > payloadEnd)
+	{
+		LOG("Failed to compute the payload checksum:\n%s\n\nThe ID3v2 tag overlaps the tags at the end of the file!\n\n", m_fileName);
+		return false;
+	}
+
+	const uint64_t payloadSize = payloadEnd - payloadStart;
+
+	uint32_t crc;
+	if(!Checksum::compute(m_fileName, payloadStart, payloadSize, threads, crc))
+	{
+		LOG("Failed to read from file:\n%s\n\nUnable to compute the payload checksum!\n\n", m_fileName);
+		return false;
+	}
+
+	const uint32_t checksumKey = StringPool::intern(CHECKSUM_KEY);
+	for(std::vector<TagItem*>::iterator iter = m_items.begin(); iter != m_items.end(); iter++)
+	{
+		if((*iter)->getTagKeyId() == checksumKey)
+		{
+			delete (*iter);
+			m_items.erase(iter);
+			break;
+		}
+	}
+
+	char buffer[16];
+	sprintf(buffer, "%08X", crc);
+	m_items.push_back(TagItem::fromString(CHECKSUM_KEY, buffer));
+
+	return true;
+}
+
+bool TagJob::serialize(const unsigned int formats, const std::vector<TagItem*> &common)
+{
+	TRACE_SPAN("serialize", m_fileName);
+
+	if(formats & TAG_FORMATS_CONTAINER)
+	{
+		return true; /*container formats are serialized by their writer*/
+	}
+
+	std::vector<TagItem*> items;
+	mergeItems(common, items);
+
+	m_tagData.clear();
+	if(formats & TAG_FORMAT_APE2)
+	{
+		if(m_apeTagSize)
+		{
+			LOG_SUMMARY("Warning: File already contains an APE tag, new tag will be added after it:\n%s\n\n", m_fileName);
+		}
+
+		//Binary items are loaded once, a streamed tag keeps them until it has been written and verified
+		if(!ApeTagger::loadBinaries(items, m_binaries))
+		{
+			return false;
+		}
+
+		//The buffer is accounted against the memory budget, a tag that is refused is streamed by write
+		const size_t size = ApeTagger::measure(items, m_binaries);
+		if(!MemoryBudget::acquire(size + ID3V1_SIZE))
+		{
+			m_streamSize = size;
+		}
+		else
+		{
+			m_reserved = size + ID3V1_SIZE;
+			m_tagData.reserve(size + ID3V1_SIZE);
+			const bool success = ApeTagger::serialize(items, m_binaries, m_tagData);
+			m_binaries.clear();
+			if(!success)
+			{
+				return false;
+			}
+		}
+	}
+
+	appendTrailer(formats, items);
+	return true;
+}
+
+bool TagJob::transfer(const char *sourceFile, const std::vector<TagItem*> &common)
+{
+	TRACE_SPAN("transfer", m_fileName);
+
+	if(m_apeTagSize)
+	{
+		LOG_SUMMARY("Warning: File already contains an APE tag, new tag will be added after it:\n%s\n\n", m_fileName);
+	}
+
+	std::vector<unsigned char> rawItems;
+	size_t count = 0;
+	if(!ApeTagger::readRaw(sourceFile, rawItems, count))
+	{
+		return false;
+	}
+
+	std::vector<TagItem*> items;
+	mergeItems(common, items);
+
+	if(!ApeTagger::mergeRaw(rawItems, count, items, m_tagData))
+	{
+		return false;
+	}
+
+	appendTrailer(TAG_FORMAT_APE2, items);
+	return true;
+}
+
+bool TagJob::write(const unsigned int formats, const SinkType sinkType, const std::vector<TagItem*> &common)
+{
+	TRACE_SPAN("write", m_fileName);
+
+	if(formats & TAG_FORMATS_CONTAINER)
+	{
+		std::vector<TagItem*> items;
+		mergeItems(common, items);
+		switch(formats)
+		{
+		case TAG_FORMAT_FLAC:
+			return FlacTagger::writeTags(m_fileName, items);
+		case TAG_FORMAT_MP4:
+			return Mp4Tagger::writeTags(m_fileName, items);
+		case TAG_FORMAT_OGG:
+			return OggTagger::writeTags(m_fileName, items);
+		default:
+			throw std::runtime_error("Bad tag format!");
+		}
+	}
+
+	struct _stat64 info;
+	if((stat64_utf8(m_fileName, &info) != 0) || (((uint64_t) info.st_size) != m_fileSize))
+	{
+		LOG("File operation has failed:\n%s\n\nFile has been modified concurrently!\n\n", m_fileName);
+		return false;
+	}
+
+	//The head goes first, as re-writing the file moves the tail
+	if(formats & TAG_FORMAT_ID3V2)
+	{
+		std::vector<TagItem*> items;
+		mergeItems(common, items);
+		int64_t delta = 0;
+		if(!Id3Tagger::writeV2(m_fileName, items, delta))
+		{
+			return false;
+		}
+		m_fileSize += delta;
+	}
+
+	if(m_tagData.empty() && (!m_streamSize))
+	{
+		return true;
+	}
+
+	//The tail replaces an existing ID3v1 tag, the serialized data ends with the new or preserved ID3v1 tag
+	const uint64_t offset = m_fileSize - (m_hasId3v1 ? ID3V1_SIZE : 0);
+	const uint64_t length = m_streamSize + m_tagData.size();
+	m_tagOffset = offset;
+
+	OutputSink *sink = open_sink(sinkType, m_fileName, offset, length);
+	if(!sink)
+	{
+		LOG("Failed to open file for writing:\n%s\n\nInvalid file specified or access denied!\n\n", m_fileName);
+		return false;
+	}
+
+	//A streamed tag goes first, the buffer then holds the ID3v1 tag only
+	bool success = true;
+	if(m_streamSize)
+	{
+		std::vector<TagItem*> items;
+		mergeItems(common, items);
+		success = ApeTagger::writeTags(*sink, items, m_binaries);
+	}
+	success = success && ((m_tagData.empty()) || sink->write(m_tagData.data(), m_tagData.size()));
+	success = sink->close() && success;
+	delete sink;
+
+	if(!success)
+	{
+		LOG("File operation has failed:\n%s\n\nUnable to write tag data to destination file!\n\n", m_fileName);
+	}
+
+	return success;
+}
+
+//The durability barrier of the verification, written data is flushed to the storage device
+bool TagJob::sync(void)
+{
+	TRACE_SPAN("sync", m_fileName);
+
+	FILE *file = open_file(m_fileName, "r+b");
+	if(!file)
+	{
+		LOG("Failed to open file for writing:\n%s\n\nInvalid file specified or access denied!\n\n", m_fileName);
+		return false;
+	}
+
+	const bool success = (_commit(_fileno(file)) == 0);
+	fclose(file);
+
+	if(!success)
+	{
+		LOG("File operation has failed:\n%s\n\nUnable to flush the file to disk!\n\n", m_fileName);
+	}
+	return success;
+}
+
+//Reads back the tail that has been written, only the tags at the end of the file are verified
+bool TagJob::verify(const std::vector<TagItem*> &common)
+{
+	TRACE_SPAN("verify", m_fileName);
+
+	if(m_tagData.empty() && (!m_streamSize))
+	{
+		return true;
+	}
+
+	struct _stat64 info;
+	if((stat64_utf8(m_fileName, &info) != 0) || (((uint64_t) info.st_size) != m_tagOffset + m_streamSize + m_tagData.size()))
+	{
+		LOG("Verification has failed:\n%s\n\nFile size does not match the tag that was written!\n\n", m_fileName);
+		return false;
+	}
+
+	FILE *file = open_file(m_fileName, "rbR");
+	if(!file)
+	{
+		LOG("Failed to open file for reading:\n%s\n\nInvalid file specified or access denied!\n\n", m_fileName);
+		return false;
+	}
+
+	//A streamed tag is not kept in memory, so it is compared with the items one by one
+	bool verified = true;
+	if(m_streamSize)
+	{
+		std::vector<TagItem*> items;
+		mergeItems(common, items);
+		verified = (_fseeki64(file, m_tagOffset, SEEK_SET) == 0) && ApeTagger::verifyStream(file, items, m_binaries, m_fileName);
+	}
+
+	std::vector<unsigned char> actual(m_tagData.size());
+	const bool success = verified && (_fseeki64(file, m_tagOffset + m_streamSize, SEEK_SET) == 0) && (fread(actual.data(), sizeof(unsigned char), actual.size(), file) == actual.size());
+	fclose(file);
+
+	if(!verified)
+	{
+		return false;
+	}
+	if(!success)
+	{
+		LOG("Failed to read from file:\n%s\n\nUnable to read the end of the file!\n\n", m_fileName);
+		return false;
+	}
+
+	const size_t apeSize = m_tagData.size() - m_trailerSize;
+	if((apeSize > 0) && (!ApeTagger::verify(actual.data(), m_tagData.data(), apeSize, m_fileName)))
+	{
+		return false;
+	}
+	if((m_trailerSize > 0) && (memcmp(&actual[apeSize], &m_tagData[apeSize], m_trailerSize) != 0))
+	{
+		LOG("Verification has failed:\n%s\n\nThe ID3v1 tag differs from the tag that was written!\n\n", m_fileName);
+		return false;
+	}
+
+	return true;
+}
+
+bool TagJob::strip(void)
+{
+	TRACE_SPAN("strip", m_fileName);
+
+	const uint64_t trailerSize = m_hasId3v1 ? ID3V1_SIZE : 0;
+	if((!m_apeTagSize) || (m_apeTagSize > m_fileSize - trailerSize))
+	{
+		LOG("Failed to strip tag:\n%s\n\nFile does not contain a valid APE tag!\n\n", m_fileName);
+		return false;
+	}
+
+	struct _stat64 info;
+	if((stat64_utf8(m_fileName, &info) != 0) || (((uint64_t) info.st_size) != m_fileSize))
+	{
+		LOG("File operation has failed:\n%s\n\nFile has been modified concurrently!\n\n", m_fileName);
+		return false;
+	}
+
+	FILE *file = open_file(m_fileName, "r+b");
+	if(!file)
+	{
+		LOG("Failed to open file for writing:\n%s\n\nInvalid file specified or access denied!\n\n", m_fileName);
+		return false;
+	}
+
+	//The ID3v1 tag is moved down to where the APE tag started, then the file is cut, regardless of its size
+	const uint64_t tagStart = m_fileSize - trailerSize - m_apeTagSize;
+	bool success = true;
+	if(m_hasId3v1)
+	{
+		success = (_fseeki64(file, tagStart, SEEK_SET) == 0) && (fwrite(&m_tail[m_tail.size() - ID3V1_SIZE], sizeof(unsigned char), ID3V1_SIZE, file) == ID3V1_SIZE) && (fflush(file) == 0);
+	}
+	success = success && (_chsize_s(_fileno(file), tagStart + trailerSize) == 0);
+	fclose(file);
+
+	if(!success)
+	{
+		LOG("File operation has failed:\n%s\n\nUnable to remove the tag from the file!\n\n", m_fileName);
+		return false;
+	}
+
+	LOG_VERBOSE("Removed APE tag of %u bytes:\n%s\n\n", (unsigned int) m_apeTagSize, m_fileName);
+	return true;
+}
+
+//The new tag is written where the lowest of the stacked tags started, followed by the ID3v1 tag, if any
+bool TagJob::migrate(void)
+{
+	TRACE_SPAN("migrate", m_fileName);
+
+	struct _stat64 info;
+	if((stat64_utf8(m_fileName, &info) != 0) || (((uint64_t) info.st_size) != m_fileSize))
+	{
+		LOG("File operation has failed:\n%s\n\nFile has been modified concurrently!\n\n", m_fileName);
+		return false;
+	}
+
+	FILE *file = open_file(m_fileName, "r+b");
+	if(!file)
+	{
+		LOG("Failed to open file for writing:\n%s\n\nInvalid file specified or access denied!\n\n", m_fileName);
+		return false;
+	}
+
+	const uint64_t trailerSize = m_hasId3v1 ? ID3V1_SIZE : 0;
+	uint64_t tagStart = 0;
+	switch(ApeTagger::migrate(file, m_fileSize - trailerSize, m_tagData, tagStart, m_fileName))
+	{
+	case APE_MIGRATE_NONE:
+		fclose(file);
+		LOG_VERBOSE("File does not contain an APE tag, nothing to migrate:\n%s\n\n", m_fileName);
+		return true;
+	case APE_MIGRATE_CURRENT:
+		fclose(file);
+		LOG_VERBOSE("File contains a single APEv2 tag already, nothing to migrate:\n%s\n\n", m_fileName);
+		return true;
+	case APE_MIGRATE_FAILED:
+		fclose(file);
+		return false;
+	default:
+		break;
+	}
+
+	if(m_hasId3v1)
+	{
+		m_tagData.insert(m_tagData.end(), m_tail.data() + m_tail.size() - ID3V1_SIZE, m_tail.data() + m_tail.size());
+	}
+
+	//The new tag may be larger than the old ones, as converted text takes more bytes
+	bool success = (_fseeki64(file, tagStart, SEEK_SET) == 0) && (fwrite(m_tagData.data(), sizeof(unsigned char), m_tagData.size(), file) == m_tagData.size()) && (fflush(file) == 0);
+	success = success && (_chsize_s(_fileno(file), tagStart + m_tagData.size()) == 0);
+	fclose(file);
+
+	if(!success)
+	{
+		LOG("File operation has failed:\n%s\n\nUnable to write tag data to destination file!\n\n", m_fileName);
+		return false;
+	}
+
+	LOG_VERBOSE("Migrated APE tag(s) of %u bytes to an APEv2 tag of %u bytes:\n%s\n\n", (unsigned int)(m_fileSize - trailerSize - tagStart), (unsigned int)(m_tagData.size() - trailerSize), m_fileName);
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+void TagJob::appendTrailer(const unsigned int formats, const std::vector<TagItem*> &items)
+{
+	const unsigned char *const id3v1 = m_hasId3v1 ? &m_tail[m_tail.size() - ID3V1_SIZE] : NULL;
+	m_trailerSize = 0;
+	if(formats & TAG_FORMAT_ID3V1)
+	{
+		const size_t pos = m_tagData.size();
+		m_tagData.resize(pos + ID3V1_SIZE);
+		Id3Tagger::buildV1(items, id3v1, &m_tagData[pos]);
+		m_trailerSize = ID3V1_SIZE;
+	}
+	else if(id3v1 && ((!m_tagData.empty()) || m_streamSize))
+	{
+		m_tagData.insert(m_tagData.end(), id3v1, id3v1 + ID3V1_SIZE);
+		m_trailerSize = ID3V1_SIZE;
+	}
+}
+
+void TagJob::mergeItems(const std::vector<TagItem*> &common, std::vector<TagItem*> &merged) const
+{
+	merged.clear();
+	for(std::vector<TagItem*>::const_iterator iter = common.cbegin(); iter != common.cend(); iter++)
+	{
+		bool overridden = false;
+		for(std::vector<TagItem*>::const_iterator item = m_items.cbegin(); item != m_items.cend(); item++)
+		{
+			if((*iter)->getTagKeyId() == (*item)->getTagKeyId())
+			{
+				overridden = true;
+				break;
+			}
+		}
+		if(!overridden)
+		{
+			merged.push_back(*iter);
+		}
+	}
+	merged.insert(merged.end(), m_items.cbegin(), m_items.cend());
+}
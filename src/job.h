@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TAG_JOB_H_INCLUDED
+#define TAG_JOB_H_INCLUDED
+
+#include "options.h"
+#include "binary_cache.h"
+
+#include <vector>
+#include <stdexcept>
+#include <stdint.h>
+
+class TagItem;
+
+///////////////////////////////////////////////////////////////////////////////
+// Tag Job
+///////////////////////////////////////////////////////////////////////////////
+
+// One file to be tagged. The processing is split into separate steps (stat,
+// tail read, serialize and write), so that the batch pipeline can run each
+// step in its own stage. All requested formats are built from the same items:
+// tail tags (APE and ID3v1) are written at once, an ID3v2 tag at the head of
+// the file is updated in place whenever its padding permits. The optional
+// checksum step runs after the tail read.
+// Instead of serialize, transfer copies the raw APE tag of another file and
+// replaces only the items that are given. Instead of write, strip removes the
+// last APE tag found by the tail read and migrate rewrites all APE tags at the
+// end of the file as one APEv2 tag. After write, sync flushes the file and
+// verify reads the written tail back. The tag buffer is accounted against the
+// memory budget until the job is deleted; a tag the budget refuses is streamed
+// by write instead of being buffered. Items passed as 'common' are shared by
+// all jobs, the job's own items take precedence over common items with the
+// same key.
+class TagJob
+{
+public:
+	TagJob(const char *fileName);
+	~TagJob(void);
+
+	bool stat(void);
+	bool readTail(void);
+	bool checksum(const unsigned int threads);
+	bool serialize(const unsigned int formats, const std::vector<TagItem*> &common);
+	bool transfer(const char *sourceFile, const std::vector<TagItem*> &common);
+	bool strip(void);
+	bool migrate(void);
+	bool sync(void);
+	bool verify(const std::vector<TagItem*> &common);
+	bool write(const unsigned int formats, const SinkType sinkType, const std::vector<TagItem*> &common);
+
+	inline const char *getFileName(void) const { return m_fileName; }
+	inline std::vector<TagItem*> &getItems(void) { return m_items; }
+	inline uint64_t getBufferSize(void) const { return m_reserved; }
+
+private:
+	void mergeItems(const std::vector<TagItem*> &common, std::vector<TagItem*> &merged) const;
+	void appendTrailer(const unsigned int formats, const std::vector<TagItem*> &items);
+
+	char *m_fileName;
+	std::vector<TagItem*> m_items;
+
+	uint64_t m_fileSize;
+	bool m_hasId3v1;
+	uint64_t m_apeTagSize;
+	std::vector<unsigned char> m_tail;
+	std::vector<unsigned char> m_tagData;
+	uint64_t m_tagOffset;
+	size_t m_trailerSize;
+	uint64_t m_streamSize;
+	std::vector<BinaryData> m_binaries;
+	uint64_t m_reserved;
+
+	TagJob &operator=(const TagJob &rhs) { throw std::runtime_error("Unimplemented!"); }
+};
+
+#endif //TAG_JOB_H_INCLUDED
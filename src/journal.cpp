@@ -0,0 +1,233 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "journal.h"
+#include "utils.h"
+#include "unicode_support.h"
+#include "log.h"
+
+//CRT includes
+#include <cstdio>
+#include <cstring>
+#include <io.h>
+
+//Windows includes
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+//Const
+static const char JOURNAL_MAGIC[8] = { 'T', 'A', 'G', 'J', 'R', 'N', 'L', '1' };
+static const size_t RECORD_SIZE = sizeof(uint64_t);
+
+///////////////////////////////////////////////////////////////////////////////
+// Constructor & Destructor
+///////////////////////////////////////////////////////////////////////////////
+
+Journal::Journal(void)
+:
+	m_count(0), m_file(NULL)
+{
+}
+
+Journal::~Journal(void)
+{
+	close();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Public functions
+///////////////////////////////////////////////////////////////////////////////
+
+bool Journal::open(const char *fileName)
+{
+	close();
+
+	//Load the records of a previous run, if any
+	uint64_t fileSize = 0;
+	FILE *file = fopen_utf8(fileName, "rb");
+	if(file)
+	{
+		const bool success = get_file_size(file, fileSize) && load(file, fileSize);
+		fclose(file);
+		if(!success)
+		{
+			LOG("Failed to read journal file:\n%s\n\nFile is corrupted or not a journal!\n\n", fileName);
+			return false;
+		}
+	}
+
+	m_file = fopen_utf8(fileName, "ab");
+	if(!m_file)
+	{
+		LOG("Failed to open journal file:\n%s\n\nInvalid file specified or access denied!\n\n", fileName);
+		return false;
+	}
+
+	//Drop a record that was torn by an interrupted run, new records are appended after the last complete one
+	bool success = true;
+	if(fileSize < sizeof(JOURNAL_MAGIC))
+	{
+		success = (_chsize_s(_fileno(m_file), 0) == 0) && (fwrite(JOURNAL_MAGIC, sizeof(char), sizeof(JOURNAL_MAGIC), m_file) == sizeof(JOURNAL_MAGIC)) && (fflush(m_file) == 0);
+	}
+	else if(((fileSize - sizeof(JOURNAL_MAGIC)) % RECORD_SIZE) != 0)
+	{
+		success = (_chsize_s(_fileno(m_file), fileSize - ((fileSize - sizeof(JOURNAL_MAGIC)) % RECORD_SIZE)) == 0);
+	}
+
+	if(!success)
+	{
+		LOG("Failed to write journal file:\n%s\n\nUnable to initialize the journal!\n\n", fileName);
+		close();
+		return false;
+	}
+
+	return true;
+}
+
+void Journal::close(void)
+{
+	if(m_file)
+	{
+		fclose(m_file);
+		m_file = NULL;
+	}
+	m_index.clear();
+	m_count = 0;
+}
+
+bool Journal::contains(const char *path) const
+{
+	if(m_index.empty())
+	{
+		return false;
+	}
+
+	uint64_t hash = hashPath(path);
+	if(hash == 0) hash = 1; /*zero marks an empty slot*/
+
+	const size_t mask = m_index.size() - 1;
+	for(size_t i = ((size_t) hash) & mask; m_index[i]; i = (i + 1) & mask)
+	{
+		if(m_index[i] == hash)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+//Records are flushed one by one, so that a crash loses at most the record being written
+bool Journal::append(const char *path)
+{
+	const uint64_t hash = hashPath(path);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if(!m_file)
+	{
+		return false;
+	}
+	return (fwrite(&hash, RECORD_SIZE, 1, m_file) == 1) && (fflush(m_file) == 0);
+}
+
+uint64_t Journal::hashPath(const char *path)
+{
+	uint64_t hash = 0xCBF29CE484222325ULL;
+	while(*path)
+	{
+		hash ^= (unsigned char)(*path++);
+		hash *= 0x100000001B3ULL;
+	}
+	return hash;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Internal functions
+///////////////////////////////////////////////////////////////////////////////
+
+bool Journal::load(FILE *file, const uint64_t fileSize)
+{
+	if(fileSize < sizeof(JOURNAL_MAGIC))
+	{
+		return true; /*empty, or the magic was torn by an interrupted run; open() re-initializes it*/
+	}
+	if(fileSize > SIZE_MAX)
+	{
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingW((HANDLE) _get_osfhandle(_fileno(file)), NULL, PAGE_READONLY, 0, 0, NULL);
+	if(!mapping)
+	{
+		return false;
+	}
+
+	const unsigned char *const view = (const unsigned char*) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if(!view)
+	{
+		CloseHandle(mapping);
+		return false;
+	}
+
+	const bool valid = (memcmp(view, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) == 0);
+	if(valid)
+	{
+		//Size the table to a power of two with at most 50% load
+		const size_t records = (size_t)((fileSize - sizeof(JOURNAL_MAGIC)) / RECORD_SIZE);
+		size_t capacity = 16;
+		while(capacity < (records * 2))
+		{
+			capacity *= 2;
+		}
+		m_index.assign(capacity, 0);
+
+		for(size_t i = 0; i < records; i++)
+		{
+			uint64_t hash;
+			memcpy(&hash, &view[sizeof(JOURNAL_MAGIC) + (i * RECORD_SIZE)], RECORD_SIZE);
+			insert(hash);
+		}
+	}
+
+	UnmapViewOfFile(view);
+	CloseHandle(mapping);
+	return valid;
+}
+
+void Journal::insert(uint64_t hash)
+{
+	if(hash == 0) hash = 1;
+
+	const size_t mask = m_index.size() - 1;
+	size_t i = ((size_t) hash) & mask;
+	while(m_index[i])
+	{
+		if(m_index[i] == hash)
+		{
+			return; /*duplicate record*/
+		}
+		i = (i + 1) & mask;
+	}
+
+	m_index[i] = hash;
+	m_count++;
+}
@@ -0,0 +1,69 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TAG_JOURNAL_H_INCLUDED
+#define TAG_JOURNAL_H_INCLUDED
+
+#include <cstdio>
+#include <vector>
+#include <mutex>
+#include <stdexcept>
+#include <stdint.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Progress Journal
+///////////////////////////////////////////////////////////////////////////////
+
+// Append-only record of the files that have been tagged successfully. Each
+// record is the 64-Bit FNV-1a hash of the file name, as given in the manifest.
+// On open, the existing journal is memory-mapped and loaded into an open
+// addressing hash set, so that every lookup is O(1) during the resumed run.
+class Journal
+{
+public:
+	Journal(void);
+	~Journal(void);
+
+	bool open(const char *fileName);
+	void close(void);
+
+	bool contains(const char *path) const;
+	bool append(const char *path);
+
+	inline size_t size(void) const { return m_count; }
+
+	static uint64_t hashPath(const char *path);
+
+private:
+	bool load(FILE *file, const uint64_t fileSize);
+	void insert(uint64_t hash);
+
+	std::vector<uint64_t> m_index;
+	size_t m_count;
+
+	FILE *m_file;
+	std::mutex m_mutex;
+
+	Journal &operator=(const Journal &rhs) { throw std::runtime_error("Unimplemented!"); }
+};
+
+#endif //TAG_JOURNAL_H_INCLUDED
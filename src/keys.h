@@ -25,6 +25,10 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 // Supported Tag keys
+// (key, type, description, Vorbis comment field name, MP4 atom type, ID3v2 frame)
+// Keys without a native MP4 atom are stored as iTunes freeform atoms, keys
+// without a native ID3v2 frame are stored as TXXX frames.
+// Binary keys are only stored in APE tags.
 ///////////////////////////////////////////////////////////////////////////////
 
 static const struct
@@ -32,24 +36,33 @@ static const struct
 	const char *key;
 	const TagType type;
 	const char *info;
+	const char *vorbis;
+	const char *mp4;
+	const char *id3v2;
 }
 g_tagSpec[]
 {
-	{ "Album",           TAG_TYPE_STRING , "Album name "                   },
-	{ "Artist",          TAG_TYPE_STRING , "Performing artist"             },
-	{ "Comment",         TAG_TYPE_STRING , "User comments"                 },
-	{ "Composer",        TAG_TYPE_STRING , "Name of the original composer" },
-	{ "Copyright",       TAG_TYPE_STRING , "Copyright holder"              },
-	{ "Genre",           TAG_TYPE_STRING , "Genre, normally English terms" },
-	{ "Language",        TAG_TYPE_STRING , "Used Language for music/words" },
-	{ "Media",           TAG_TYPE_STRING , "Source media"                  },
-	{ "Publisher",       TAG_TYPE_STRING , "Record label or publisher"     },
-	{ "Record Date",     TAG_TYPE_DATE   , "Record date"                   },
-	{ "Record Location", TAG_TYPE_STRING , "Record location"               },
-	{ "Subtitle",        TAG_TYPE_STRING , "Additional sub title"          },
-	{ "Title",           TAG_TYPE_STRING , "Music piece title"             },
-	{ "Track",           TAG_TYPE_NUMBER , "Track Number"                  },
-	{ "Year",            TAG_TYPE_DATE   , "Year"                          },
+	{ "Album",                 TAG_TYPE_STRING , "Album name "                   , "ALBUM"                 , "\xA9" "alb" , "TALB" },
+	{ "Artist",                TAG_TYPE_STRING , "Performing artist"             , "ARTIST"                , "\xA9" "ART" , "TPE1" },
+	{ "Comment",               TAG_TYPE_STRING , "User comments"                 , "COMMENT"               , "\xA9" "cmt" , "COMM" },
+	{ "Composer",              TAG_TYPE_STRING , "Name of the original composer" , "COMPOSER"              , "\xA9" "wrt" , "TCOM" },
+	{ "Copyright",             TAG_TYPE_STRING , "Copyright holder"              , "COPYRIGHT"             , "cprt"       , "TCOP" },
+	{ "Cover Art (Front)",     TAG_TYPE_BINARY , "Front cover image file"        , NULL                    , NULL         , NULL   },
+	{ "Genre",                 TAG_TYPE_STRING , "Genre, normally English terms" , "GENRE"                 , "\xA9" "gen" , "TCON" },
+	{ "Language",              TAG_TYPE_STRING , "Used Language for music/words" , "LANGUAGE"              , NULL         , "TLAN" },
+	{ "Media",                 TAG_TYPE_STRING , "Source media"                  , "MEDIA"                 , NULL         , "TMED" },
+	{ "Publisher",             TAG_TYPE_STRING , "Record label or publisher"     , "ORGANIZATION"          , NULL         , "TPUB" },
+	{ "Record Date",           TAG_TYPE_DATE   , "Record date"                   , "RECORDINGDATE"         , NULL         , NULL   },
+	{ "Record Location",       TAG_TYPE_STRING , "Record location"               , "LOCATION"              , NULL         , NULL   },
+	{ "Subtitle",              TAG_TYPE_STRING , "Additional sub title"          , "SUBTITLE"              , NULL         , "TIT3" },
+	{ "Title",                 TAG_TYPE_STRING , "Music piece title"             , "TITLE"                 , "\xA9" "nam" , "TIT2" },
+	{ "Track",                 TAG_TYPE_NUMBER , "Track Number"                  , "TRACKNUMBER"           , "trkn"       , "TRCK" },
+	{ "Year",                  TAG_TYPE_DATE   , "Year"                          , "DATE"                  , "\xA9" "day" , "TDRC" },
+	{ "REPLAYGAIN_TRACK_GAIN", TAG_TYPE_STRING , "ReplayGain track gain"         , "REPLAYGAIN_TRACK_GAIN" , NULL         , NULL   },
+	{ "REPLAYGAIN_TRACK_PEAK", TAG_TYPE_STRING , "ReplayGain track peak"         , "REPLAYGAIN_TRACK_PEAK" , NULL         , NULL   },
+	{ "REPLAYGAIN_ALBUM_GAIN", TAG_TYPE_STRING , "ReplayGain album gain"         , "REPLAYGAIN_ALBUM_GAIN" , NULL         , NULL   },
+	{ "REPLAYGAIN_ALBUM_PEAK", TAG_TYPE_STRING , "ReplayGain album peak"         , "REPLAYGAIN_ALBUM_PEAK" , NULL         , NULL   },
+	{ "Payload CRC32C",        TAG_TYPE_STRING , "CRC-32C of the untagged data"  , "PAYLOAD_CRC32C"        , NULL         , NULL   },
 	{ NULL, ((TagType)-1) }
 };
 
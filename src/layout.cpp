@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "layout.h"
+#include "job.h"
+#include "unicode_support.h"
+#include "log.h"
+
+//CRT includes
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <thread>
+
+//Windows includes
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#include <WinIoCtl.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Types
+///////////////////////////////////////////////////////////////////////////////
+
+typedef struct
+{
+	TagJob *job;
+	uint64_t volume;
+	uint64_t cluster;
+	size_t index;
+}
+layout_entry_t;
+
+static bool layout_less(const layout_entry_t &a, const layout_entry_t &b)
+{
+	if(a.volume  != b.volume ) return (a.volume  < b.volume );
+	if(a.cluster != b.cluster) return (a.cluster < b.cluster);
+	return (a.index < b.index);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+static std::map<DWORD, DWORD> g_clusterSize;
+static std::mutex g_clusterMutex;
+
+//Cluster size is looked up once per volume
+static DWORD get_cluster_size(const wchar_t *path, const DWORD volumeSerial)
+{
+	std::lock_guard<std::mutex> lock(g_clusterMutex);
+
+	std::map<DWORD, DWORD>::const_iterator iter = g_clusterSize.find(volumeSerial);
+	if(iter != g_clusterSize.end())
+	{
+		return iter->second;
+	}
+
+	wchar_t root[MAX_PATH];
+	DWORD sectorsPerCluster, bytesPerSector, freeClusters, totalClusters, clusterSize = 0;
+	if(GetVolumePathNameW(path, root, MAX_PATH) && GetDiskFreeSpaceW(root, &sectorsPerCluster, &bytesPerSector, &freeClusters, &totalClusters))
+	{
+		clusterSize = sectorsPerCluster * bytesPerSector;
+	}
+
+	g_clusterSize.insert(std::make_pair(volumeSerial, clusterSize));
+	return clusterSize;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Physical Layout
+///////////////////////////////////////////////////////////////////////////////
+
+void PhysicalLayout::sortJobs(std::vector<TagJob*> &jobs, const unsigned int threads)
+{
+	std::vector<layout_entry_t> entries(jobs.size());
+	std::atomic<size_t> next(0), unknown(0);
+	std::vector<std::thread> workers;
+
+	//The queries are metadata operations, so they are issued from several threads
+	for(unsigned int t = 0; t < threads; t++)
+	{
+		workers.push_back(std::thread([&]()
+		{
+			for(size_t i = next++; i < jobs.size(); i = next++)
+			{
+				layout_entry_t &entry = entries[i];
+				entry.job = jobs[i];
+				entry.index = i;
+				if(!queryTail(jobs[i]->getFileName(), entry.volume, entry.cluster))
+				{
+					entry.volume = entry.cluster = UINT64_MAX;
+					unknown++;
+				}
+			}
+		}));
+	}
+
+	for(std::vector<std::thread>::iterator iter = workers.begin(); iter != workers.end(); iter++)
+	{
+		iter->join();
+	}
+
+	std::sort(entries.begin(), entries.end(), layout_less);
+	for(size_t i = 0; i < entries.size(); i++)
+	{
+		jobs[i] = entries[i].job;
+	}
+
+	LOG_SUMMARY("Ordered %u file(s) by physical location, %u file(s) with unknown location.\n\n", (unsigned int)(jobs.size() - unknown.load()), (unsigned int) unknown.load());
+}
+
+//Returns the logical cluster number (LCN) that holds the last byte of the file
+bool PhysicalLayout::queryTail(const char *fileName, uint64_t &volume, uint64_t &cluster)
+{
+	wchar_t *path = utf8_to_utf16(fileName);
+	if(!path)
+	{
+		return false;
+	}
+
+	HANDLE handle = CreateFileW(path, FILE_READ_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, 0, NULL);
+	if(handle == INVALID_HANDLE_VALUE)
+	{
+		free(path);
+		return false;
+	}
+
+	BY_HANDLE_FILE_INFORMATION info;
+	bool success = (GetFileInformationByHandle(handle, &info) != FALSE);
+
+	const uint64_t fileSize = (((uint64_t) info.nFileSizeHigh) << 32) | info.nFileSizeLow;
+	const DWORD clusterSize = success ? get_cluster_size(path, info.dwVolumeSerialNumber) : 0;
+	success = success && (fileSize > 0) && (clusterSize > 0);
+
+	if(success)
+	{
+		//Only the extent that contains the starting VCN is needed, so ERROR_MORE_DATA is fine
+		STARTING_VCN_INPUT_BUFFER input;
+		RETRIEVAL_POINTERS_BUFFER output;
+		DWORD bytesReturned = 0;
+		input.StartingVcn.QuadPart = (fileSize - 1) / clusterSize;
+
+		success = (DeviceIoControl(handle, FSCTL_GET_RETRIEVAL_POINTERS, &input, sizeof(input), &output, sizeof(output), &bytesReturned, NULL) || (GetLastError() == ERROR_MORE_DATA));
+		success = success && (output.ExtentCount > 0) && (output.Extents[0].Lcn.QuadPart >= 0);
+
+		if(success)
+		{
+			volume = info.dwVolumeSerialNumber;
+			cluster = output.Extents[0].Lcn.QuadPart + (input.StartingVcn.QuadPart - output.StartingVcn.QuadPart);
+		}
+	}
+
+	CloseHandle(handle);
+	free(path);
+	return success;
+}
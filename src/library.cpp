@@ -0,0 +1,690 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "library.h"
+#include "ape_tag.h"
+#include "string_pool.h"
+#include "utils.h"
+#include "unicode_support.h"
+#include "log.h"
+
+//CRT includes
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <iterator>
+#include <sys/stat.h>
+#include <io.h>
+
+//Windows includes
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+//Const
+static const char INDEX_MAGIC[8] = { 'T', 'A', 'G', 'I', 'N', 'D', 'X', '1' };
+static const size_t MAX_LINE_LENGTH = 65536;
+static const uint32_t NO_ENTRY = UINT32_MAX;
+
+///////////////////////////////////////////////////////////////////////////////
+// Index structs
+///////////////////////////////////////////////////////////////////////////////
+
+// All values are little-endian, every section starts at a multiple of eight.
+// Strings are referenced by their rank in the dictionary. Postings are sorted
+// by key, value and file, the postings of key 'k' are in the range between
+// keyPostings[k] and keyPostings[k+1].
+typedef enum
+{
+	SECTION_FILE_PATHS,     /*uint32_t[files]*/
+	SECTION_FILE_SIZES,     /*uint64_t[files]*/
+	SECTION_FILE_TIMES,     /*int64_t[files]*/
+	SECTION_STRING_OFFSETS, /*uint32_t[strings + 1]*/
+	SECTION_STRING_DATA,    /*char[], NUL-terminated strings*/
+	SECTION_KEY_STRINGS,    /*uint32_t[keys]*/
+	SECTION_KEY_POSTINGS,   /*uint32_t[keys + 1]*/
+	SECTION_POSTING_VALUES, /*uint32_t[postings]*/
+	SECTION_POSTING_FILES,  /*uint32_t[postings]*/
+	SECTION_COUNT
+}
+index_section_t;
+
+typedef struct
+{
+	char magic[8];
+	uint32_t fileCount;
+	uint32_t stringCount;
+	uint32_t keyCount;
+	uint32_t postingCount;
+	uint64_t sections[SECTION_COUNT];
+}
+index_header_t;
+
+typedef enum
+{
+	ENTRY_PENDING,
+	ENTRY_SCANNED,
+	ENTRY_REUSED,
+	ENTRY_FAILED
+}
+entry_state_t;
+
+typedef struct
+{
+	uint32_t path;
+	uint64_t size;
+	int64_t time;
+	entry_state_t state;
+	uint32_t previous;
+	std::vector<std::pair<uint32_t, uint32_t>> items; /*interned key and value*/
+}
+index_entry_t;
+
+typedef struct
+{
+	uint32_t key;
+	uint32_t value;
+	uint32_t file;
+}
+index_posting_t;
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+static inline uint64_t align_section(const uint64_t pos)
+{
+	return (pos + 7) & (~((uint64_t) 7));
+}
+
+static inline bool check_section(const index_header_t *header, const index_section_t section, const uint64_t size, const uint64_t fileSize)
+{
+	const uint64_t offset = header->sections[section];
+	return ((offset % 8) == 0) && (offset >= sizeof(index_header_t)) && (offset <= fileSize) && (size <= fileSize - offset);
+}
+
+static inline bool posting_less(const index_posting_t &a, const index_posting_t &b)
+{
+	if(a.key   != b.key  ) return a.key   < b.key;
+	if(a.value != b.value) return a.value < b.value;
+	return a.file < b.file;
+}
+
+static inline bool posting_equal(const index_posting_t &a, const index_posting_t &b)
+{
+	return (a.key == b.key) && (a.value == b.value) && (a.file == b.file);
+}
+
+static bool write_section(FILE *file, uint64_t &pos, const uint64_t offset, const void *data, const size_t size)
+{
+	static const unsigned char padding[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+	if((offset > pos) && (fwrite(padding, sizeof(unsigned char), (size_t)(offset - pos), file) != (size_t)(offset - pos)))
+	{
+		return false;
+	}
+	if((size > 0) && (fwrite(data, sizeof(unsigned char), size, file) != size))
+	{
+		return false;
+	}
+
+	pos = offset + size;
+	return true;
+}
+
+//Builds the dictionary, the file table and the postings, then writes all sections
+static bool write_index(const char *fileName, std::vector<index_entry_t*> &entries)
+{
+	//The dictionary is ordered by strcmp(), so that it can be searched by a binary search
+	std::vector<uint32_t> strings;
+	for(std::vector<index_entry_t*>::const_iterator iter = entries.cbegin(); iter != entries.cend(); iter++)
+	{
+		strings.push_back((*iter)->path);
+		for(std::vector<std::pair<uint32_t, uint32_t>>::const_iterator item = (*iter)->items.cbegin(); item != (*iter)->items.cend(); item++)
+		{
+			strings.push_back(item->first);
+			strings.push_back(item->second);
+		}
+	}
+	std::sort(strings.begin(), strings.end());
+	strings.erase(std::unique(strings.begin(), strings.end()), strings.end());
+	std::sort(strings.begin(), strings.end(), [](const uint32_t a, const uint32_t b) { return strcmp(StringPool::lookup(a), StringPool::lookup(b)) < 0; });
+
+	std::unordered_map<uint32_t, uint32_t> ranks(strings.size());
+	std::vector<uint32_t> stringOffsets;
+	std::vector<char> stringData;
+	for(size_t i = 0; i < strings.size(); i++)
+	{
+		const char *const str = StringPool::lookup(strings[i]);
+		ranks[strings[i]] = (uint32_t) i;
+		stringOffsets.push_back((uint32_t) stringData.size());
+		stringData.insert(stringData.end(), str, str + strlen(str) + 1);
+	}
+	stringOffsets.push_back((uint32_t) stringData.size());
+
+	//Files are ordered by path, too
+	std::sort(entries.begin(), entries.end(), [&ranks](const index_entry_t *a, const index_entry_t *b) { return ranks[a->path] < ranks[b->path]; });
+
+	std::vector<uint32_t> filePaths;
+	std::vector<uint64_t> fileSizes;
+	std::vector<int64_t> fileTimes;
+	std::vector<index_posting_t> postings;
+	for(size_t i = 0; i < entries.size(); i++)
+	{
+		filePaths.push_back(ranks[entries[i]->path]);
+		fileSizes.push_back(entries[i]->size);
+		fileTimes.push_back(entries[i]->time);
+		for(std::vector<std::pair<uint32_t, uint32_t>>::const_iterator item = entries[i]->items.cbegin(); item != entries[i]->items.cend(); item++)
+		{
+			const index_posting_t posting = { ranks[item->first], ranks[item->second], (uint32_t) i };
+			postings.push_back(posting);
+		}
+	}
+	std::sort(postings.begin(), postings.end(), posting_less);
+	postings.erase(std::unique(postings.begin(), postings.end(), posting_equal), postings.end());
+
+	//Split the postings into columns and record where each key starts
+	std::vector<uint32_t> keyStrings, keyPostings, postingValues, postingFiles;
+	for(size_t i = 0; i < postings.size(); i++)
+	{
+		if(keyStrings.empty() || (keyStrings.back() != postings[i].key))
+		{
+			keyStrings.push_back(postings[i].key);
+			keyPostings.push_back((uint32_t) i);
+		}
+		postingValues.push_back(postings[i].value);
+		postingFiles.push_back(postings[i].file);
+	}
+	keyPostings.push_back((uint32_t) postings.size());
+
+	const void *const data[SECTION_COUNT] =
+	{
+		filePaths.data(), fileSizes.data(), fileTimes.data(), stringOffsets.data(), stringData.data(),
+		keyStrings.data(), keyPostings.data(), postingValues.data(), postingFiles.data()
+	};
+	const size_t size[SECTION_COUNT] =
+	{
+		filePaths.size() * sizeof(uint32_t), fileSizes.size() * sizeof(uint64_t), fileTimes.size() * sizeof(int64_t), stringOffsets.size() * sizeof(uint32_t), stringData.size(),
+		keyStrings.size() * sizeof(uint32_t), keyPostings.size() * sizeof(uint32_t), postingValues.size() * sizeof(uint32_t), postingFiles.size() * sizeof(uint32_t)
+	};
+
+	index_header_t header;
+	memset(&header, 0, sizeof(index_header_t));
+	memcpy(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+	header.fileCount = (uint32_t) filePaths.size();
+	header.stringCount = (uint32_t) strings.size();
+	header.keyCount = (uint32_t) keyStrings.size();
+	header.postingCount = (uint32_t) postings.size();
+
+	uint64_t pos = sizeof(index_header_t);
+	for(int i = 0; i < SECTION_COUNT; i++)
+	{
+		header.sections[i] = align_section(pos);
+		pos = header.sections[i] + size[i];
+	}
+
+	FILE *file = fopen_utf8(fileName, "wb");
+	if(!file)
+	{
+		LOG("Failed to open index file for writing:\n%s\n\nInvalid file specified or access denied!\n\n", fileName);
+		return false;
+	}
+
+	pos = 0;
+	bool success = write_section(file, pos, 0, &header, sizeof(index_header_t));
+	for(int i = 0; success && (i < SECTION_COUNT); i++)
+	{
+		success = write_section(file, pos, header.sections[i], data[i], size[i]);
+	}
+
+	if((fclose(file) != 0) || (!success))
+	{
+		LOG("Failed to write index file:\n%s\n\nDisk full or access denied!\n\n", fileName);
+		return false;
+	}
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Constructor & Destructor
+///////////////////////////////////////////////////////////////////////////////
+
+LibraryIndex::LibraryIndex(void)
+:
+	m_mapping(NULL), m_view(NULL), m_fileCount(0), m_stringCount(0), m_keyCount(0)
+{
+}
+
+LibraryIndex::~LibraryIndex(void)
+{
+	close();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Public functions
+///////////////////////////////////////////////////////////////////////////////
+
+bool LibraryIndex::open(const char *fileName)
+{
+	close();
+
+	FILE *file = fopen_utf8(fileName, "rb");
+	if(!file)
+	{
+		LOG("Failed to open index file:\n%s\n\nInvalid file specified or access denied!\n\n", fileName);
+		return false;
+	}
+
+	//The mapping keeps its own reference to the file, so the file can be closed right away
+	uint64_t fileSize = 0;
+	if(get_file_size(file, fileSize) && (fileSize >= sizeof(index_header_t)) && (fileSize <= SIZE_MAX))
+	{
+		m_mapping = CreateFileMappingW((HANDLE) _get_osfhandle(_fileno(file)), NULL, PAGE_READONLY, 0, 0, NULL);
+		if(m_mapping)
+		{
+			m_view = (const unsigned char*) MapViewOfFile((HANDLE) m_mapping, FILE_MAP_READ, 0, 0, 0);
+		}
+	}
+	fclose(file);
+
+	if(!m_view)
+	{
+		LOG("Failed to read index file:\n%s\n\nFile is corrupted or not a library index!\n\n", fileName);
+		close();
+		return false;
+	}
+
+	//Check the bounds of all sections and of all references once, so that queries do not have to
+	const index_header_t *const header = (const index_header_t*) m_view;
+	bool valid = (memcmp(header->magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) == 0);
+	valid = valid && check_section(header, SECTION_FILE_PATHS, ((uint64_t) header->fileCount) * sizeof(uint32_t), fileSize);
+	valid = valid && check_section(header, SECTION_FILE_SIZES, ((uint64_t) header->fileCount) * sizeof(uint64_t), fileSize);
+	valid = valid && check_section(header, SECTION_FILE_TIMES, ((uint64_t) header->fileCount) * sizeof(int64_t), fileSize);
+	valid = valid && check_section(header, SECTION_STRING_OFFSETS, (((uint64_t) header->stringCount) + 1) * sizeof(uint32_t), fileSize);
+	valid = valid && check_section(header, SECTION_STRING_DATA, 0, fileSize);
+	valid = valid && check_section(header, SECTION_KEY_STRINGS, ((uint64_t) header->keyCount) * sizeof(uint32_t), fileSize);
+	valid = valid && check_section(header, SECTION_KEY_POSTINGS, (((uint64_t) header->keyCount) + 1) * sizeof(uint32_t), fileSize);
+	valid = valid && check_section(header, SECTION_POSTING_VALUES, ((uint64_t) header->postingCount) * sizeof(uint32_t), fileSize);
+	valid = valid && check_section(header, SECTION_POSTING_FILES, ((uint64_t) header->postingCount) * sizeof(uint32_t), fileSize);
+
+	if(valid)
+	{
+		m_fileCount = header->fileCount;
+		m_stringCount = header->stringCount;
+		m_keyCount = header->keyCount;
+		m_filePaths = (const uint32_t*) &m_view[header->sections[SECTION_FILE_PATHS]];
+		m_fileSizes = (const uint64_t*) &m_view[header->sections[SECTION_FILE_SIZES]];
+		m_fileTimes = (const int64_t*) &m_view[header->sections[SECTION_FILE_TIMES]];
+		m_stringOffsets = (const uint32_t*) &m_view[header->sections[SECTION_STRING_OFFSETS]];
+		m_stringData = (const char*) &m_view[header->sections[SECTION_STRING_DATA]];
+		m_keyStrings = (const uint32_t*) &m_view[header->sections[SECTION_KEY_STRINGS]];
+		m_keyPostings = (const uint32_t*) &m_view[header->sections[SECTION_KEY_POSTINGS]];
+		m_postingValues = (const uint32_t*) &m_view[header->sections[SECTION_POSTING_VALUES]];
+		m_postingFiles = (const uint32_t*) &m_view[header->sections[SECTION_POSTING_FILES]];
+
+		//Every string must be terminated within the string data
+		const uint64_t dataSize = fileSize - header->sections[SECTION_STRING_DATA];
+		valid = (m_stringOffsets[0] == 0) && (m_stringOffsets[m_stringCount] <= dataSize);
+		for(uint32_t i = 0; valid && (i < m_stringCount); i++)
+		{
+			valid = (m_stringOffsets[i] < m_stringOffsets[i + 1]) && (m_stringData[m_stringOffsets[i + 1] - 1] == '\0');
+		}
+
+		valid = valid && (m_keyPostings[0] == 0) && (m_keyPostings[m_keyCount] == header->postingCount);
+		for(uint32_t i = 0; valid && (i < m_keyCount); i++)
+		{
+			valid = (m_keyStrings[i] < m_stringCount) && (m_keyPostings[i] <= m_keyPostings[i + 1]);
+		}
+		for(uint32_t i = 0; valid && (i < m_fileCount); i++)
+		{
+			valid = (m_filePaths[i] < m_stringCount);
+		}
+		for(uint32_t i = 0; valid && (i < header->postingCount); i++)
+		{
+			valid = (m_postingValues[i] < m_stringCount) && (m_postingFiles[i] < m_fileCount);
+		}
+	}
+
+	if(!valid)
+	{
+		LOG("Failed to read index file:\n%s\n\nFile is corrupted or not a library index!\n\n", fileName);
+		close();
+		return false;
+	}
+
+	return true;
+}
+
+void LibraryIndex::close(void)
+{
+	if(m_view)
+	{
+		UnmapViewOfFile(m_view);
+		m_view = NULL;
+	}
+	if(m_mapping)
+	{
+		CloseHandle((HANDLE) m_mapping);
+		m_mapping = NULL;
+	}
+	m_fileCount = m_stringCount = m_keyCount = 0;
+}
+
+//Conditions are "<key>=<value>", "<key>" (file has the key) or "!<key>" (file lacks the key), all must hold
+bool LibraryIndex::query(const int count, const char *const *conditions, std::vector<uint32_t> &files) const
+{
+	files.resize(m_fileCount);
+	for(uint32_t i = 0; i < m_fileCount; i++)
+	{
+		files[i] = i;
+	}
+
+	for(int i = 0; i < count; i++)
+	{
+		const bool negate = (conditions[i][0] == '!');
+		const char *const key = negate ? &conditions[i][1] : conditions[i];
+		const char *const value = strchr(key, '=');
+		if((key[0] == '\0') || (key[0] == '=') || (negate && value))
+		{
+			LOG("Invalid query condition:\n%s\n\n", conditions[i]);
+			return false;
+		}
+
+		//Keys are case-insensitive, so several keys of the index may match
+		const std::string keyName(key, value ? (value - key) : strlen(key));
+		std::vector<uint32_t> matches;
+		for(uint32_t k = 0; k < m_keyCount; k++)
+		{
+			if(_stricmp(keyName.c_str(), &m_stringData[m_stringOffsets[m_keyStrings[k]]]) == 0)
+			{
+				collectFiles(k, value ? &value[1] : NULL, matches);
+			}
+		}
+		std::sort(matches.begin(), matches.end());
+		matches.erase(std::unique(matches.begin(), matches.end()), matches.end());
+
+		std::vector<uint32_t> result;
+		if(negate)
+		{
+			std::set_difference(files.cbegin(), files.cend(), matches.cbegin(), matches.cend(), std::back_inserter(result));
+		}
+		else
+		{
+			std::set_intersection(files.cbegin(), files.cend(), matches.cbegin(), matches.cend(), std::back_inserter(result));
+		}
+		files.swap(result);
+	}
+
+	return true;
+}
+
+const char *LibraryIndex::getPath(const uint32_t file) const
+{
+	return (file < m_fileCount) ? &m_stringData[m_stringOffsets[m_filePaths[file]]] : NULL;
+}
+
+bool LibraryIndex::update(const char *indexFile, const char *manifest, const unsigned int threads)
+{
+	FILE *list = fopen_utf8(manifest, "rb");
+	if(!list)
+	{
+		LOG("Failed to open manifest file:\n%s\n\nInvalid file specified or access denied!\n\n", manifest);
+		return false;
+	}
+
+	//Only the file name of each manifest line is used, items are ignored
+	std::vector<index_entry_t> entries;
+	std::unordered_set<uint32_t> known;
+	std::vector<char> line(MAX_LINE_LENGTH);
+	bool firstLine = true;
+	while(fgets(line.data(), MAX_LINE_LENGTH, list))
+	{
+		char *start = line.data();
+		if(firstLine && (memcmp(start, "\xEF\xBB\xBF", 3) == 0))
+		{
+			start += 3; /*skip the UTF-8 BOM*/
+		}
+		firstLine = false;
+
+		start[strcspn(start, "\t\r\n")] = '\0';
+		if(start[0] == '\0')
+		{
+			continue;
+		}
+
+		const uint32_t path = StringPool::intern(start);
+		if(known.insert(path).second)
+		{
+			index_entry_t entry;
+			entry.path = path;
+			entry.size = 0;
+			entry.time = 0;
+			entry.state = ENTRY_PENDING;
+			entry.previous = NO_ENTRY;
+			entries.push_back(entry);
+		}
+	}
+	fclose(list);
+
+	//Entries of an existing index are taken over, if size and modification time still match
+	LibraryIndex previous;
+	std::unordered_map<uint32_t, uint32_t> previousFiles;
+	struct _stat64 info;
+	if(stat64_utf8(indexFile, &info) == 0)
+	{
+		if(!previous.open(indexFile))
+		{
+			return false;
+		}
+		for(uint32_t i = 0; i < previous.m_fileCount; i++)
+		{
+			previousFiles[StringPool::intern(previous.getPath(i))] = i;
+		}
+	}
+
+	const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+	std::atomic<size_t> next(0), scanned(0), reused(0), failed(0);
+	std::vector<std::thread> workers;
+	for(unsigned int t = 0; t < ((threads > 0) ? threads : 1); t++)
+	{
+		workers.push_back(std::thread([&]()
+		{
+			for(size_t i = next++; i < entries.size(); i = next++)
+			{
+				index_entry_t &entry = entries[i];
+				const char *const fileName = StringPool::lookup(entry.path);
+
+				struct _stat64 fileInfo;
+				if((stat64_utf8(fileName, &fileInfo) != 0) || ((fileInfo.st_mode & _S_IFMT) != _S_IFREG))
+				{
+					LOG_SUMMARY("Warning: Skipping file that cannot be accessed:\n%s\n\n", fileName);
+					entry.state = ENTRY_FAILED;
+					failed++;
+					continue;
+				}
+				entry.size = fileInfo.st_size;
+				entry.time = fileInfo.st_mtime;
+
+				std::unordered_map<uint32_t, uint32_t>::const_iterator prev = previousFiles.find(entry.path);
+				if((prev != previousFiles.cend()) && (previous.m_fileSizes[prev->second] == entry.size) && (previous.m_fileTimes[prev->second] == entry.time))
+				{
+					entry.state = ENTRY_REUSED;
+					entry.previous = prev->second;
+					reused++;
+					continue;
+				}
+
+				std::vector<std::pair<std::string, std::string>> items;
+				if(!ApeTagger::readText(fileName, items))
+				{
+					entry.state = ENTRY_FAILED;
+					failed++;
+					continue;
+				}
+				for(std::vector<std::pair<std::string, std::string>>::const_iterator item = items.cbegin(); item != items.cend(); item++)
+				{
+					entry.items.push_back(std::make_pair(StringPool::intern(item->first.c_str()), StringPool::intern(item->second.c_str())));
+				}
+				entry.state = ENTRY_SCANNED;
+				scanned++;
+			}
+		}));
+	}
+	for(std::vector<std::thread>::iterator iter = workers.begin(); iter != workers.end(); iter++)
+	{
+		iter->join();
+	}
+
+	//Recover the items of reused entries from the postings, each string is interned only once
+	if(reused > 0)
+	{
+		std::vector<uint32_t> owner(previous.m_fileCount, NO_ENTRY);
+		for(size_t i = 0; i < entries.size(); i++)
+		{
+			if(entries[i].state == ENTRY_REUSED)
+			{
+				owner[entries[i].previous] = (uint32_t) i;
+			}
+		}
+
+		std::vector<uint32_t> interned(previous.m_stringCount, 0);
+		for(uint32_t k = 0; k < previous.m_keyCount; k++)
+		{
+			for(uint32_t p = previous.m_keyPostings[k]; p < previous.m_keyPostings[k + 1]; p++)
+			{
+				const uint32_t entry = owner[previous.m_postingFiles[p]];
+				if(entry != NO_ENTRY)
+				{
+					const uint32_t key = previous.m_keyStrings[k], value = previous.m_postingValues[p];
+					if(!interned[key]) interned[key] = StringPool::intern(&previous.m_stringData[previous.m_stringOffsets[key]]);
+					if(!interned[value]) interned[value] = StringPool::intern(&previous.m_stringData[previous.m_stringOffsets[value]]);
+					entries[entry].items.push_back(std::make_pair(interned[key], interned[value]));
+				}
+			}
+		}
+	}
+
+	//The previous index must be unmapped before it can be replaced
+	previous.close();
+
+	std::vector<index_entry_t*> indexed;
+	for(std::vector<index_entry_t>::iterator iter = entries.begin(); iter != entries.end(); iter++)
+	{
+		if(iter->state != ENTRY_FAILED)
+		{
+			indexed.push_back(&(*iter));
+		}
+	}
+
+	const std::string tempFile = std::string(indexFile) + ".tmp";
+	if(!write_index(tempFile.c_str(), indexed))
+	{
+		return false;
+	}
+	if(rename_utf8(tempFile.c_str(), indexFile) != 0)
+	{
+		LOG("Failed to replace index file:\n%s\n\nAccess denied!\n\n", indexFile);
+		return false;
+	}
+
+	const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+	LOG_SUMMARY("Indexed %u file(s) in %.0f ms: %u scanned, %u unchanged, %u failed.\n\n", (unsigned int) indexed.size(), elapsed, (unsigned int) scanned, (unsigned int) reused, (unsigned int) failed);
+	return (failed == 0);
+}
+
+//Prints the path of every matching file to the standard output
+bool LibraryIndex::run(const char *indexFile, const int count, const char *const *conditions)
+{
+	const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+	LibraryIndex index;
+	if(!index.open(indexFile))
+	{
+		return false;
+	}
+
+	std::vector<uint32_t> files;
+	if(!index.query(count, conditions, files))
+	{
+		return false;
+	}
+
+	for(std::vector<uint32_t>::const_iterator iter = files.cbegin(); iter != files.cend(); iter++)
+	{
+		fprintf(stdout, "%s\n", index.getPath(*iter));
+	}
+	fflush(stdout);
+
+	const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+	LOG_SUMMARY("%u of %u file(s) matched in %.1f ms.\n\n", (unsigned int) files.size(), index.getFileCount(), elapsed);
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Internal functions
+///////////////////////////////////////////////////////////////////////////////
+
+bool LibraryIndex::findString(const char *str, uint32_t &id) const
+{
+	uint32_t lower = 0, upper = m_stringCount;
+	while(lower < upper)
+	{
+		const uint32_t mid = lower + ((upper - lower) / 2);
+		const int cmp = strcmp(str, &m_stringData[m_stringOffsets[mid]]);
+		if(cmp == 0)
+		{
+			id = mid;
+			return true;
+		}
+		if(cmp < 0) upper = mid; else lower = mid + 1;
+	}
+	return false;
+}
+
+//Appends the files of key 'k' that have the given value, or all files of the key if value is NULL
+void LibraryIndex::collectFiles(const uint32_t key, const char *value, std::vector<uint32_t> &files) const
+{
+	const uint32_t *first = &m_postingValues[m_keyPostings[key]];
+	const uint32_t *last = &m_postingValues[m_keyPostings[key + 1]];
+
+	if(value)
+	{
+		uint32_t id;
+		if(!findString(value, id))
+		{
+			return;
+		}
+		const std::pair<const uint32_t*, const uint32_t*> range = std::equal_range(first, last, id);
+		first = range.first;
+		last = range.second;
+	}
+
+	files.insert(files.end(), &m_postingFiles[first - m_postingValues], &m_postingFiles[last - m_postingValues]);
+}
@@ -0,0 +1,83 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TAG_LIBRARY_H_INCLUDED
+#define TAG_LIBRARY_H_INCLUDED
+
+#include <vector>
+#include <stdexcept>
+#include <stdint.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Library Index
+///////////////////////////////////////////////////////////////////////////////
+
+// Columnar index of the APE text items of all files listed in a manifest. The
+// index consists of a file table (path, size and modification time), a sorted
+// dictionary of all strings and, for each key, a list of postings sorted by
+// value. A string is referenced by its rank in the dictionary, so looking up a
+// string is a binary search. Queries memory-map the index and do not parse it.
+//
+// The index is built by scanning the tails of the files on several threads.
+// When an index exists already, only files whose size or modification time
+// have changed are scanned again, all other entries are taken over as is.
+class LibraryIndex
+{
+public:
+	LibraryIndex(void);
+	~LibraryIndex(void);
+
+	bool open(const char *fileName);
+	void close(void);
+
+	bool query(const int count, const char *const *conditions, std::vector<uint32_t> &files) const;
+	const char *getPath(const uint32_t file) const;
+
+	inline uint32_t getFileCount(void) const { return m_fileCount; }
+
+	static bool update(const char *indexFile, const char *manifest, const unsigned int threads);
+	static bool run(const char *indexFile, const int count, const char *const *conditions);
+
+private:
+	bool findString(const char *str, uint32_t &id) const;
+	void collectFiles(const uint32_t key, const char *value, std::vector<uint32_t> &files) const;
+
+	void *m_mapping;
+	const unsigned char *m_view;
+
+	uint32_t m_fileCount;
+	uint32_t m_stringCount;
+	uint32_t m_keyCount;
+	const uint32_t *m_filePaths;
+	const uint64_t *m_fileSizes;
+	const int64_t *m_fileTimes;
+	const uint32_t *m_stringOffsets;
+	const char *m_stringData;
+	const uint32_t *m_keyStrings;
+	const uint32_t *m_keyPostings;
+	const uint32_t *m_postingValues;
+	const uint32_t *m_postingFiles;
+
+	LibraryIndex &operator=(const LibraryIndex &rhs) { throw std::runtime_error("Unimplemented!"); }
+};
+
+#endif //TAG_LIBRARY_H_INCLUDED
@@ -0,0 +1,217 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "log.h"
+
+//CRT includes
+#include <cstdio>
+#include <cstdarg>
+#include <cstring>
+#include <vector>
+#include <atomic>
+
+//Const
+static const size_t LOG_CHUNK_LIMIT = 65536;
+static const size_t LOG_MESSAGE_SIZE = 1024;
+
+///////////////////////////////////////////////////////////////////////////////
+// Globals
+///////////////////////////////////////////////////////////////////////////////
+
+LogLevel Log::s_level = LOG_LEVEL_SUMMARY;
+LogFormat Log::s_format = LOG_FORMAT_TEXT;
+
+static __declspec(thread) LogChunk *t_chunk = NULL;
+static __declspec(thread) unsigned int t_tid = 0;
+static std::atomic<unsigned int> g_nextTid(1);
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+static const char *const LEVEL_NAMES[] = { "error", "summary", "verbose" };
+
+static void append_json_string(std::string &dest, const char *str, const size_t length)
+{
+	char buffer[8];
+	dest.push_back('"');
+	for(size_t i = 0; i < length; i++)
+	{
+		const unsigned char c = str[i];
+		if((c == '"') || (c == '\\'))
+		{
+			dest.push_back('\\'); dest.push_back(c);
+		}
+		else if(c == '\n')
+		{
+			dest.append("\\n");
+		}
+		else if(c < 0x20)
+		{
+			sprintf(buffer, "\\u%04x", c);
+			dest.append(buffer);
+		}
+		else
+		{
+			dest.push_back(c);
+		}
+	}
+	dest.push_back('"');
+}
+
+//Messages are built from several lines and are framed by empty lines in text format, JSON records drop the framing
+static bool format_json(std::string &dest, const LogLevel level, const char *message, size_t length)
+{
+	while(length && ((*message == '\n') || (*message == ' ')))
+	{
+		message++; length--;
+	}
+	while(length && (message[length - 1] == '\n'))
+	{
+		length--;
+	}
+	if(!length)
+	{
+		return false;
+	}
+
+	if(!t_tid)
+	{
+		t_tid = g_nextTid++;
+	}
+
+	char buffer[64];
+	sprintf(buffer, "{\"level\":\"%s\",\"thread\":%u,", LEVEL_NAMES[level], t_tid);
+	dest.append(buffer);
+	if(t_chunk && t_chunk->getFileName())
+	{
+		dest.append("\"file\":");
+		append_json_string(dest, t_chunk->getFileName(), strlen(t_chunk->getFileName()));
+		dest.push_back(',');
+	}
+	dest.append("\"message\":");
+	append_json_string(dest, message, length);
+	dest.append("}\n");
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Log
+///////////////////////////////////////////////////////////////////////////////
+
+void Log::setLevel(const LogLevel level)
+{
+	s_level = level;
+}
+
+void Log::setFormat(const LogFormat format)
+{
+	s_format = format;
+}
+
+void Log::write(const LogLevel level, const char *format, ...)
+{
+	if(!isEnabled(level))
+	{
+		return;
+	}
+
+	//Short messages are formatted on the stack
+	char buffer[LOG_MESSAGE_SIZE];
+	std::vector<char> heap;
+	va_list args;
+
+	va_start(args, format);
+	const int length = _vscprintf(format, args);
+	va_end(args);
+	if(length <= 0)
+	{
+		return;
+	}
+
+	char *message = buffer;
+	if(((size_t) length) >= LOG_MESSAGE_SIZE)
+	{
+		heap.resize(length + 1);
+		message = heap.data();
+	}
+
+	va_start(args, format);
+	_vsnprintf(message, length + 1, format, args);
+	va_end(args);
+
+	std::string record;
+	const char *data = message;
+	size_t size = length;
+	if(s_format == LOG_FORMAT_JSON)
+	{
+		if(!format_json(record, level, message, length))
+		{
+			return;
+		}
+		data = record.data();
+		size = record.size();
+	}
+
+	if(t_chunk)
+	{
+		t_chunk->append(data, size);
+		return;
+	}
+	fwrite(data, sizeof(char), size, stderr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Log Chunk
+///////////////////////////////////////////////////////////////////////////////
+
+LogChunk::LogChunk(const char *fileName)
+:
+	m_fileName(fileName), m_outer(t_chunk)
+{
+	t_chunk = this;
+}
+
+LogChunk::~LogChunk(void)
+{
+	flush();
+	t_chunk = m_outer;
+}
+
+//A chunk that grows beyond the limit is written early, so a long run does not hold its messages back
+void LogChunk::append(const char *data, const size_t length)
+{
+	m_buffer.append(data, length);
+	if(m_buffer.size() >= LOG_CHUNK_LIMIT)
+	{
+		flush();
+	}
+}
+
+void LogChunk::flush(void)
+{
+	if(!m_buffer.empty())
+	{
+		fwrite(m_buffer.data(), sizeof(char), m_buffer.size(), stderr);
+		m_buffer.clear();
+	}
+}
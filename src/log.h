@@ -0,0 +1,99 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TAG_LOG_H_INCLUDED
+#define TAG_LOG_H_INCLUDED
+
+#include <string>
+#include <stdexcept>
+
+///////////////////////////////////////////////////////////////////////////////
+// Logging
+///////////////////////////////////////////////////////////////////////////////
+
+// A message is written when its level does not exceed the current level, so
+// errors (LOG_LEVEL_QUIET) are always written, progress and results of a run
+// (LOG_LEVEL_SUMMARY) are written by default and per-file and per-item details
+// (LOG_LEVEL_VERBOSE) only on request. A message that is not written returns
+// before it is formatted.
+//
+// While a LogChunk is alive, the messages of its thread are collected in the
+// chunk and written at once when it goes out of scope, so the messages of one
+// file stay together and each chunk is a single write to stderr. Messages of a
+// thread without a chunk are written right away. In JSON format, each message
+// is one line with its level, the thread and the file of the chunk.
+typedef enum
+{
+	LOG_LEVEL_QUIET   = 0,
+	LOG_LEVEL_SUMMARY = 1,
+	LOG_LEVEL_VERBOSE = 2
+}
+LogLevel;
+
+typedef enum
+{
+	LOG_FORMAT_TEXT = 0,
+	LOG_FORMAT_JSON = 1
+}
+LogFormat;
+
+class Log
+{
+public:
+	static void setLevel(const LogLevel level);
+	static void setFormat(const LogFormat format);
+
+	static inline bool isEnabled(const LogLevel level) { return (level <= s_level); }
+
+	static void write(const LogLevel level, const char *format, ...);
+
+private:
+	static LogLevel s_level;
+	static LogFormat s_format;
+};
+
+class LogChunk
+{
+public:
+	LogChunk(const char *fileName);
+	~LogChunk(void);
+
+	void append(const char *data, const size_t length);
+	void flush(void);
+
+	inline const char *getFileName(void) const { return m_fileName; }
+
+private:
+	const char *const m_fileName;
+	LogChunk *const m_outer;
+	std::string m_buffer;
+
+	LogChunk &operator=(const LogChunk &rhs) { throw std::runtime_error("Unimplemented!"); }
+};
+
+#define LOG_CHUNK(FILE_NAME) LogChunk _log_chunk(FILE_NAME)
+
+#define LOG(...)         Log::write(LOG_LEVEL_QUIET,   __VA_ARGS__)
+#define LOG_SUMMARY(...) Log::write(LOG_LEVEL_SUMMARY, __VA_ARGS__)
+#define LOG_VERBOSE(...) Log::write(LOG_LEVEL_VERBOSE, __VA_ARGS__)
+
+#endif //TAG_LOG_H_INCLUDED
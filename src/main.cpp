@@ -25,6 +25,7 @@
 #include <cstdio>
 #include <stdexcept>
 #include <csignal>
+#include <thread>
 
 //Windows includes
 #define NOMINMAX
@@ -35,16 +36,23 @@
 #include "types.h"
 #include "parser.h"
 #include "ape_tag.h"
+#include "stream_filter.h"
+#include "pipeline.h"
+#include "options.h"
+#include "job.h"
+#include "replaygain.h"
+#include "watch.h"
+#include "library.h"
+#include "binary_cache.h"
+#include "trace.h"
 #include "keys.h"
 #include "unicode_support.h"
+#include "log.h"
 
 //Const
 static const unsigned int TAG_VERSION_MAJOR = 1;
 static const unsigned int TAG_VERSION_MINOR = 0;
 
-//Macros
-#define LOG(...) fprintf(stderr, __VA_ARGS__)
-
 ///////////////////////////////////////////////////////////////////////////////
 // Help screen
 ///////////////////////////////////////////////////////////////////////////////
@@ -55,39 +63,163 @@ void tag_help(void)
 	LOG("http://wiki.hydrogenaudio.org/index.php?title=APEv2_specification\n");
 	LOG("\n\n");
 	LOG("Usage:\n");
-	LOG("   tag.exe <type> <file> [<tag 1> <tag 2> ... <tag n>]\n");
+	LOG("   tag.exe [<options>] <type>[+<type>...] <file> [<tag 1> <tag 2> ... <tag n>]\n");
 	LOG("\n");
-	LOG("Options:\n");
+	LOG("Arguments:\n");
 	LOG("   type - The technical type of the meta tag to be added\n");
-	LOG("   file - the media file to append the tag to\n");
+	LOG("   file - the media file to append the tag to, or \"-\" to filter STDIN to STDOUT,\n");
+	LOG("          or \"@<manifest>\" to process all files listed in the manifest file\n");
 	LOG("   tag  - meta tag item to be added in the \"key=value\" format\n");
 	LOG("\n");
+	LOG("Options:\n");
+	LOG("   --stages=<s>,<r>,<c>,<w> - Threads for the stat, read, serialize and write stages\n");
+	LOG("   --replaygain             - Analyze PCM WAV input (44.1/48 kHz) and add ReplayGain items\n");
+	LOG("   --checksum               - Add the CRC-32C of the payload (file without tags), APE2 only\n");
+	LOG("   --sink=<type>            - How APE tags are written: stdio, pwrite, mmap or memory\n");
+	LOG("   --physical-order         - Process files in the order of their location on disk\n");
+	LOG("   --shard=<i>/<n>          - Process only the i-th of n partitions of the manifest\n");
+	LOG("   --journal=<file>         - Record completed files and skip them when resuming\n");
+	LOG("   --trace=<file>           - Write a timeline of all processing steps (Chrome trace JSON)\n");
+	LOG("   --watch                  - Treat <file> as a drop folder and tag every file arriving there\n");
+	LOG("   --rules=<file>           - Rules for watch mode: \"<pattern>\" plus TAB-separated items\n");
+	LOG("   --debounce=<ms>          - Quiet time before an arriving file is tagged (default: 500)\n");
+	LOG("   --nfc                    - Convert all text values to Unicode normalization form C\n");
+	LOG("   --copy-from=<file>       - Copy the APE tag of another file, tags given override its items\n");
+	LOG("   --strip                  - Remove the last APE tag from the file(s) instead of adding one\n");
+	LOG("   --migrate                - Rewrite APEv1 and stacked APE tags as a single APEv2 tag\n");
+	LOG("   --memory=<MiB>           - Budget for the tag buffers in flight, larger tags are streamed\n");
+	LOG("   --cache=<MiB>            - Size of the cache for the files of binary items (default: 64)\n");
+	LOG("   --log-level=<level>      - Messages to write: quiet (errors), summary (default) or verbose\n");
+	LOG("   --log-format=<format>    - Format of the messages: text (default) or json, one per line\n");
+	LOG("   --verify                 - Flush the file(s) and read the tags at the end back for checking\n");
+	LOG("   --index=<file>           - Build or refresh a library index of the files in \"@<manifest>\"\n");
+	LOG("   --query=<file>           - Print the files of the index that match all conditions given\n");
+	LOG("\n");
+	LOG("Manifest files contain one file per line, optionally followed by TAB-separated\n");
+	LOG("\"key=value\" items that apply to this file only.\n");
+	LOG("In watch mode, a sidecar file \"<file>.tags\" with one \"key=value\" item per line\n");
+	LOG("takes precedence over the rules file.\n");
+	LOG("Query conditions are \"key=value\", \"key\" (file has the key) or \"!key\" (file lacks it).\n");
+	LOG("\n");
 	LOG("Supported tag types:\n");
-	LOG("   APE2 - APE Tag, version 2 (only type currently supported)\n");
+	LOG("   APE2  - APE Tag, version 2 (appended to the file)\n");
+	LOG("   FLAC  - FLAC Vorbis comment (updated in place, if padding permits)\n");
+	LOG("   MP4   - MP4/M4A iTunes-style metadata (updated in place, if free atoms permit)\n");
+	LOG("   OGG   - Ogg Vorbis/Opus comment header (updated in place, if padding permits)\n");
+	LOG("   ID3V1 - ID3 Tag, version 1.1 (replaces an existing ID3v1 tag)\n");
+	LOG("   ID3V2 - ID3 Tag, version 2.4 (updated in place, if padding permits)\n");
+	LOG("APE2, ID3V1 and ID3V2 may be combined, e.g. \"APE2+ID3V1+ID3V2\", to write all in one pass.\n");
 	LOG("\n");
 	LOG("Supported keys:\n");
 	for(int i = 0; g_tagSpec[i].key; i++)
 	{
-		LOG("   %-15s - %s <%s>\n", g_tagSpec[i].key, g_tagSpec[i].info, type2string(g_tagSpec[i].type));
+		LOG("   %-21s - %s <%s>\n", g_tagSpec[i].key, g_tagSpec[i].info, type2string(g_tagSpec[i].type));
 	}
 	LOG("\n");
 	LOG("Example:\n");
 	LOG("   tag.exe APE2 \"C:\\My Folder\\File.mp3\" \"Artist=John Doe\"\n");
+	LOG("   lame.exe input.wav - | tag.exe APE2 - \"Artist=John Doe\" > output.mp3\n");
 	LOG("\n");
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+//Parses a list of tag types, separated by '+' or ','
+static bool parse_formats(const char *types, unsigned int &formats)
+{
+	static const struct
+	{
+		const char *name;
+		TagFormat format;
+	}
+	FORMAT_NAMES[] =
+	{
+		{ "APE2",  TAG_FORMAT_APE2  },
+		{ "FLAC",  TAG_FORMAT_FLAC  },
+		{ "MP4",   TAG_FORMAT_MP4   },
+		{ "OGG",   TAG_FORMAT_OGG   },
+		{ "ID3V1", TAG_FORMAT_ID3V1 },
+		{ "ID3V2", TAG_FORMAT_ID3V2 },
+		{ NULL, ((TagFormat)0) }
+	};
+
+	formats = 0;
+	const char *pos = types;
+	while(*pos)
+	{
+		const size_t len = strcspn(pos, "+,");
+		bool found = false;
+		for(int i = 0; FORMAT_NAMES[i].name; i++)
+		{
+			if((strlen(FORMAT_NAMES[i].name) == len) && (_strnicmp(pos, FORMAT_NAMES[i].name, len) == 0))
+			{
+				formats |= FORMAT_NAMES[i].format;
+				found = true;
+			}
+		}
+		if(!found)
+		{
+			return false;
+		}
+		pos += len;
+		pos += (*pos) ? 1 : 0;
+	}
+
+	return (formats != 0);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Main function
 ///////////////////////////////////////////////////////////////////////////////
 
 static int tag_main(int argc, char* argv[])
 {
-	LOG("\nSimple Tag Creator v%u.%02u [%s]\n", TAG_VERSION_MAJOR, TAG_VERSION_MINOR, __DATE__);
-	LOG("Copyright (c) 2004-2013 LoRd_MuldeR <mulder2@gmx.de>. Some rights reserved.\n\n");
-	
-	LOG("This program is free software; you can redistribute it and/or modify\n");
-	LOG("it under the terms of the GNU General Public License <http://www.gnu.org/>.\n");
-	LOG("Note that this program is distributed with ABSOLUTELY NO WARRANTY.\n\n");
+	TagOptions options;
+	const int firstArg = TagParser::parseOptions(argc, argv, options);
+	if(firstArg < 0)
+	{
+		return 1;
+	}
+
+	//The banner is written once the log level is known
+	Log::setLevel(options.logLevel);
+	Log::setFormat(options.logFormat);
+
+	LOG_VERBOSE("\nSimple Tag Creator v%u.%02u [%s]\n", TAG_VERSION_MAJOR, TAG_VERSION_MINOR, __DATE__);
+	LOG_VERBOSE("Copyright (c) 2004-2013 LoRd_MuldeR <mulder2@gmx.de>. Some rights reserved.\n\n");
+
+	LOG_VERBOSE("This program is free software; you can redistribute it and/or modify\n");
+	LOG_VERBOSE("it under the terms of the GNU General Public License <http://www.gnu.org/>.\n");
+	LOG_VERBOSE("Note that this program is distributed with ABSOLUTELY NO WARRANTY.\n\n");
+
+	//Skip the options, so that argv[1] is the tag type again
+	argc -= (firstArg - 1);
+	argv += (firstArg - 1);
+
+	//The library index works on its own arguments: a manifest, or the query conditions
+	if(options.index || options.query)
+	{
+		if(options.index && options.query)
+		{
+			LOG("An index cannot be built and queried at the same time!\n\n");
+			return 1;
+		}
+		if(options.query)
+		{
+			LOG_SUMMARY("Querying library index:\n%s\n\n", options.query);
+			return LibraryIndex::run(options.query, argc - 1, &argv[1]) ? 0 : 1;
+		}
+		if((argc != 2) || (argv[1][0] != '@'))
+		{
+			LOG("Building an index requires a manifest \"@<manifest>\" and no other arguments!\n\n");
+			return 1;
+		}
+		LOG_SUMMARY("Indexing files from manifest:\n%s\n\n", &argv[1][1]);
+		const unsigned int cpus = std::thread::hardware_concurrency();
+		return LibraryIndex::update(options.index, &argv[1][1], (cpus > 0) ? cpus : 1) ? 0 : 1;
+	}
 
 	if(argc < 3)
 	{
@@ -95,42 +227,157 @@ static int tag_main(int argc, char* argv[])
 		return 1;
 	}
 
-	if(_stricmp(argv[1], "APE2") != 0)
+	if(!parse_formats(argv[1], options.formats))
 	{
 		LOG("Unknown tag type:\n%s\n\n", argv[1]);
 		return 1;
 	}
 
+	//Container formats have their own tag, which cannot be combined with others
+	if((options.formats & TAG_FORMATS_CONTAINER) && (options.formats != TAG_FORMAT_FLAC) && (options.formats != TAG_FORMAT_MP4) && (options.formats != TAG_FORMAT_OGG))
+	{
+		LOG("The FLAC, MP4 and OGG tag types cannot be combined with other tag types!\n\n");
+		return 1;
+	}
+
+	BinaryCache::setLimit(options.cacheLimit);
+
 	std::vector<TagItem*> tagItems;
-	if(!TagParser::parse(argc, argv, tagItems))
+	if(!TagParser::parse(argc, argv, tagItems, options.normalize))
 	{
 		LOG("Failed to parse tag specification, invalid input!\n\n");
 		return 1;
 	}
 
-	if(tagItems.size() < 1)
+	//The FLAC, MP4 and Ogg writers modify the payload region, so the checksum would not hold
+	if(options.checksum && ((options.formats & TAG_FORMATS_CONTAINER) || (!(options.formats & TAG_FORMAT_APE2))))
 	{
-		LOG("No tags have been specified. Need to specify at least one tag!\n\n");
+		LOG("Payload checksum is only supported for the APE2 tag type!\n\n");
 		return 1;
 	}
 
-	FILE *file = fopen_utf8(argv[2], "ab");
+	//Binary items are only stored in APE tags, the other tag types would silently drop them
+	for(std::vector<TagItem*>::const_iterator iter = tagItems.cbegin(); iter != tagItems.cend(); iter++)
+	{
+		if(((*iter)->getTagData()->type() == TAG_TYPE_BINARY) && (!(options.formats & TAG_FORMAT_APE2)))
+		{
+			LOG("Binary items are only supported for the APE2 tag type!\n\n");
+			return 1;
+		}
+	}
 
-	if(!file)
+	//In batch mode, the items may also be specified per file
+	const bool isBatch = (argv[2][0] == '@');
+
+	if((!isBatch) && (options.journal || (options.shardCount > 1) || options.physicalOrder))
 	{
-		LOG("Failed to open file for appending:\n%s\n\nInvalid file specified or access denied!\n\n", argv[2]);
+		LOG("Sharding, journal and physical ordering are only supported in batch mode!\n\n");
 		return 1;
 	}
 
-	LOG("Writing tags to media file:\n%s\n\n", argv[2]);
+	if((!isBatch) && options.memoryLimit)
+	{
+		LOG("A memory budget is only supported in batch mode!\n\n");
+		return 1;
+	}
 
-	if(!ApeTagger::writeTags(file, tagItems))
+	if(options.watch && (isBatch || (strcmp(argv[2], "-") == 0) || options.replayGain))
 	{
-		LOG("An error occurred while trying to write tags to file!\n\n");
-		fclose(file);
+		LOG("Watch mode requires a directory and does not support ReplayGain!\n\n");
 		return 1;
 	}
 
+	if(options.rules && (!options.watch))
+	{
+		LOG("Rules files are only supported in watch mode!\n\n");
+		return 1;
+	}
+
+	if(options.copyFrom && ((options.formats != TAG_FORMAT_APE2) || isBatch || options.watch || (strcmp(argv[2], "-") == 0)))
+	{
+		LOG("Copying a tag is only supported for a single file and the APE2 tag type!\n\n");
+		return 1;
+	}
+
+	if(options.strip && ((options.formats != TAG_FORMAT_APE2) || options.watch || options.copyFrom || options.replayGain || options.checksum || (strcmp(argv[2], "-") == 0) || (!tagItems.empty())))
+	{
+		LOG("Stripping is only supported for the APE2 tag type, without any tags or other modes!\n\n");
+		return 1;
+	}
+
+	if(options.migrate && ((options.formats != TAG_FORMAT_APE2) || options.watch || options.strip || options.copyFrom || options.replayGain || options.checksum || options.verify || (strcmp(argv[2], "-") == 0) || (!tagItems.empty())))
+	{
+		LOG("Migration is only supported for the APE2 tag type, without any tags or other modes!\n\n");
+		return 1;
+	}
+
+	if(options.verify && ((options.formats & TAG_FORMATS_CONTAINER) || options.strip || (options.sink == SINK_MEMORY) || (strcmp(argv[2], "-") == 0)))
+	{
+		LOG("Verification is only supported for tags written to the end of a file, not in strip or filter mode!\n\n");
+		return 1;
+	}
+
+	if((tagItems.size() < 1) && (!isBatch) && (!options.watch) && (!options.copyFrom) && (!options.strip) && (!options.migrate) && (!options.replayGain) && (!options.checksum))
+	{
+		LOG("No tags have been specified. Need to specify at least one tag!\n\n");
+		return 1;
+	}
+
+	if(options.trace && (!Trace::enable(options.trace)))
+	{
+		LOG("Failed to initialize the execution trace!\n\n");
+		return 1;
+	}
+
+	bool success = false;
+
+	if(options.watch)
+	{
+		LOG_SUMMARY("Watching drop folder:\n%s\n\n", argv[2]);
+		success = Watcher::run(argv[2], tagItems, options);
+	}
+	else if(isBatch)
+	{
+		LOG_SUMMARY("Processing files from manifest:\n%s\n\n", &argv[2][1]);
+		success = Pipeline::run(&argv[2][1], tagItems, options);
+	}
+	else if(strcmp(argv[2], "-") == 0)
+	{
+		if((options.formats != TAG_FORMAT_APE2) || options.replayGain || options.checksum)
+		{
+			LOG("Filter mode is only supported for the APE2 tag type, without ReplayGain or checksum!\n\n");
+			return 1;
+		}
+
+		LOG_SUMMARY("Passing media stream from STDIN to STDOUT...\n\n");
+		success = StreamFilter::run(tagItems);
+	}
+	else
+	{
+		LOG_SUMMARY(options.strip ? "Removing tag from media file:\n%s\n\n" : (options.migrate ? "Migrating tags of media file:\n%s\n\n" : "Writing tags to media file:\n%s\n\n"), argv[2]);
+
+		TagJob job(argv[2]);
+		if(options.replayGain)
+		{
+			ReplayGain::analyzeJobs(std::vector<TagJob*>(1, &job), tagItems, 1);
+		}
+		const unsigned int cpus = std::thread::hardware_concurrency();
+		success = job.stat() && job.readTail() && ((!options.checksum) || job.checksum((cpus > 0) ? cpus : 1));
+		if(options.strip)
+		{
+			success = success && job.strip();
+		}
+		else if(options.migrate)
+		{
+			success = success && job.migrate();
+		}
+		else
+		{
+			success = success && (options.copyFrom ? job.transfer(options.copyFrom, tagItems) : job.serialize(options.formats, tagItems)) && job.write(options.formats, options.sink, tagItems);
+			success = success && ((!options.verify) || (job.sync() && job.verify(tagItems)));
+		}
+	}
+
 	while(!tagItems.empty())
 	{
 		TagItem *tmp = tagItems.back();
@@ -138,8 +385,16 @@ static int tag_main(int argc, char* argv[])
 		delete tmp; tmp = NULL;
 	}
 
-	fclose(file);
-	LOG("Tags have been written successfully.\n\n");
+	//All worker threads have terminated at this point
+	Trace::dump();
+
+	if(!success)
+	{
+		LOG("An error occurred while trying to write tags!\n\n");
+		return 1;
+	}
+
+	LOG_SUMMARY("Tags have been written successfully.\n\n");
 	return 0;
 }
 
@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "memory_budget.h"
+
+#include <mutex>
+#include <condition_variable>
+
+///////////////////////////////////////////////////////////////////////////////
+// Budget
+///////////////////////////////////////////////////////////////////////////////
+
+static struct memory_budget_t
+{
+	memory_budget_t(void)
+	:
+		limit(0), used(0), peak(0), refused(0)
+	{
+	}
+
+	std::mutex mutex;
+	std::condition_variable released;
+	uint64_t limit;
+	uint64_t used;
+	uint64_t peak;
+	unsigned int refused;
+}
+g_budget;
+
+///////////////////////////////////////////////////////////////////////////////
+// Public functions
+///////////////////////////////////////////////////////////////////////////////
+
+void MemoryBudget::setLimit(const uint64_t limit)
+{
+	std::lock_guard<std::mutex> lock(g_budget.mutex);
+	g_budget.limit = limit;
+	g_budget.released.notify_all();
+}
+
+bool MemoryBudget::acquire(const uint64_t size)
+{
+	std::unique_lock<std::mutex> lock(g_budget.mutex);
+
+	if(g_budget.limit)
+	{
+		if(size > (g_budget.limit / 2))
+		{
+			g_budget.refused++;
+			return false;
+		}
+		while(g_budget.used + size > g_budget.limit)
+		{
+			g_budget.released.wait(lock);
+		}
+	}
+
+	g_budget.used += size;
+	if(g_budget.used > g_budget.peak)
+	{
+		g_budget.peak = g_budget.used;
+	}
+	return true;
+}
+
+void MemoryBudget::release(const uint64_t size)
+{
+	std::lock_guard<std::mutex> lock(g_budget.mutex);
+	g_budget.used -= size;
+	g_budget.released.notify_all();
+}
+
+uint64_t MemoryBudget::getLimit(void)
+{
+	std::lock_guard<std::mutex> lock(g_budget.mutex);
+	return g_budget.limit;
+}
+
+uint64_t MemoryBudget::getPeak(void)
+{
+	std::lock_guard<std::mutex> lock(g_budget.mutex);
+	return g_budget.peak;
+}
+
+unsigned int MemoryBudget::getRefused(void)
+{
+	std::lock_guard<std::mutex> lock(g_budget.mutex);
+	return g_budget.refused;
+}
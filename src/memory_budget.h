@@ -0,0 +1,46 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TAG_MEMORY_BUDGET_H_INCLUDED
+#define TAG_MEMORY_BUDGET_H_INCLUDED
+
+#include <stdint.h>
+
+// Process-wide budget for the tag buffers that are in flight in a batch run.
+// A buffer is acquired before it is built and released when its job is done,
+// acquire blocks while the budget is exhausted. A request larger than half of
+// the budget is refused instead, the caller has to stream that tag, so that
+// the buffers of the remaining jobs always fit. A limit of zero means no limit,
+// the peak usage is tracked in either case.
+class MemoryBudget
+{
+public:
+	static void setLimit(const uint64_t limit);
+	static bool acquire(const uint64_t size);
+	static void release(const uint64_t size);
+
+	static uint64_t getLimit(void);
+	static uint64_t getPeak(void);
+	static unsigned int getRefused(void);
+};
+
+#endif //TAG_MEMORY_BUDGET_H_INCLUDED
@@ -0,0 +1,640 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "mp4_tag.h"
+#include "types.h"
+#include "keys.h"
+#include "utils.h"
+#include "unicode_support.h"
+#include "log.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// MP4 constants
+///////////////////////////////////////////////////////////////////////////////
+
+static const uint64_t MP4_NEW_PADDING = 4096;
+static const uint64_t MP4_MAX_MOOV    = 0x10000000;
+
+static const unsigned int MP4_DATA_IMPLICIT = 0;
+static const unsigned int MP4_DATA_UTF8     = 1;
+
+static const char *const MP4_FREEFORM_MEAN = "com.apple.iTunes";
+
+static const unsigned char MP4_HDLR_MDIR[] =
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 'm', 'd', 'i', 'r', 'a', 'p', 'p', 'l',
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// MP4 structs
+///////////////////////////////////////////////////////////////////////////////
+
+typedef struct mp4_box_t
+{
+	uint64_t offset;
+	uint64_t size;
+	uint32_t header;   //8 bytes, or 16 bytes if a 64-Bit size follows the type
+	char type[4];
+}
+mp4_box_t;
+
+typedef struct mp4_atom_t
+{
+	char type[4];
+	bool container;
+	bool terminated;                   //container ends with a 32-Bit zero word, as written by QuickTime and iTunes
+	std::vector<unsigned char> data;   //payload of leaf atoms, version/flags prefix of containers
+	std::vector<struct mp4_atom_t> children;
+}
+mp4_atom_t;
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+inline static unsigned int read_uint32_be(const unsigned char *src)
+{
+	return (((unsigned int)src[0]) << 24) | (((unsigned int)src[1]) << 16) | (((unsigned int)src[2]) << 8) | ((unsigned int)src[3]);
+}
+
+inline static uint64_t read_uint64_be(const unsigned char *src)
+{
+	return (((uint64_t)read_uint32_be(&src[0])) << 32) | ((uint64_t)read_uint32_be(&src[4]));
+}
+
+inline static void write_uint32_be(unsigned char *dest, const unsigned int value)
+{
+	dest[0] = (unsigned char)((value >> 24) & 0xFF);
+	dest[1] = (unsigned char)((value >> 16) & 0xFF);
+	dest[2] = (unsigned char)((value >>  8) & 0xFF);
+	dest[3] = (unsigned char)((value >>  0) & 0xFF);
+}
+
+inline static void write_uint64_be(unsigned char *dest, const uint64_t value)
+{
+	write_uint32_be(&dest[0], (unsigned int)(value >> 32));
+	write_uint32_be(&dest[4], (unsigned int)(value & 0xFFFFFFFF));
+}
+
+inline static void append_uint32_be(std::vector<unsigned char> &dest, const unsigned int value)
+{
+	dest.resize(dest.size() + 4);
+	write_uint32_be(&dest[dest.size() - 4], value);
+}
+
+inline static void append_nbytes(std::vector<unsigned char> &dest, const void *data, const size_t len)
+{
+	dest.insert(dest.end(), ((const unsigned char*)data), ((const unsigned char*)data) + len);
+}
+
+inline static void append_child(std::vector<unsigned char> &dest, const char *type, const std::vector<unsigned char> &content)
+{
+	append_uint32_be(dest, content.size() + 8);
+	append_nbytes(dest, type, 4);
+	append_nbytes(dest, content.data(), content.size());
+}
+
+inline static bool is_type(const char *type, const char *str)
+{
+	return (memcmp(type, str, 4) == 0);
+}
+
+inline static bool is_container(const char *type)
+{
+	static const char *const containers[] = { "moov", "trak", "mdia", "minf", "stbl", "udta", "meta", "ilst", NULL };
+	for(int i = 0; containers[i]; i++)
+	{
+		if(is_type(type, containers[i])) return true;
+	}
+	return false;
+}
+
+inline static bool is_padding(const char *type)
+{
+	return is_type(type, "free") || is_type(type, "skip");
+}
+
+static const char *mp4_atom(const char *key, const char **freeform)
+{
+	for(int i = 0; g_tagSpec[i].key; i++)
+	{
+		if(strcmp(key, g_tagSpec[i].key) == 0)
+		{
+			*freeform = g_tagSpec[i].vorbis;
+			return g_tagSpec[i].mp4;
+		}
+	}
+	throw std::runtime_error("Key has no MP4 mapping!");
+}
+
+static std::string freeform_name(const std::vector<unsigned char> &payload)
+{
+	size_t pos = 0;
+	while(pos + 8 <= payload.size())
+	{
+		const size_t size = read_uint32_be(&payload[pos]);
+		if((size < 8) || (pos + size > payload.size()))
+		{
+			break;
+		}
+		if(is_type((const char*) &payload[pos + 4], "name") && (size >= 12))
+		{
+			return std::string(((const char*) &payload[pos + 12]), size - 12);
+		}
+		pos += size;
+	}
+	return std::string();
+}
+
+static mp4_atom_t *find_child(std::vector<mp4_atom_t> &children, const char *type)
+{
+	for(std::vector<mp4_atom_t>::iterator iter = children.begin(); iter != children.end(); iter++)
+	{
+		if(is_type(iter->type, type)) return &(*iter);
+	}
+	return NULL;
+}
+
+static mp4_atom_t make_atom(const char *type, const bool container)
+{
+	mp4_atom_t atom;
+	memcpy(atom.type, type, 4);
+	atom.container = container;
+	atom.terminated = false;
+	return atom;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// MP4 Tagger
+///////////////////////////////////////////////////////////////////////////////
+
+bool Mp4Tagger::writeTags(const char *fileName, const std::vector<TagItem*> &items)
+{
+	FILE *file = fopen_utf8(fileName, "r+b");
+	if(!file)
+	{
+		LOG("File operation has failed:\nUnable to open the MP4 file for update!\n\n");
+		return false;
+	}
+
+	//Walk the top-level atoms, media data is never read
+	uint64_t fileSize = 0;
+	std::vector<mp4_box_t> boxes;
+	if((!get_file_size(file, fileSize)) || (!readBoxes(file, fileSize, boxes)))
+	{
+		LOG("File operation has failed:\nThe file is not a valid MP4 file!\n\n");
+		fclose(file);
+		return false;
+	}
+
+	size_t moovIdx = SIZE_MAX;
+	for(size_t i = 0; i < boxes.size(); i++)
+	{
+		if(is_type(boxes[i].type, "moov"))
+		{
+			moovIdx = i;
+			break;
+		}
+	}
+	if((moovIdx == SIZE_MAX) || (boxes[moovIdx].size > MP4_MAX_MOOV))
+	{
+		LOG("File operation has failed:\nThe file does not contain a usable 'moov' atom!\n\n");
+		fclose(file);
+		return false;
+	}
+
+	//Load and parse the movie atom
+	const mp4_box_t &box = boxes[moovIdx];
+	std::vector<unsigned char> buffer((size_t)(box.size - box.header));
+	mp4_atom_t moov = make_atom("moov", true);
+	if((_fseeki64(file, box.offset + box.header, SEEK_SET) != 0) || (fread(buffer.data(), sizeof(unsigned char), buffer.size(), file) != buffer.size()) || (!parseAtoms(buffer.data(), buffer.size(), moov.children, moov.terminated)))
+	{
+		LOG("File operation has failed:\nThe 'moov' atom is malformed!\n\n");
+		fclose(file);
+		return false;
+	}
+
+	updateItemList(moov, items);
+	LOG_VERBOSE("\n");
+
+	//Absorb the neighbouring free atoms
+	size_t first = moovIdx, last = moovIdx;
+	while((first > 0) && is_padding(boxes[first - 1].type)) first--;
+	while((last + 1 < boxes.size()) && is_padding(boxes[last + 1].type)) last++;
+
+	const uint64_t spanStart = boxes[first].offset;
+	const uint64_t spanEnd   = boxes[last].offset + boxes[last].size;
+	const uint64_t spanSize  = spanEnd - spanStart;
+	const uint64_t newSize   = atomSize(moov);
+	const bool     atEnd     = (spanEnd >= fileSize);
+
+	if(atEnd || (newSize == spanSize) || (newSize + 8 <= spanSize))
+	{
+		buffer.clear();
+		serializeAtom(moov, buffer);
+		if((!atEnd) && (newSize < spanSize))
+		{
+			const mp4_atom_t padding = make_atom("free", false);
+			const size_t paddingStart = buffer.size();
+			serializeAtom(padding, buffer);
+			buffer.resize((size_t) spanSize, 0x00);
+			write_uint32_be(&buffer[paddingStart], (unsigned int)(spanSize - newSize));
+		}
+
+		bool success = (_fseeki64(file, spanStart, SEEK_SET) == 0);
+		success = success && (fwrite(buffer.data(), sizeof(unsigned char), buffer.size(), file) == buffer.size());
+		success = success && (fflush(file) == 0);
+		if(success && atEnd)
+		{
+			success = (_chsize_s(_fileno(file), spanStart + buffer.size()) == 0);
+		}
+		success = (fclose(file) == 0) && success;
+
+		if(!success)
+		{
+			LOG("File operation has failed:\nUnable to update the 'moov' atom in place!\n\n");
+		}
+		return success;
+	}
+
+	//Free atoms are exhausted, so the 'moov' atom needs to be relocated
+	for(size_t i = 0; i < boxes.size(); i++)
+	{
+		if(is_type(boxes[i].type, "moof"))
+		{
+			LOG("File operation has failed:\nCannot relocate the 'moov' atom of a fragmented MP4 file!\n\n");
+			fclose(file);
+			return false;
+		}
+	}
+
+	LOG_VERBOSE("Not enough free space available, re-writing the complete file!\n\n");
+
+	const std::string tempName = std::string(fileName) + ".tmp";
+	const bool success = relocate(tempName.c_str(), file, fileSize, spanStart, spanEnd, moov);
+	fclose(file);
+
+	if(!success)
+	{
+		unlink_utf8(tempName.c_str());
+		return false;
+	}
+	if(rename_utf8(tempName.c_str(), fileName) != 0)
+	{
+		LOG("File operation has failed:\nUnable to replace the original file!\n\n");
+		unlink_utf8(tempName.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+bool Mp4Tagger::readBoxes(FILE *file, const uint64_t fileSize, std::vector<mp4_box_t> &boxes)
+{
+	unsigned char header[16];
+	uint64_t offset = 0;
+
+	while(offset < fileSize)
+	{
+		if((fileSize - offset < 8) || (_fseeki64(file, offset, SEEK_SET) != 0) || (fread(header, sizeof(unsigned char), 8, file) != 8))
+		{
+			return false;
+		}
+
+		mp4_box_t box;
+		box.offset = offset;
+		box.size = read_uint32_be(&header[0]);
+		box.header = 8;
+		memcpy(box.type, &header[4], 4);
+
+		if(box.size == 1)
+		{
+			if(fread(&header[8], sizeof(unsigned char), 8, file) != 8)
+			{
+				return false;
+			}
+			box.size = read_uint64_be(&header[8]);
+			box.header = 16;
+		}
+		else if(box.size == 0)
+		{
+			box.size = fileSize - offset;
+		}
+
+		if((box.size < box.header) || (box.size > fileSize - offset))
+		{
+			return false;
+		}
+
+		boxes.push_back(box);
+		offset += box.size;
+	}
+
+	return (!boxes.empty());
+}
+
+bool Mp4Tagger::parseAtoms(const unsigned char *data, const size_t len, std::vector<mp4_atom_t> &atoms, bool &terminated)
+{
+	size_t pos = 0;
+	terminated = false;
+	while(pos < len)
+	{
+		if((len - pos == 4) && (read_uint32_be(&data[pos]) == 0))
+		{
+			terminated = true; /*kept, so that it is written back*/
+			break;
+		}
+		if(len - pos < 8)
+		{
+			return false;
+		}
+
+		uint64_t size = read_uint32_be(&data[pos]);
+		size_t headerSize = 8;
+		if(size == 1)
+		{
+			if(len - pos < 16) return false;
+			size = read_uint64_be(&data[pos + 8]);
+			headerSize = 16;
+		}
+		else if(size == 0)
+		{
+			size = len - pos;
+		}
+		if((size < headerSize) || (size > len - pos))
+		{
+			return false;
+		}
+
+		mp4_atom_t atom = make_atom((const char*) &data[pos + 4], is_container((const char*) &data[pos + 4]));
+		const unsigned char *payload = &data[pos + headerSize];
+		size_t payloadSize = (size_t)(size - headerSize);
+
+		if(atom.container)
+		{
+			//The 'meta' atom is a full box, except for the QuickTime flavour that has no version/flags
+			if(is_type(atom.type, "meta") && (!((payloadSize >= 8) && is_type((const char*) &payload[4], "hdlr"))))
+			{
+				if(payloadSize < 4) return false;
+				atom.data.assign(payload, payload + 4);
+				payload += 4; payloadSize -= 4;
+			}
+			if(!parseAtoms(payload, payloadSize, atom.children, atom.terminated))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			atom.data.assign(payload, payload + payloadSize);
+		}
+
+		atoms.push_back(atom);
+		pos += (size_t) size;
+	}
+
+	return true;
+}
+
+uint64_t Mp4Tagger::atomSize(const mp4_atom_t &atom)
+{
+	uint64_t size = 8 + atom.data.size() + (atom.terminated ? 4 : 0);
+	for(std::vector<mp4_atom_t>::const_iterator iter = atom.children.cbegin(); iter != atom.children.cend(); iter++)
+	{
+		size += atomSize(*iter);
+	}
+	return (size > 0xFFFFFFFF) ? (size + 8) : size;
+}
+
+void Mp4Tagger::serializeAtom(const mp4_atom_t &atom, std::vector<unsigned char> &dest)
+{
+	const uint64_t size = atomSize(atom);
+	const size_t start = dest.size();
+
+	if(size > 0xFFFFFFFF)
+	{
+		dest.resize(start + 16);
+		write_uint32_be(&dest[start], 1);
+		memcpy(&dest[start + 4], atom.type, 4);
+		write_uint64_be(&dest[start + 8], size);
+	}
+	else
+	{
+		dest.resize(start + 8);
+		write_uint32_be(&dest[start], (unsigned int) size);
+		memcpy(&dest[start + 4], atom.type, 4);
+	}
+
+	append_nbytes(dest, atom.data.data(), atom.data.size());
+	for(std::vector<mp4_atom_t>::const_iterator iter = atom.children.cbegin(); iter != atom.children.cend(); iter++)
+	{
+		serializeAtom(*iter, dest);
+	}
+	if(atom.terminated)
+	{
+		dest.resize(dest.size() + 4, 0x00);
+	}
+}
+
+void Mp4Tagger::updateItemList(mp4_atom_t &moov, const std::vector<TagItem*> &items)
+{
+	//Locate (or create) the udta/meta/ilst chain
+	if(!find_child(moov.children, "udta"))
+	{
+		moov.children.push_back(make_atom("udta", true));
+	}
+	mp4_atom_t *udta = find_child(moov.children, "udta");
+
+	if(!find_child(udta->children, "meta"))
+	{
+		mp4_atom_t meta = make_atom("meta", true);
+		meta.data.resize(4, 0x00);
+		mp4_atom_t hdlr = make_atom("hdlr", false);
+		hdlr.data.assign(MP4_HDLR_MDIR, MP4_HDLR_MDIR + sizeof(MP4_HDLR_MDIR));
+		meta.children.push_back(hdlr);
+		udta->children.push_back(meta);
+	}
+	mp4_atom_t *meta = find_child(udta->children, "meta");
+
+	if(!find_child(meta->children, "ilst"))
+	{
+		meta->children.push_back(make_atom("ilst", true));
+	}
+
+	//Padding inside of 'meta' is merged into the top-level free space
+	for(std::vector<mp4_atom_t>::iterator iter = meta->children.begin(); iter != meta->children.end();)
+	{
+		iter = is_padding(iter->type) ? meta->children.erase(iter) : (iter + 1);
+	}
+	mp4_atom_t *ilst = find_child(meta->children, "ilst");
+
+	char tempBuffer[ITEM_BUFFER_SIZE];
+	for(std::vector<TagItem*>::const_iterator item = items.cbegin(); item != items.cend(); item++)
+	{
+		if((*item)->getTagData()->type() == TAG_TYPE_BINARY)
+		{
+			continue; /*binary items are only stored in APE tags*/
+		}
+		const char *freeform = NULL;
+		const char *type = mp4_atom((*item)->getTagKey(), &freeform);
+
+		//Remove the existing value
+		for(std::vector<mp4_atom_t>::iterator iter = ilst->children.begin(); iter != ilst->children.end();)
+		{
+			const bool match = type ? is_type(iter->type, type) : (is_type(iter->type, "----") && (_stricmp(freeform_name(iter->data).c_str(), freeform) == 0));
+			iter = match ? ilst->children.erase(iter) : (iter + 1);
+		}
+
+		//Create the new value
+		const char *str = item2string(*item, tempBuffer);
+		mp4_atom_t atom = make_atom(type ? type : "----", false);
+		std::vector<unsigned char> content;
+
+		if(!type)
+		{
+			append_uint32_be(content, 0);
+			append_nbytes(content, MP4_FREEFORM_MEAN, strlen(MP4_FREEFORM_MEAN));
+			append_child(atom.data, "mean", content);
+			content.clear();
+			append_uint32_be(content, 0);
+			append_nbytes(content, freeform, strlen(freeform));
+			append_child(atom.data, "name", content);
+			content.clear();
+		}
+
+		if(is_type(atom.type, "trkn"))
+		{
+			const unsigned int track = (*item)->getTagData()->toNumber();
+			append_uint32_be(content, MP4_DATA_IMPLICIT);
+			append_uint32_be(content, 0);
+			append_uint32_be(content, track & 0xFFFF);
+			append_uint32_be(content, 0);
+		}
+		else
+		{
+			append_uint32_be(content, MP4_DATA_UTF8);
+			append_uint32_be(content, 0);
+			append_nbytes(content, str, strlen(str));
+		}
+		append_child(atom.data, "data", content);
+
+		ilst->children.push_back(atom);
+		LOG_VERBOSE("%-11s : %s\n", (*item)->getTagKey(), str);
+	}
+}
+
+bool Mp4Tagger::patchChunkOffsets(mp4_atom_t &atom, const uint64_t threshold, const int64_t delta)
+{
+	if(atom.container)
+	{
+		for(std::vector<mp4_atom_t>::iterator iter = atom.children.begin(); iter != atom.children.end(); iter++)
+		{
+			if(!patchChunkOffsets(*iter, threshold, delta))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	const bool isStco = is_type(atom.type, "stco"), isCo64 = is_type(atom.type, "co64");
+	if((!(isStco || isCo64)) || (atom.data.size() < 8))
+	{
+		return true;
+	}
+
+	const size_t entrySize = isCo64 ? 8 : 4;
+	const size_t count = read_uint32_be(&atom.data[4]);
+	if(((atom.data.size() - 8) / entrySize) < count)
+	{
+		return false;
+	}
+
+	for(size_t i = 0; i < count; i++)
+	{
+		unsigned char *const entry = &atom.data[8 + (i * entrySize)];
+		const uint64_t offset = isCo64 ? read_uint64_be(entry) : read_uint32_be(entry);
+		if(offset >= threshold)
+		{
+			const uint64_t patched = offset + delta;
+			if(isCo64)
+			{
+				write_uint64_be(entry, patched);
+			}
+			else if(patched <= 0xFFFFFFFF)
+			{
+				write_uint32_be(entry, (unsigned int) patched);
+			}
+			else
+			{
+				LOG("File operation has failed:\nChunk offset exceeds the range of the 'stco' table!\n\n");
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool Mp4Tagger::relocate(const char *tempName, FILE *file, const uint64_t fileSize, const uint64_t spanStart, const uint64_t spanEnd, mp4_atom_t &moov)
+{
+	//Media data behind the 'moov' atom is shifted, fix up the chunk offsets accordingly
+	const uint64_t newSpan = atomSize(moov) + 8 + MP4_NEW_PADDING;
+	if(!patchChunkOffsets(moov, spanEnd, ((int64_t) newSpan) - ((int64_t)(spanEnd - spanStart))))
+	{
+		return false;
+	}
+
+	std::vector<unsigned char> buffer;
+	serializeAtom(moov, buffer);
+	const size_t paddingStart = buffer.size();
+	serializeAtom(make_atom("free", false), buffer);
+	buffer.resize((size_t) newSpan, 0x00);
+	write_uint32_be(&buffer[paddingStart], (unsigned int)(8 + MP4_NEW_PADDING));
+
+	FILE *temp = fopen_utf8(tempName, "wb");
+	if(!temp)
+	{
+		LOG("File operation has failed:\nUnable to create temporary file!\n\n");
+		return false;
+	}
+
+	//Stream the file in one pass, replacing the 'moov' span
+	bool success = (_fseeki64(file, 0, SEEK_SET) == 0) && copy_file_data(file, temp, spanStart);
+	success = success && (fwrite(buffer.data(), sizeof(unsigned char), buffer.size(), temp) == buffer.size());
+	success = success && (_fseeki64(file, spanEnd, SEEK_SET) == 0) && copy_file_data(file, temp, fileSize - spanEnd);
+
+	success = (fclose(temp) == 0) && success;
+	if(!success)
+	{
+		LOG("File operation has failed:\nUnable to write the temporary file!\n\n");
+	}
+
+	return success;
+}
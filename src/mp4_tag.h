@@ -0,0 +1,49 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef MP4_TAGGER_H_INCLUDED
+#define MP4_TAGGER_H_INCLUDED
+
+#include <cstdio>
+#include <vector>
+#include <stdint.h>
+
+class TagItem;
+struct mp4_box_t;
+struct mp4_atom_t;
+
+class Mp4Tagger
+{
+public:
+	static bool writeTags(const char *fileName, const std::vector<TagItem*> &items);
+
+private:
+	static bool readBoxes(FILE *file, const uint64_t fileSize, std::vector<mp4_box_t> &boxes);
+	static bool parseAtoms(const unsigned char *data, const size_t len, std::vector<mp4_atom_t> &atoms, bool &terminated);
+	static void serializeAtom(const mp4_atom_t &atom, std::vector<unsigned char> &dest);
+	static uint64_t atomSize(const mp4_atom_t &atom);
+	static void updateItemList(mp4_atom_t &moov, const std::vector<TagItem*> &items);
+	static bool patchChunkOffsets(mp4_atom_t &atom, const uint64_t threshold, const int64_t delta);
+	static bool relocate(const char *tempName, FILE *file, const uint64_t fileSize, const uint64_t spanStart, const uint64_t spanEnd, mp4_atom_t &moov);
+};
+
+#endif //MP4_TAGGER_H_INCLUDED
@@ -0,0 +1,273 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "normalize.h"
+#include "normalize_tables.h"
+
+//CRT includes
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <emmintrin.h>
+
+//Const
+static const uint32_t HANGUL_S_BASE  = 0xAC00;
+static const uint32_t HANGUL_L_BASE  = 0x1100;
+static const uint32_t HANGUL_V_BASE  = 0x1161;
+static const uint32_t HANGUL_T_BASE  = 0x11A7;
+static const uint32_t HANGUL_L_COUNT = 19;
+static const uint32_t HANGUL_V_COUNT = 21;
+static const uint32_t HANGUL_T_COUNT = 28;
+static const uint32_t HANGUL_N_COUNT = HANGUL_V_COUNT * HANGUL_T_COUNT;
+static const uint32_t HANGUL_S_COUNT = HANGUL_L_COUNT * HANGUL_N_COUNT;
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+static inline const nfc_prop_t &get_prop(const uint32_t cp)
+{
+	if(cp >= NFC_TABLE_LIMIT)
+	{
+		return g_nfcProps[0];
+	}
+	const uint32_t block = g_nfcStage1[cp >> NFC_BLOCK_SHIFT];
+	return g_nfcProps[g_nfcStage2[(block << NFC_BLOCK_SHIFT) | (cp & ((1U << NFC_BLOCK_SHIFT) - 1U))]];
+}
+
+//Returns zero, if the pair has no primary composite
+static uint32_t compose_pair(const uint32_t first, const uint32_t second)
+{
+	if((first - HANGUL_L_BASE < HANGUL_L_COUNT) && (second - HANGUL_V_BASE < HANGUL_V_COUNT))
+	{
+		return HANGUL_S_BASE + ((first - HANGUL_L_BASE) * HANGUL_V_COUNT + (second - HANGUL_V_BASE)) * HANGUL_T_COUNT;
+	}
+	if((first - HANGUL_S_BASE < HANGUL_S_COUNT) && (((first - HANGUL_S_BASE) % HANGUL_T_COUNT) == 0) && (second - HANGUL_T_BASE - 1U < HANGUL_T_COUNT - 1U))
+	{
+		return first + (second - HANGUL_T_BASE);
+	}
+
+	const uint64_t pair = (((uint64_t) first) << 21) | second;
+	size_t lo = 0, hi = sizeof(g_nfcComp) / sizeof(g_nfcComp[0]);
+	while(lo < hi)
+	{
+		const size_t mid = (lo + hi) / 2;
+		if(g_nfcComp[mid].pair < pair) lo = mid + 1; else hi = mid;
+	}
+	return ((lo < sizeof(g_nfcComp) / sizeof(g_nfcComp[0])) && (g_nfcComp[lo].pair == pair)) ? g_nfcComp[lo].composite : 0;
+}
+
+static bool decode_utf8(const unsigned char *str, std::vector<uint32_t> &output)
+{
+	while(*str)
+	{
+		uint32_t cp = *str++;
+		size_t extra = 0;
+		if(cp >= 0xF0) { cp &= 0x07; extra = 3; }
+		else if(cp >= 0xE0) { cp &= 0x0F; extra = 2; }
+		else if(cp >= 0xC0) { cp &= 0x1F; extra = 1; }
+		else if(cp >= 0x80) { return false; }
+		for(size_t i = 0; i < extra; i++)
+		{
+			if((*str & 0xC0) != 0x80)
+			{
+				return false;
+			}
+			cp = (cp << 6) | (*str++ & 0x3F);
+		}
+		if((cp > 0x10FFFF) || ((cp >= 0xD800) && (cp <= 0xDFFF)))
+		{
+			return false;
+		}
+		output.push_back(cp);
+	}
+	return true;
+}
+
+static void encode_utf8(const std::vector<uint32_t> &input, std::vector<char> &output)
+{
+	for(std::vector<uint32_t>::const_iterator iter = input.cbegin(); iter != input.cend(); iter++)
+	{
+		const uint32_t cp = *iter;
+		if(cp < 0x80)
+		{
+			output.push_back((char) cp);
+		}
+		else if(cp < 0x800)
+		{
+			output.push_back((char)(0xC0 | (cp >> 6)));
+			output.push_back((char)(0x80 | (cp & 0x3F)));
+		}
+		else if(cp < 0x10000)
+		{
+			output.push_back((char)(0xE0 | (cp >> 12)));
+			output.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+			output.push_back((char)(0x80 | (cp & 0x3F)));
+		}
+		else
+		{
+			output.push_back((char)(0xF0 | (cp >> 18)));
+			output.push_back((char)(0x80 | ((cp >> 12) & 0x3F)));
+			output.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+			output.push_back((char)(0x80 | (cp & 0x3F)));
+		}
+	}
+	output.push_back('\0');
+}
+
+static void decompose(const std::vector<uint32_t> &input, std::vector<uint32_t> &output)
+{
+	for(std::vector<uint32_t>::const_iterator iter = input.cbegin(); iter != input.cend(); iter++)
+	{
+		const uint32_t cp = *iter;
+		if(cp - HANGUL_S_BASE < HANGUL_S_COUNT)
+		{
+			const uint32_t index = cp - HANGUL_S_BASE;
+			output.push_back(HANGUL_L_BASE + index / HANGUL_N_COUNT);
+			output.push_back(HANGUL_V_BASE + (index % HANGUL_N_COUNT) / HANGUL_T_COUNT);
+			if(index % HANGUL_T_COUNT)
+			{
+				output.push_back(HANGUL_T_BASE + index % HANGUL_T_COUNT);
+			}
+			continue;
+		}
+
+		const nfc_prop_t &prop = get_prop(cp);
+		if(prop.length)
+		{
+			output.insert(output.end(), &g_nfcDecomp[prop.offset], &g_nfcDecomp[prop.offset + prop.length]);
+		}
+		else
+		{
+			output.push_back(cp);
+		}
+	}
+}
+
+//Stable insertion sort of each run of non-starters by combining class
+static void reorder(std::vector<uint32_t> &str)
+{
+	for(size_t i = 1; i < str.size(); i++)
+	{
+		const uint32_t cp = str[i];
+		const uint8_t ccc = get_prop(cp).ccc;
+		if(ccc == 0)
+		{
+			continue;
+		}
+		size_t j = i;
+		while((j > 0) && (get_prop(str[j - 1]).ccc > ccc))
+		{
+			str[j] = str[j - 1];
+			j--;
+		}
+		str[j] = cp;
+	}
+}
+
+static void compose(std::vector<uint32_t> &str)
+{
+	if(str.empty())
+	{
+		return;
+	}
+
+	size_t starter = 0, out = 1;
+	uint8_t lastCcc = get_prop(str[0]).ccc;
+	bool haveStarter = (lastCcc == 0);
+
+	for(size_t i = 1; i < str.size(); i++)
+	{
+		const uint32_t cp = str[i];
+		const uint8_t ccc = get_prop(cp).ccc;
+
+		//A character is blocked from the starter by an intervening character of the same or higher class
+		const bool blocked = (out - 1 != starter) && ((lastCcc == 0) || (lastCcc >= ccc));
+		if(haveStarter && (!blocked))
+		{
+			const uint32_t composite = compose_pair(str[starter], cp);
+			if(composite)
+			{
+				str[starter] = composite;
+				continue;
+			}
+		}
+
+		if(ccc == 0)
+		{
+			starter = out;
+			haveStarter = true;
+		}
+		lastCcc = ccc;
+		str[out++] = cp;
+	}
+
+	str.resize(out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Normalizer
+///////////////////////////////////////////////////////////////////////////////
+
+bool Normalizer::isAscii(const char *input, const size_t length)
+{
+	size_t pos = 0;
+	for(; pos + 16 <= length; pos += 16)
+	{
+		if(_mm_movemask_epi8(_mm_loadu_si128((const __m128i*) &input[pos])))
+		{
+			return false;
+		}
+	}
+	unsigned char bits = 0;
+	for(; pos < length; pos++)
+	{
+		bits |= (unsigned char) input[pos];
+	}
+	return (bits < 0x80);
+}
+
+//Returns a copy of the input in NFC; invalid UTF-8 is copied unchanged
+char *Normalizer::toNFC(const char *input)
+{
+	const size_t length = strlen(input);
+	if(isAscii(input, length))
+	{
+		return _strdup(input);
+	}
+
+	std::vector<uint32_t> codePoints, decomposed;
+	if(!decode_utf8((const unsigned char*) input, codePoints))
+	{
+		return _strdup(input);
+	}
+	decomposed.reserve(codePoints.size() * 2);
+
+	decompose(codePoints, decomposed);
+	reorder(decomposed);
+	compose(decomposed);
+
+	std::vector<char> output;
+	output.reserve(length + 1);
+	encode_utf8(decomposed, output);
+	return _strdup(output.data());
+}
@@ -0,0 +1,37 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TAG_NORMALIZE_H_INCLUDED
+#define TAG_NORMALIZE_H_INCLUDED
+
+#include <cstddef>
+
+// Unicode normalization form C (canonical composition) of UTF-8 strings.
+// Pure ASCII input is detected up front and returned without further work.
+class Normalizer
+{
+public:
+	static char *toNFC(const char *input);
+	static bool isAscii(const char *input, const size_t length);
+};
+
+#endif //TAG_NORMALIZE_H_INCLUDED
@@ -0,0 +1,1909 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+
+// Generated from the Unicode Character Database, version 14.0.0.
+// Only code points below U+30000 have canonical properties, Hangul syllables
+// are handled algorithmically and do not appear in these tables.
+
+#ifndef TAG_NORMALIZE_TABLES_H_INCLUDED
+#define TAG_NORMALIZE_TABLES_H_INCLUDED
+
+#include <stdint.h>
+
+static const uint32_t NFC_TABLE_LIMIT = 0x30000;
+static const uint32_t NFC_BLOCK_SHIFT = 5;
+
+// Canonical combining class and full canonical decomposition (offset and length in g_nfcDecomp)
+typedef struct
+{
+	uint8_t ccc;
+	uint8_t length;
+	uint16_t offset;
+}
+nfc_prop_t;
+
+// Two-stage lookup: g_nfcStage2[(g_nfcStage1[cp >> NFC_BLOCK_SHIFT] << NFC_BLOCK_SHIFT) + (cp & mask)]
+static const uint16_t g_nfcStage1[6144] =
+{
+	0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 0, 7, 8, 9,
+	10, 11, 0, 0, 0, 0, 0, 0, 12, 13, 14, 15, 16, 17, 18, 0,
+	19, 20, 21, 22, 23, 0, 24, 25, 0, 0, 0, 0, 26, 27, 28, 0,
+	29, 30, 31, 32, 0, 0, 33, 34, 35, 36, 37, 0, 0, 0, 0, 38,
+	39, 40, 41, 0, 42, 0, 43, 44, 0, 45, 46, 0, 0, 47, 48, 49,
+	0, 50, 51, 0, 0, 47, 52, 0, 0, 47, 53, 0, 54, 0, 55, 0,
+	0, 47, 56, 0, 0, 47, 57, 0, 0, 58, 59, 0, 0, 0, 60, 0,
+	0, 61, 62, 0, 0, 63, 64, 0, 65, 66, 67, 68, 69, 70, 71, 0,
+	0, 72, 0, 0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 75, 76, 0, 0, 0, 0, 77, 0,
+	0, 0, 0, 0, 0, 78, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0,
+	80, 0, 0, 81, 0, 82, 83, 0, 84, 85, 86, 87, 0, 88, 0, 89,
+	0, 90, 0, 0, 0, 0, 91, 92, 0, 0, 0, 0, 0, 0, 93, 94,
+	95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+	111, 0, 0, 0, 0, 0, 112, 113, 0, 114, 0, 0, 115, 116, 117, 0,
+	118, 119, 120, 121, 122, 123, 0, 124, 0, 125, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 126, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 127, 0, 0, 0, 128, 0, 0, 0, 129,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 130, 131, 132, 133, 134, 135, 136, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 137, 138, 0, 0, 139, 0, 0, 0, 0, 0, 0, 0, 0,
+	140, 141, 0, 0, 0, 0, 142, 143, 0, 144, 145, 0, 0, 146, 147, 0,
+	0, 0, 0, 0, 0, 148, 149, 150, 0, 0, 0, 0, 0, 0, 0, 52,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 151, 152, 153, 154, 155, 156, 157, 158,
+	159, 160, 161, 162, 163, 164, 165, 0, 166, 167, 168, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170,
+	0, 0, 0, 0, 0, 0, 0, 171, 0, 0, 0, 172, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	173, 174, 0, 0, 0, 0, 0, 175, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 176, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 177, 0, 0, 0, 0, 178, 0, 179, 0, 0, 0,
+	0, 0, 140, 180, 181, 182, 0, 0, 183, 184, 0, 146, 0, 0, 185, 0,
+	0, 186, 0, 0, 0, 0, 0, 187, 0, 188, 189, 190, 0, 0, 0, 0,
+	0, 0, 191, 0, 0, 192, 193, 0, 0, 0, 0, 0, 0, 194, 195, 0,
+	0, 128, 0, 0, 0, 196, 0, 0, 0, 197, 0, 0, 0, 0, 0, 0,
+	0, 198, 0, 0, 0, 0, 0, 0, 0, 199, 200, 0, 0, 0, 0, 147,
+	0, 76, 201, 0, 202, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 203, 0, 204, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 205, 0, 206, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 207,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 208, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 210, 211, 212, 213, 0,
+	0, 0, 214, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	215, 216, 0, 0, 0, 0, 0, 0, 0, 206, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 217, 0, 218, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 219, 0, 0, 0, 220, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236,
+	237, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const uint16_t g_nfcStage2[7616] =
+{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 2, 3, 4, 5, 6, 0, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	0, 16, 17, 18, 19, 20, 21, 0, 0, 22, 23, 24, 25, 26, 0, 0,
+	27, 28, 29, 30, 31, 32, 0, 33, 34, 35, 36, 37, 38, 39, 40, 41,
+	0, 42, 43, 44, 45, 46, 47, 0, 0, 48, 49, 50, 51, 52, 0, 53,
+	54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+	0, 0, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+	84, 85, 86, 87, 88, 89, 0, 0, 90, 91, 92, 93, 94, 95, 96, 97,
+	98, 0, 0, 0, 99, 100, 101, 102, 0, 103, 104, 105, 106, 107, 108, 0,
+	0, 0, 0, 109, 110, 111, 112, 113, 114, 0, 0, 0, 115, 116, 117, 118,
+	119, 120, 0, 0, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+	133, 134, 135, 136, 137, 138, 0, 0, 139, 140, 141, 142, 143, 144, 145, 146,
+	147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 0,
+	162, 163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 164,
+	165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 166, 167, 168,
+	169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 0, 182, 183,
+	184, 185, 186, 187, 0, 0, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197,
+	198, 0, 0, 0, 199, 200, 0, 0, 201, 202, 203, 204, 205, 206, 207, 208,
+	209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
+	225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 0, 0, 237, 238,
+	0, 0, 0, 0, 0, 0, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248,
+	249, 250, 251, 252, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 254, 255, 255, 255, 255, 254, 256, 255, 255, 255, 255,
+	255, 257, 257, 255, 255, 255, 255, 257, 257, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 258, 258, 258, 258, 258, 255, 255, 255, 255, 253, 253, 253,
+	259, 260, 253, 261, 262, 263, 253, 255, 255, 255, 253, 253, 253, 255, 255, 0,
+	253, 253, 253, 255, 255, 255, 255, 253, 254, 255, 255, 253, 264, 265, 265, 264,
+	265, 265, 264, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	0, 0, 0, 0, 266, 0, 0, 0, 0, 0, 0, 0, 0, 0, 267, 0,
+	0, 0, 0, 0, 0, 268, 269, 270, 271, 272, 273, 0, 274, 0, 275, 276,
+	277, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 278, 279, 280, 281, 282, 283,
+	284, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 285, 286, 287, 288, 289, 0,
+	0, 0, 0, 290, 291, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	292, 293, 0, 294, 0, 0, 0, 295, 0, 0, 0, 0, 296, 297, 298, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 299, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	301, 302, 0, 303, 0, 0, 0, 304, 0, 0, 0, 0, 305, 306, 307, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 308, 309, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 253, 253, 253, 253, 253, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 310, 311, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	312, 313, 314, 315, 0, 0, 316, 317, 0, 0, 318, 319, 320, 321, 322, 323,
+	0, 0, 324, 325, 326, 327, 328, 329, 0, 0, 330, 331, 332, 333, 334, 335,
+	336, 337, 338, 339, 340, 341, 0, 0, 342, 343, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 255, 253, 253, 253, 253, 255, 253, 253, 253, 344, 255, 253, 253, 253, 253,
+	253, 253, 255, 255, 255, 255, 255, 255, 253, 253, 255, 253, 253, 344, 345, 253,
+	346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 355, 356, 357, 358, 0, 359,
+	0, 360, 361, 0, 253, 255, 0, 354, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	253, 253, 253, 253, 253, 253, 253, 253, 362, 363, 364, 0, 0, 0, 0, 0,
+	0, 0, 365, 366, 367, 368, 369, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 370, 371, 372, 362, 363,
+	364, 373, 374, 253, 253, 255, 255, 253, 253, 253, 253, 253, 255, 253, 253, 255,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	375, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	376, 0, 377, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 378, 0, 0, 253, 253, 253, 253, 253, 253, 253, 0, 0, 253,
+	253, 253, 253, 255, 253, 0, 0, 253, 253, 0, 255, 253, 253, 255, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 379, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	253, 255, 253, 253, 255, 253, 253, 255, 255, 255, 253, 255, 255, 253, 255, 253,
+	253, 253, 255, 253, 255, 253, 255, 253, 255, 253, 253, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 253, 253, 253, 253,
+	253, 253, 255, 253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 253, 253, 253, 253, 0, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 0, 253, 253, 253, 0, 253, 253, 253, 253, 253, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 253, 255, 255, 255, 253, 253, 253, 253,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 253, 253, 253, 253, 255,
+	255, 255, 255, 255, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 0, 255, 253, 253, 255, 253, 253, 255, 253, 253, 253, 255, 255, 255,
+	370, 371, 372, 253, 253, 253, 255, 253, 253, 255, 255, 253, 253, 253, 253, 253,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 0, 0, 0, 0, 0, 0,
+	0, 381, 0, 0, 382, 0, 0, 0, 0, 0, 0, 0, 383, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 0, 0,
+	0, 253, 255, 253, 253, 0, 0, 0, 385, 386, 387, 388, 389, 390, 391, 392,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 383, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 394, 384, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 395, 396, 0, 397,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 398, 0, 0, 399, 0, 0, 0, 0, 0, 383, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 400, 401, 402, 0, 0, 403, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 404, 0, 0, 405, 406, 384, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 407, 408, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 410, 411, 412, 384, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 413, 0, 0, 0, 0, 384, 0, 0,
+	0, 0, 0, 0, 0, 414, 415, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	416, 0, 0, 0, 0, 0, 0, 417, 418, 0, 419, 420, 0, 384, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 384, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 421, 422, 423, 384, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 424, 0, 425, 426, 427, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 428, 428, 384, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 429, 429, 429, 429, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 430, 430, 384, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 431, 431, 431, 431, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 255, 0, 255, 0, 256, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 432, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 0, 0,
+	0, 0, 434, 0, 0, 0, 0, 435, 0, 0, 0, 0, 436, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 437, 0, 0, 0, 0, 0, 0,
+	0, 438, 439, 440, 441, 442, 443, 0, 444, 0, 439, 439, 439, 439, 0, 0,
+	439, 445, 253, 253, 384, 0, 253, 253, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 446, 0, 0, 0, 0, 0, 0, 0, 0, 0, 447, 0, 0,
+	0, 0, 448, 0, 0, 0, 0, 449, 0, 0, 0, 0, 450, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 451, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 383, 0, 384, 384, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 253, 253,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 384, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 345, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 344, 253, 255, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 253, 255, 0, 0, 0, 0, 0, 0, 0,
+	384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 253, 253, 253, 253, 253, 253, 253, 253, 0, 0, 255,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	253, 253, 253, 253, 253, 255, 255, 255, 255, 255, 255, 253, 253, 255, 0, 255,
+	255, 253, 253, 255, 255, 253, 253, 253, 253, 253, 255, 253, 253, 253, 253, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 453, 0, 454, 0, 455, 0, 456, 0, 457, 0,
+	0, 0, 458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 383, 0, 0, 0, 0, 0, 0, 459, 0, 460, 0, 0,
+	461, 462, 0, 463, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 255, 253, 253, 253,
+	253, 253, 253, 253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 384, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 383, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 384, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 383, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	253, 253, 253, 0, 258, 255, 255, 255, 255, 255, 253, 253, 255, 255, 255, 255,
+	253, 0, 258, 258, 258, 258, 258, 258, 258, 0, 0, 0, 0, 255, 0, 0,
+	0, 0, 0, 0, 253, 0, 0, 0, 253, 253, 0, 0, 0, 0, 0, 0,
+	253, 253, 255, 253, 253, 253, 253, 253, 253, 253, 255, 253, 253, 265, 464, 255,
+	257, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 254, 345, 345, 255, 465, 253, 264, 255, 253, 255,
+	466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+	482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+	498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+	514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+	530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+	546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+	562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+	578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593,
+	594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+	610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 0, 620, 0, 0, 0, 0,
+	621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636,
+	637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652,
+	653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668,
+	669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684,
+	685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700,
+	701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 0, 0, 0, 0, 0, 0,
+	711, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726,
+	727, 728, 729, 730, 731, 732, 0, 0, 733, 734, 735, 736, 737, 738, 0, 0,
+	739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754,
+	755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770,
+	771, 772, 773, 774, 775, 776, 0, 0, 777, 778, 779, 780, 781, 782, 0, 0,
+	783, 784, 785, 786, 787, 788, 789, 790, 0, 791, 0, 792, 0, 793, 0, 794,
+	795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810,
+	811, 280, 812, 281, 813, 282, 814, 283, 815, 287, 816, 288, 817, 289, 0, 0,
+	818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 833,
+	834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849,
+	850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864, 865,
+	866, 867, 868, 869, 870, 0, 871, 872, 873, 874, 875, 269, 876, 0, 877, 0,
+	0, 878, 879, 880, 881, 0, 882, 883, 884, 271, 885, 272, 886, 887, 888, 889,
+	890, 891, 892, 277, 0, 0, 893, 894, 895, 896, 897, 273, 0, 898, 899, 900,
+	901, 902, 903, 284, 904, 905, 906, 907, 908, 909, 910, 275, 911, 912, 268, 913,
+	0, 0, 914, 915, 916, 0, 917, 918, 919, 274, 920, 276, 921, 922, 0, 0,
+	923, 924, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	253, 253, 258, 258, 253, 253, 253, 253, 258, 258, 258, 253, 253, 0, 0, 0,
+	0, 253, 0, 0, 0, 258, 258, 253, 255, 253, 258, 258, 255, 255, 255, 255,
+	253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 925, 0, 0, 0, 926, 6, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 927, 928, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 929, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 930, 931, 932,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 933, 0, 0, 0, 0, 934, 0, 0, 935, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 936, 0, 937, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 938, 0, 0, 939, 0, 0, 940, 0, 941, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	942, 0, 943, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 944, 945, 946,
+	947, 948, 0, 0, 949, 950, 0, 0, 951, 952, 0, 0, 0, 0, 0, 0,
+	953, 954, 0, 0, 955, 956, 0, 0, 957, 958, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 959, 960, 961, 962,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	963, 964, 965, 966, 0, 0, 0, 0, 0, 0, 967, 968, 969, 970, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 971, 972, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 973, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253,
+	253, 253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 384,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 345, 254, 344, 974, 974,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 975, 0, 976, 0,
+	977, 0, 978, 0, 979, 0, 980, 0, 981, 0, 982, 0, 983, 0, 984, 0,
+	985, 0, 986, 0, 0, 987, 0, 988, 0, 989, 0, 0, 0, 0, 0, 0,
+	990, 991, 0, 992, 993, 0, 994, 995, 0, 996, 997, 0, 998, 999, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1000, 0, 0, 0, 0, 1001, 1001, 0, 0, 0, 1002, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1003, 0, 1004, 0,
+	1005, 0, 1006, 0, 1007, 0, 1008, 0, 1009, 0, 1010, 0, 1011, 0, 1012, 0,
+	1013, 0, 1014, 0, 0, 1015, 0, 1016, 0, 1017, 0, 0, 0, 0, 0, 0,
+	1018, 1019, 0, 1020, 1021, 0, 1022, 1023, 0, 1024, 1025, 0, 1026, 1027, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1028, 0, 0, 1029, 1030, 1031, 1032, 0, 0, 0, 1033, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253,
+	0, 0, 0, 0, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 253,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	253, 253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 383, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	253, 0, 253, 253, 255, 0, 0, 253, 253, 0, 0, 0, 0, 0, 253, 253,
+	0, 253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048,
+	1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064,
+	1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080,
+	1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096,
+	1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112,
+	1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1053, 1125, 1126, 1127,
+	1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143,
+	1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159,
+	1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175,
+	1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191,
+	1192, 1143, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1127, 1201, 1202, 1203, 1204, 1205,
+	1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1053,
+	1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236,
+	1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1129, 1248, 1249, 1250, 1251,
+	1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267,
+	1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283,
+	1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 0, 0,
+	1298, 0, 1299, 0, 0, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 0,
+	1310, 0, 1311, 0, 0, 1312, 1313, 0, 0, 0, 1314, 1315, 1316, 1317, 1318, 1319,
+	1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335,
+	1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351,
+	1352, 1353, 1354, 1355, 1356, 1357, 1358, 1182, 1359, 1360, 1361, 1362, 1363, 1364, 1364, 1365,
+	1366, 1367, 1368, 1369, 1370, 1371, 1372, 1312, 1373, 1374, 1375, 1376, 1377, 1378, 0, 0,
+	1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1326, 1387, 1388, 1389, 1298, 1390, 1391, 1392,
+	1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1335, 1402, 1336, 1403, 1404, 1405, 1406,
+	1407, 1299, 1074, 1408, 1409, 1410, 1144, 1231, 1411, 1412, 1343, 1413, 1344, 1414, 1415, 1416,
+	1301, 1417, 1418, 1419, 1420, 1421, 1302, 1422, 1423, 1424, 1425, 1426, 1427, 1358, 1428, 1429,
+	1182, 1430, 1362, 1431, 1432, 1433, 1434, 1435, 1367, 1436, 1311, 1437, 1368, 1125, 1438, 1369,
+	1439, 1371, 1440, 1441, 1442, 1443, 1444, 1373, 1307, 1445, 1374, 1446, 1375, 1447, 1041, 1448,
+	1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1459, 1460, 1461,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1462, 1463, 1464, 1465, 1466, 1467,
+	1468, 1469, 1470, 1471, 1472, 1473, 1474, 0, 1475, 1476, 1477, 1478, 1479, 0, 1480, 0,
+	1481, 1482, 0, 1483, 1484, 0, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	253, 253, 253, 253, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 253, 253,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0,
+	255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 253, 253, 253, 253, 253, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 253,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 253, 258, 255, 0, 0, 0, 0, 384,
+	0, 0, 0, 0, 0, 253, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 253, 253, 253, 253, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 253, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 255, 255, 253, 253, 253, 255, 253, 255, 255, 255,
+	255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 253, 255, 253, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 384,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1494, 0, 1495, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1496, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 383, 0, 0, 0, 0, 0,
+	253, 253, 253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1497, 1498,
+	0, 0, 0, 384, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 383, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 384, 383, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 383, 384, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 383, 383, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1499, 1500, 384, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 253, 253, 253, 253, 253, 253, 253, 0, 0, 0,
+	253, 253, 253, 253, 253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 384, 0, 0, 0, 383, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1501, 1502, 0, 1503, 0,
+	0, 0, 384, 383, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1504, 1505, 0, 0, 0, 384,
+	383, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 384, 383, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 383, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1506, 0, 0, 0, 0, 384, 384, 0,
+	0, 0, 0, 383, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 384, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 0, 0, 0, 0, 0, 0,
+	0, 0, 383, 0, 384, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 384, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	258, 258, 258, 258, 258, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	253, 253, 253, 253, 253, 253, 253, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1507, 1507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 258, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1508, 1509,
+	1510, 1511, 1512, 1513, 1514, 256, 256, 258, 258, 258, 0, 0, 0, 1515, 256, 256,
+	256, 256, 256, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255,
+	255, 255, 255, 0, 0, 253, 253, 253, 253, 253, 255, 255, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 253, 253, 253, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1516, 1517, 1518, 1519, 1520,
+	1521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 253, 253, 253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	253, 253, 253, 253, 253, 253, 253, 0, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 0, 0, 253, 253, 253, 253, 253,
+	253, 253, 0, 253, 253, 0, 253, 253, 253, 253, 253, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 253, 253, 253,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 253, 253, 253, 253, 253, 253, 383, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1522, 1523, 1524, 1525, 1526, 1320, 1527, 1528, 1529, 1530, 1321, 1531, 1532, 1533, 1322, 1534,
+	1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1380, 1546, 1547, 1548, 1549,
+	1550, 1551, 1552, 1553, 1554, 1385, 1323, 1324, 1386, 1555, 1556, 1131, 1557, 1325, 1558, 1559,
+	1560, 1561, 1561, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573,
+	1574, 1575, 1576, 1577, 1578, 1579, 1579, 1388, 1580, 1581, 1582, 1583, 1327, 1584, 1585, 1586,
+	1284, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601,
+	1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1612, 1613, 1614, 1615, 1127,
+	1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1332, 1624, 1625, 1626, 1627, 1628, 1629, 1630,
+	1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1073, 1645,
+	1646, 1647, 1647, 1648, 1649, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659,
+	1660, 1661, 1662, 1333, 1663, 1664, 1665, 1666, 1400, 1666, 1667, 1335, 1668, 1669, 1670, 1671,
+	1336, 1046, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685,
+	1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1337, 1694, 1695, 1696, 1697, 1698, 1699, 1339,
+	1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1074, 1408, 1708, 1709, 1710, 1711, 1712, 1713,
+	1714, 1715, 1340, 1716, 1717, 1718, 1719, 1451, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727,
+	1728, 1729, 1730, 1731, 1732, 1144, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742,
+	1743, 1341, 1231, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1412, 1752, 1753, 1754, 1755,
+	1756, 1757, 1758, 1759, 1413, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770,
+	1771, 1415, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1782, 1783, 1784,
+	1417, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1130, 1792, 1793, 1794, 1795, 1796, 1797, 1798,
+	1423, 1799, 1800, 1801, 1802, 1803, 1804, 1804, 1424, 1453, 1805, 1806, 1807, 1808, 1809, 1092,
+	1426, 1810, 1811, 1352, 1812, 1813, 1306, 1814, 1815, 1356, 1816, 1817, 1818, 1819, 1819, 1820,
+	1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836,
+	1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1362, 1847, 1848, 1849, 1850, 1851,
+	1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1648, 1863, 1864, 1865, 1866,
+	1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1148, 1875, 1876, 1877, 1878, 1879, 1880, 1365,
+	1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896,
+	1897, 1898, 1899, 1900, 1087, 1901, 1902, 1903, 1904, 1905, 1906, 1433, 1907, 1908, 1909, 1910,
+	1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926,
+	1438, 1439, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1440,
+	1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955,
+	1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1446, 1446,
+	1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1447, 1980, 1981, 1982, 1983, 1984,
+	1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 0, 0
+};
+
+static const nfc_prop_t g_nfcProps[1999] =
+{
+	{ 0, 0, 0 }, { 0, 2, 0 }, { 0, 2, 2 }, { 0, 2, 4 }, { 0, 2, 6 }, { 0, 2, 8 },
+	{ 0, 2, 10 }, { 0, 2, 12 }, { 0, 2, 14 }, { 0, 2, 16 }, { 0, 2, 18 }, { 0, 2, 20 },
+	{ 0, 2, 22 }, { 0, 2, 24 }, { 0, 2, 26 }, { 0, 2, 28 }, { 0, 2, 30 }, { 0, 2, 32 },
+	{ 0, 2, 34 }, { 0, 2, 36 }, { 0, 2, 38 }, { 0, 2, 40 }, { 0, 2, 42 }, { 0, 2, 44 },
+	{ 0, 2, 46 }, { 0, 2, 48 }, { 0, 2, 50 }, { 0, 2, 52 }, { 0, 2, 54 }, { 0, 2, 56 },
+	{ 0, 2, 58 }, { 0, 2, 60 }, { 0, 2, 62 }, { 0, 2, 64 }, { 0, 2, 66 }, { 0, 2, 68 },
+	{ 0, 2, 70 }, { 0, 2, 72 }, { 0, 2, 74 }, { 0, 2, 76 }, { 0, 2, 78 }, { 0, 2, 80 },
+	{ 0, 2, 82 }, { 0, 2, 84 }, { 0, 2, 86 }, { 0, 2, 88 }, { 0, 2, 90 }, { 0, 2, 92 },
+	{ 0, 2, 94 }, { 0, 2, 96 }, { 0, 2, 98 }, { 0, 2, 100 }, { 0, 2, 102 }, { 0, 2, 104 },
+	{ 0, 2, 106 }, { 0, 2, 108 }, { 0, 2, 110 }, { 0, 2, 112 }, { 0, 2, 114 }, { 0, 2, 116 },
+	{ 0, 2, 118 }, { 0, 2, 120 }, { 0, 2, 122 }, { 0, 2, 124 }, { 0, 2, 126 }, { 0, 2, 128 },
+	{ 0, 2, 130 }, { 0, 2, 132 }, { 0, 2, 134 }, { 0, 2, 136 }, { 0, 2, 138 }, { 0, 2, 140 },
+	{ 0, 2, 142 }, { 0, 2, 144 }, { 0, 2, 146 }, { 0, 2, 148 }, { 0, 2, 150 }, { 0, 2, 152 },
+	{ 0, 2, 154 }, { 0, 2, 156 }, { 0, 2, 158 }, { 0, 2, 160 }, { 0, 2, 162 }, { 0, 2, 164 },
+	{ 0, 2, 166 }, { 0, 2, 168 }, { 0, 2, 170 }, { 0, 2, 172 }, { 0, 2, 174 }, { 0, 2, 176 },
+	{ 0, 2, 178 }, { 0, 2, 180 }, { 0, 2, 182 }, { 0, 2, 184 }, { 0, 2, 186 }, { 0, 2, 188 },
+	{ 0, 2, 190 }, { 0, 2, 192 }, { 0, 2, 194 }, { 0, 2, 196 }, { 0, 2, 198 }, { 0, 2, 200 },
+	{ 0, 2, 202 }, { 0, 2, 204 }, { 0, 2, 206 }, { 0, 2, 208 }, { 0, 2, 210 }, { 0, 2, 212 },
+	{ 0, 2, 214 }, { 0, 2, 216 }, { 0, 2, 218 }, { 0, 2, 220 }, { 0, 2, 222 }, { 0, 2, 224 },
+	{ 0, 2, 226 }, { 0, 2, 228 }, { 0, 2, 230 }, { 0, 2, 232 }, { 0, 2, 234 }, { 0, 2, 236 },
+	{ 0, 2, 238 }, { 0, 2, 240 }, { 0, 2, 242 }, { 0, 2, 244 }, { 0, 2, 246 }, { 0, 2, 248 },
+	{ 0, 2, 250 }, { 0, 2, 252 }, { 0, 2, 254 }, { 0, 2, 256 }, { 0, 2, 258 }, { 0, 2, 260 },
+	{ 0, 2, 262 }, { 0, 2, 264 }, { 0, 2, 266 }, { 0, 2, 268 }, { 0, 2, 270 }, { 0, 2, 272 },
+	{ 0, 2, 274 }, { 0, 2, 276 }, { 0, 2, 278 }, { 0, 2, 280 }, { 0, 2, 282 }, { 0, 2, 284 },
+	{ 0, 2, 286 }, { 0, 2, 288 }, { 0, 2, 290 }, { 0, 2, 292 }, { 0, 2, 294 }, { 0, 2, 296 },
+	{ 0, 2, 298 }, { 0, 2, 300 }, { 0, 2, 302 }, { 0, 2, 304 }, { 0, 2, 306 }, { 0, 2, 308 },
+	{ 0, 2, 310 }, { 0, 2, 312 }, { 0, 2, 314 }, { 0, 2, 316 }, { 0, 2, 318 }, { 0, 2, 320 },
+	{ 0, 2, 322 }, { 0, 2, 324 }, { 0, 2, 326 }, { 0, 2, 328 }, { 0, 2, 330 }, { 0, 2, 332 },
+	{ 0, 2, 334 }, { 0, 2, 336 }, { 0, 2, 338 }, { 0, 2, 340 }, { 0, 2, 342 }, { 0, 2, 344 },
+	{ 0, 3, 346 }, { 0, 3, 349 }, { 0, 3, 352 }, { 0, 3, 355 }, { 0, 3, 358 }, { 0, 3, 361 },
+	{ 0, 3, 364 }, { 0, 3, 367 }, { 0, 3, 370 }, { 0, 3, 373 }, { 0, 3, 376 }, { 0, 3, 379 },
+	{ 0, 2, 382 }, { 0, 2, 384 }, { 0, 2, 386 }, { 0, 2, 388 }, { 0, 2, 390 }, { 0, 2, 392 },
+	{ 0, 2, 394 }, { 0, 2, 396 }, { 0, 3, 398 }, { 0, 3, 401 }, { 0, 2, 404 }, { 0, 2, 406 },
+	{ 0, 2, 408 }, { 0, 2, 410 }, { 0, 2, 412 }, { 0, 2, 414 }, { 0, 2, 416 }, { 0, 3, 418 },
+	{ 0, 3, 421 }, { 0, 2, 424 }, { 0, 2, 426 }, { 0, 2, 428 }, { 0, 2, 430 }, { 0, 2, 432 },
+	{ 0, 2, 434 }, { 0, 2, 436 }, { 0, 2, 438 }, { 0, 2, 440 }, { 0, 2, 442 }, { 0, 2, 444 },
+	{ 0, 2, 446 }, { 0, 2, 448 }, { 0, 2, 450 }, { 0, 2, 452 }, { 0, 2, 454 }, { 0, 2, 456 },
+	{ 0, 2, 458 }, { 0, 2, 460 }, { 0, 2, 462 }, { 0, 2, 464 }, { 0, 2, 466 }, { 0, 2, 468 },
+	{ 0, 2, 470 }, { 0, 2, 472 }, { 0, 2, 474 }, { 0, 2, 476 }, { 0, 2, 478 }, { 0, 2, 480 },
+	{ 0, 2, 482 }, { 0, 2, 484 }, { 0, 2, 486 }, { 0, 2, 488 }, { 0, 2, 490 }, { 0, 2, 492 },
+	{ 0, 2, 494 }, { 0, 2, 496 }, { 0, 2, 498 }, { 0, 3, 500 }, { 0, 3, 503 }, { 0, 3, 506 },
+	{ 0, 3, 509 }, { 0, 2, 512 }, { 0, 2, 514 }, { 0, 3, 516 }, { 0, 3, 519 }, { 0, 2, 522 },
+	{ 0, 2, 524 }, { 230, 0, 0 }, { 232, 0, 0 }, { 220, 0, 0 }, { 216, 0, 0 }, { 202, 0, 0 },
+	{ 1, 0, 0 }, { 230, 1, 526 }, { 230, 1, 527 }, { 230, 1, 528 }, { 230, 2, 529 }, { 240, 0, 0 },
+	{ 233, 0, 0 }, { 234, 0, 0 }, { 0, 1, 531 }, { 0, 1, 532 }, { 0, 2, 533 }, { 0, 2, 535 },
+	{ 0, 1, 537 }, { 0, 2, 538 }, { 0, 2, 540 }, { 0, 2, 542 }, { 0, 2, 544 }, { 0, 2, 546 },
+	{ 0, 2, 548 }, { 0, 3, 550 }, { 0, 2, 553 }, { 0, 2, 555 }, { 0, 2, 557 }, { 0, 2, 559 },
+	{ 0, 2, 561 }, { 0, 2, 563 }, { 0, 3, 565 }, { 0, 2, 568 }, { 0, 2, 570 }, { 0, 2, 572 },
+	{ 0, 2, 574 }, { 0, 2, 576 }, { 0, 2, 578 }, { 0, 2, 580 }, { 0, 2, 582 }, { 0, 2, 584 },
+	{ 0, 2, 586 }, { 0, 2, 588 }, { 0, 2, 590 }, { 0, 2, 592 }, { 0, 2, 594 }, { 0, 2, 596 },
+	{ 0, 2, 598 }, { 0, 2, 600 }, { 0, 2, 602 }, { 0, 2, 604 }, { 0, 2, 606 }, { 0, 2, 608 },
+	{ 0, 2, 610 }, { 0, 2, 612 }, { 0, 2, 614 }, { 0, 2, 616 }, { 0, 2, 618 }, { 0, 2, 620 },
+	{ 0, 2, 622 }, { 0, 2, 624 }, { 0, 2, 626 }, { 0, 2, 628 }, { 0, 2, 630 }, { 0, 2, 632 },
+	{ 0, 2, 634 }, { 0, 2, 636 }, { 0, 2, 638 }, { 0, 2, 640 }, { 0, 2, 642 }, { 0, 2, 644 },
+	{ 0, 2, 646 }, { 0, 2, 648 }, { 0, 2, 650 }, { 0, 2, 652 }, { 0, 2, 654 }, { 0, 2, 656 },
+	{ 0, 2, 658 }, { 0, 2, 660 }, { 0, 2, 662 }, { 0, 2, 664 }, { 0, 2, 666 }, { 0, 2, 668 },
+	{ 0, 2, 670 }, { 0, 2, 672 }, { 0, 2, 674 }, { 0, 2, 676 }, { 0, 2, 678 }, { 0, 2, 680 },
+	{ 0, 2, 682 }, { 0, 2, 684 }, { 222, 0, 0 }, { 228, 0, 0 }, { 10, 0, 0 }, { 11, 0, 0 },
+	{ 12, 0, 0 }, { 13, 0, 0 }, { 14, 0, 0 }, { 15, 0, 0 }, { 16, 0, 0 }, { 17, 0, 0 },
+	{ 18, 0, 0 }, { 19, 0, 0 }, { 20, 0, 0 }, { 21, 0, 0 }, { 22, 0, 0 }, { 23, 0, 0 },
+	{ 24, 0, 0 }, { 25, 0, 0 }, { 30, 0, 0 }, { 31, 0, 0 }, { 32, 0, 0 }, { 0, 2, 686 },
+	{ 0, 2, 688 }, { 0, 2, 690 }, { 0, 2, 692 }, { 0, 2, 694 }, { 27, 0, 0 }, { 28, 0, 0 },
+	{ 29, 0, 0 }, { 33, 0, 0 }, { 34, 0, 0 }, { 35, 0, 0 }, { 0, 2, 696 }, { 0, 2, 698 },
+	{ 0, 2, 700 }, { 36, 0, 0 }, { 0, 2, 702 }, { 0, 2, 704 }, { 0, 2, 706 }, { 7, 0, 0 },
+	{ 9, 0, 0 }, { 0, 2, 708 }, { 0, 2, 710 }, { 0, 2, 712 }, { 0, 2, 714 }, { 0, 2, 716 },
+	{ 0, 2, 718 }, { 0, 2, 720 }, { 0, 2, 722 }, { 0, 2, 724 }, { 0, 2, 726 }, { 0, 2, 728 },
+	{ 0, 2, 730 }, { 0, 2, 732 }, { 0, 2, 734 }, { 0, 2, 736 }, { 0, 2, 738 }, { 0, 2, 740 },
+	{ 0, 2, 742 }, { 0, 2, 744 }, { 0, 2, 746 }, { 0, 2, 748 }, { 0, 2, 750 }, { 0, 2, 752 },
+	{ 0, 2, 754 }, { 0, 2, 756 }, { 0, 2, 758 }, { 0, 2, 760 }, { 0, 2, 762 }, { 0, 2, 764 },
+	{ 84, 0, 0 }, { 91, 0, 0 }, { 0, 2, 766 }, { 0, 2, 768 }, { 0, 2, 770 }, { 0, 2, 772 },
+	{ 0, 3, 774 }, { 0, 2, 777 }, { 0, 2, 779 }, { 0, 2, 781 }, { 0, 2, 783 }, { 0, 2, 785 },
+	{ 0, 3, 787 }, { 0, 2, 790 }, { 103, 0, 0 }, { 107, 0, 0 }, { 118, 0, 0 }, { 122, 0, 0 },
+	{ 0, 2, 792 }, { 0, 2, 794 }, { 0, 2, 796 }, { 0, 2, 798 }, { 0, 2, 800 }, { 0, 2, 802 },
+	{ 129, 0, 0 }, { 130, 0, 0 }, { 0, 2, 804 }, { 132, 0, 0 }, { 0, 2, 806 }, { 0, 2, 808 },
+	{ 0, 2, 810 }, { 0, 2, 812 }, { 0, 2, 814 }, { 0, 2, 816 }, { 0, 2, 818 }, { 0, 2, 820 },
+	{ 0, 2, 822 }, { 0, 2, 824 }, { 0, 2, 826 }, { 0, 2, 828 }, { 0, 2, 830 }, { 0, 2, 832 },
+	{ 0, 2, 834 }, { 0, 2, 836 }, { 0, 2, 838 }, { 0, 2, 840 }, { 0, 2, 842 }, { 0, 2, 844 },
+	{ 0, 2, 846 }, { 0, 2, 848 }, { 214, 0, 0 }, { 218, 0, 0 }, { 0, 2, 850 }, { 0, 2, 852 },
+	{ 0, 2, 854 }, { 0, 2, 856 }, { 0, 2, 858 }, { 0, 2, 860 }, { 0, 2, 862 }, { 0, 2, 864 },
+	{ 0, 3, 866 }, { 0, 3, 869 }, { 0, 2, 872 }, { 0, 2, 874 }, { 0, 2, 876 }, { 0, 2, 878 },
+	{ 0, 2, 880 }, { 0, 2, 882 }, { 0, 2, 884 }, { 0, 2, 886 }, { 0, 2, 888 }, { 0, 2, 890 },
+	{ 0, 3, 892 }, { 0, 3, 895 }, { 0, 3, 898 }, { 0, 3, 901 }, { 0, 2, 904 }, { 0, 2, 906 },
+	{ 0, 2, 908 }, { 0, 2, 910 }, { 0, 3, 912 }, { 0, 3, 915 }, { 0, 2, 918 }, { 0, 2, 920 },
+	{ 0, 2, 922 }, { 0, 2, 924 }, { 0, 2, 926 }, { 0, 2, 928 }, { 0, 2, 930 }, { 0, 2, 932 },
+	{ 0, 2, 934 }, { 0, 2, 936 }, { 0, 2, 938 }, { 0, 2, 940 }, { 0, 2, 942 }, { 0, 2, 944 },
+	{ 0, 2, 946 }, { 0, 2, 948 }, { 0, 3, 950 }, { 0, 3, 953 }, { 0, 2, 956 }, { 0, 2, 958 },
+	{ 0, 2, 960 }, { 0, 2, 962 }, { 0, 2, 964 }, { 0, 2, 966 }, { 0, 2, 968 }, { 0, 2, 970 },
+	{ 0, 3, 972 }, { 0, 3, 975 }, { 0, 2, 978 }, { 0, 2, 980 }, { 0, 2, 982 }, { 0, 2, 984 },
+	{ 0, 2, 986 }, { 0, 2, 988 }, { 0, 2, 990 }, { 0, 2, 992 }, { 0, 2, 994 }, { 0, 2, 996 },
+	{ 0, 2, 998 }, { 0, 2, 1000 }, { 0, 2, 1002 }, { 0, 2, 1004 }, { 0, 2, 1006 }, { 0, 2, 1008 },
+	{ 0, 2, 1010 }, { 0, 2, 1012 }, { 0, 3, 1014 }, { 0, 3, 1017 }, { 0, 3, 1020 }, { 0, 3, 1023 },
+	{ 0, 3, 1026 }, { 0, 3, 1029 }, { 0, 3, 1032 }, { 0, 3, 1035 }, { 0, 2, 1038 }, { 0, 2, 1040 },
+	{ 0, 2, 1042 }, { 0, 2, 1044 }, { 0, 2, 1046 }, { 0, 2, 1048 }, { 0, 2, 1050 }, { 0, 2, 1052 },
+	{ 0, 3, 1054 }, { 0, 3, 1057 }, { 0, 2, 1060 }, { 0, 2, 1062 }, { 0, 2, 1064 }, { 0, 2, 1066 },
+	{ 0, 2, 1068 }, { 0, 2, 1070 }, { 0, 3, 1072 }, { 0, 3, 1075 }, { 0, 3, 1078 }, { 0, 3, 1081 },
+	{ 0, 3, 1084 }, { 0, 3, 1087 }, { 0, 2, 1090 }, { 0, 2, 1092 }, { 0, 2, 1094 }, { 0, 2, 1096 },
+	{ 0, 2, 1098 }, { 0, 2, 1100 }, { 0, 2, 1102 }, { 0, 2, 1104 }, { 0, 2, 1106 }, { 0, 2, 1108 },
+	{ 0, 2, 1110 }, { 0, 2, 1112 }, { 0, 2, 1114 }, { 0, 2, 1116 }, { 0, 3, 1118 }, { 0, 3, 1121 },
+	{ 0, 3, 1124 }, { 0, 3, 1127 }, { 0, 2, 1130 }, { 0, 2, 1132 }, { 0, 2, 1134 }, { 0, 2, 1136 },
+	{ 0, 2, 1138 }, { 0, 2, 1140 }, { 0, 2, 1142 }, { 0, 2, 1144 }, { 0, 2, 1146 }, { 0, 2, 1148 },
+	{ 0, 2, 1150 }, { 0, 2, 1152 }, { 0, 2, 1154 }, { 0, 2, 1156 }, { 0, 2, 1158 }, { 0, 2, 1160 },
+	{ 0, 2, 1162 }, { 0, 2, 1164 }, { 0, 2, 1166 }, { 0, 2, 1168 }, { 0, 2, 1170 }, { 0, 2, 1172 },
+	{ 0, 2, 1174 }, { 0, 2, 1176 }, { 0, 2, 1178 }, { 0, 2, 1180 }, { 0, 2, 1182 }, { 0, 2, 1184 },
+	{ 0, 2, 1186 }, { 0, 2, 1188 }, { 0, 2, 1190 }, { 0, 2, 1192 }, { 0, 2, 1194 }, { 0, 2, 1196 },
+	{ 0, 2, 1198 }, { 0, 3, 1200 }, { 0, 3, 1203 }, { 0, 3, 1206 }, { 0, 3, 1209 }, { 0, 3, 1212 },
+	{ 0, 3, 1215 }, { 0, 3, 1218 }, { 0, 3, 1221 }, { 0, 3, 1224 }, { 0, 3, 1227 }, { 0, 3, 1230 },
+	{ 0, 3, 1233 }, { 0, 3, 1236 }, { 0, 3, 1239 }, { 0, 3, 1242 }, { 0, 3, 1245 }, { 0, 3, 1248 },
+	{ 0, 3, 1251 }, { 0, 3, 1254 }, { 0, 3, 1257 }, { 0, 2, 1260 }, { 0, 2, 1262 }, { 0, 2, 1264 },
+	{ 0, 2, 1266 }, { 0, 2, 1268 }, { 0, 2, 1270 }, { 0, 3, 1272 }, { 0, 3, 1275 }, { 0, 3, 1278 },
+	{ 0, 3, 1281 }, { 0, 3, 1284 }, { 0, 3, 1287 }, { 0, 3, 1290 }, { 0, 3, 1293 }, { 0, 3, 1296 },
+	{ 0, 3, 1299 }, { 0, 2, 1302 }, { 0, 2, 1304 }, { 0, 2, 1306 }, { 0, 2, 1308 }, { 0, 2, 1310 },
+	{ 0, 2, 1312 }, { 0, 2, 1314 }, { 0, 2, 1316 }, { 0, 3, 1318 }, { 0, 3, 1321 }, { 0, 3, 1324 },
+	{ 0, 3, 1327 }, { 0, 3, 1330 }, { 0, 3, 1333 }, { 0, 3, 1336 }, { 0, 3, 1339 }, { 0, 3, 1342 },
+	{ 0, 3, 1345 }, { 0, 3, 1348 }, { 0, 3, 1351 }, { 0, 3, 1354 }, { 0, 3, 1357 }, { 0, 3, 1360 },
+	{ 0, 3, 1363 }, { 0, 3, 1366 }, { 0, 3, 1369 }, { 0, 3, 1372 }, { 0, 3, 1375 }, { 0, 2, 1378 },
+	{ 0, 2, 1380 }, { 0, 2, 1382 }, { 0, 2, 1384 }, { 0, 3, 1386 }, { 0, 3, 1389 }, { 0, 3, 1392 },
+	{ 0, 3, 1395 }, { 0, 3, 1398 }, { 0, 3, 1401 }, { 0, 3, 1404 }, { 0, 3, 1407 }, { 0, 3, 1410 },
+	{ 0, 3, 1413 }, { 0, 2, 1416 }, { 0, 2, 1418 }, { 0, 2, 1420 }, { 0, 2, 1422 }, { 0, 2, 1424 },
+	{ 0, 2, 1426 }, { 0, 2, 1428 }, { 0, 2, 1430 }, { 0, 2, 1432 }, { 0, 2, 1434 }, { 0, 3, 1436 },
+	{ 0, 3, 1439 }, { 0, 3, 1442 }, { 0, 3, 1445 }, { 0, 3, 1448 }, { 0, 3, 1451 }, { 0, 2, 1454 },
+	{ 0, 2, 1456 }, { 0, 3, 1458 }, { 0, 3, 1461 }, { 0, 3, 1464 }, { 0, 3, 1467 }, { 0, 3, 1470 },
+	{ 0, 3, 1473 }, { 0, 2, 1476 }, { 0, 2, 1478 }, { 0, 3, 1480 }, { 0, 3, 1483 }, { 0, 3, 1486 },
+	{ 0, 3, 1489 }, { 0, 2, 1492 }, { 0, 2, 1494 }, { 0, 3, 1496 }, { 0, 3, 1499 }, { 0, 3, 1502 },
+	{ 0, 3, 1505 }, { 0, 2, 1508 }, { 0, 2, 1510 }, { 0, 3, 1512 }, { 0, 3, 1515 }, { 0, 3, 1518 },
+	{ 0, 3, 1521 }, { 0, 3, 1524 }, { 0, 3, 1527 }, { 0, 2, 1530 }, { 0, 2, 1532 }, { 0, 3, 1534 },
+	{ 0, 3, 1537 }, { 0, 3, 1540 }, { 0, 3, 1543 }, { 0, 3, 1546 }, { 0, 3, 1549 }, { 0, 2, 1552 },
+	{ 0, 2, 1554 }, { 0, 3, 1556 }, { 0, 3, 1559 }, { 0, 3, 1562 }, { 0, 3, 1565 }, { 0, 3, 1568 },
+	{ 0, 3, 1571 }, { 0, 2, 1574 }, { 0, 2, 1576 }, { 0, 3, 1578 }, { 0, 3, 1581 }, { 0, 3, 1584 },
+	{ 0, 3, 1587 }, { 0, 3, 1590 }, { 0, 3, 1593 }, { 0, 2, 1596 }, { 0, 2, 1598 }, { 0, 3, 1600 },
+	{ 0, 3, 1603 }, { 0, 3, 1606 }, { 0, 3, 1609 }, { 0, 2, 1612 }, { 0, 2, 1614 }, { 0, 3, 1616 },
+	{ 0, 3, 1619 }, { 0, 3, 1622 }, { 0, 3, 1625 }, { 0, 2, 1628 }, { 0, 2, 1630 }, { 0, 3, 1632 },
+	{ 0, 3, 1635 }, { 0, 3, 1638 }, { 0, 3, 1641 }, { 0, 3, 1644 }, { 0, 3, 1647 }, { 0, 2, 1650 },
+	{ 0, 3, 1652 }, { 0, 3, 1655 }, { 0, 3, 1658 }, { 0, 2, 1661 }, { 0, 2, 1663 }, { 0, 3, 1665 },
+	{ 0, 3, 1668 }, { 0, 3, 1671 }, { 0, 3, 1674 }, { 0, 3, 1677 }, { 0, 3, 1680 }, { 0, 2, 1683 },
+	{ 0, 2, 1685 }, { 0, 3, 1687 }, { 0, 3, 1690 }, { 0, 3, 1693 }, { 0, 3, 1696 }, { 0, 3, 1699 },
+	{ 0, 3, 1702 }, { 0, 2, 1705 }, { 0, 2, 1707 }, { 0, 2, 1709 }, { 0, 2, 1711 }, { 0, 2, 1713 },
+	{ 0, 2, 1715 }, { 0, 2, 1717 }, { 0, 3, 1719 }, { 0, 3, 1722 }, { 0, 4, 1725 }, { 0, 4, 1729 },
+	{ 0, 4, 1733 }, { 0, 4, 1737 }, { 0, 4, 1741 }, { 0, 4, 1745 }, { 0, 3, 1749 }, { 0, 3, 1752 },
+	{ 0, 4, 1755 }, { 0, 4, 1759 }, { 0, 4, 1763 }, { 0, 4, 1767 }, { 0, 4, 1771 }, { 0, 4, 1775 },
+	{ 0, 3, 1779 }, { 0, 3, 1782 }, { 0, 4, 1785 }, { 0, 4, 1789 }, { 0, 4, 1793 }, { 0, 4, 1797 },
+	{ 0, 4, 1801 }, { 0, 4, 1805 }, { 0, 3, 1809 }, { 0, 3, 1812 }, { 0, 4, 1815 }, { 0, 4, 1819 },
+	{ 0, 4, 1823 }, { 0, 4, 1827 }, { 0, 4, 1831 }, { 0, 4, 1835 }, { 0, 3, 1839 }, { 0, 3, 1842 },
+	{ 0, 4, 1845 }, { 0, 4, 1849 }, { 0, 4, 1853 }, { 0, 4, 1857 }, { 0, 4, 1861 }, { 0, 4, 1865 },
+	{ 0, 3, 1869 }, { 0, 3, 1872 }, { 0, 4, 1875 }, { 0, 4, 1879 }, { 0, 4, 1883 }, { 0, 4, 1887 },
+	{ 0, 4, 1891 }, { 0, 4, 1895 }, { 0, 2, 1899 }, { 0, 2, 1901 }, { 0, 3, 1903 }, { 0, 2, 1906 },
+	{ 0, 3, 1908 }, { 0, 2, 1911 }, { 0, 3, 1913 }, { 0, 2, 1916 }, { 0, 2, 1918 }, { 0, 2, 1920 },
+	{ 0, 2, 1922 }, { 0, 1, 1924 }, { 0, 2, 1925 }, { 0, 3, 1927 }, { 0, 2, 1930 }, { 0, 3, 1932 },
+	{ 0, 2, 1935 }, { 0, 3, 1937 }, { 0, 2, 1940 }, { 0, 2, 1942 }, { 0, 2, 1944 }, { 0, 2, 1946 },
+	{ 0, 2, 1948 }, { 0, 2, 1950 }, { 0, 2, 1952 }, { 0, 2, 1954 }, { 0, 3, 1956 }, { 0, 2, 1959 },
+	{ 0, 3, 1961 }, { 0, 2, 1964 }, { 0, 2, 1966 }, { 0, 2, 1968 }, { 0, 2, 1970 }, { 0, 2, 1972 },
+	{ 0, 2, 1974 }, { 0, 2, 1976 }, { 0, 2, 1978 }, { 0, 3, 1980 }, { 0, 2, 1983 }, { 0, 2, 1985 },
+	{ 0, 2, 1987 }, { 0, 3, 1989 }, { 0, 2, 1992 }, { 0, 2, 1994 }, { 0, 2, 1996 }, { 0, 2, 1998 },
+	{ 0, 2, 2000 }, { 0, 1, 2002 }, { 0, 3, 2003 }, { 0, 2, 2006 }, { 0, 3, 2008 }, { 0, 2, 2011 },
+	{ 0, 3, 2013 }, { 0, 2, 2016 }, { 0, 2, 2018 }, { 0, 2, 2020 }, { 0, 1, 2022 }, { 0, 1, 2023 },
+	{ 0, 1, 2024 }, { 0, 1, 2025 }, { 0, 1, 2026 }, { 0, 2, 2027 }, { 0, 2, 2029 }, { 0, 2, 2031 },
+	{ 0, 2, 2033 }, { 0, 2, 2035 }, { 0, 2, 2037 }, { 0, 2, 2039 }, { 0, 2, 2041 }, { 0, 2, 2043 },
+	{ 0, 2, 2045 }, { 0, 2, 2047 }, { 0, 2, 2049 }, { 0, 2, 2051 }, { 0, 2, 2053 }, { 0, 2, 2055 },
+	{ 0, 2, 2057 }, { 0, 2, 2059 }, { 0, 2, 2061 }, { 0, 2, 2063 }, { 0, 2, 2065 }, { 0, 2, 2067 },
+	{ 0, 2, 2069 }, { 0, 2, 2071 }, { 0, 2, 2073 }, { 0, 2, 2075 }, { 0, 2, 2077 }, { 0, 2, 2079 },
+	{ 0, 2, 2081 }, { 0, 2, 2083 }, { 0, 2, 2085 }, { 0, 2, 2087 }, { 0, 2, 2089 }, { 0, 2, 2091 },
+	{ 0, 2, 2093 }, { 0, 2, 2095 }, { 0, 2, 2097 }, { 0, 2, 2099 }, { 0, 2, 2101 }, { 0, 2, 2103 },
+	{ 0, 2, 2105 }, { 0, 2, 2107 }, { 0, 2, 2109 }, { 0, 2, 2111 }, { 0, 2, 2113 }, { 0, 1, 2115 },
+	{ 0, 1, 2116 }, { 0, 2, 2117 }, { 224, 0, 0 }, { 0, 2, 2119 }, { 0, 2, 2121 }, { 0, 2, 2123 },
+	{ 0, 2, 2125 }, { 0, 2, 2127 }, { 0, 2, 2129 }, { 0, 2, 2131 }, { 0, 2, 2133 }, { 0, 2, 2135 },
+	{ 0, 2, 2137 }, { 0, 2, 2139 }, { 0, 2, 2141 }, { 0, 2, 2143 }, { 0, 2, 2145 }, { 0, 2, 2147 },
+	{ 0, 2, 2149 }, { 0, 2, 2151 }, { 0, 2, 2153 }, { 0, 2, 2155 }, { 0, 2, 2157 }, { 0, 2, 2159 },
+	{ 0, 2, 2161 }, { 0, 2, 2163 }, { 0, 2, 2165 }, { 0, 2, 2167 }, { 0, 2, 2169 }, { 8, 0, 0 },
+	{ 0, 2, 2171 }, { 0, 2, 2173 }, { 0, 2, 2175 }, { 0, 2, 2177 }, { 0, 2, 2179 }, { 0, 2, 2181 },
+	{ 0, 2, 2183 }, { 0, 2, 2185 }, { 0, 2, 2187 }, { 0, 2, 2189 }, { 0, 2, 2191 }, { 0, 2, 2193 },
+	{ 0, 2, 2195 }, { 0, 2, 2197 }, { 0, 2, 2199 }, { 0, 2, 2201 }, { 0, 2, 2203 }, { 0, 2, 2205 },
+	{ 0, 2, 2207 }, { 0, 2, 2209 }, { 0, 2, 2211 }, { 0, 2, 2213 }, { 0, 2, 2215 }, { 0, 2, 2217 },
+	{ 0, 2, 2219 }, { 0, 2, 2221 }, { 0, 2, 2223 }, { 0, 2, 2225 }, { 0, 2, 2227 }, { 0, 2, 2229 },
+	{ 0, 2, 2231 }, { 0, 2, 2233 }, { 0, 1, 2235 }, { 0, 1, 2236 }, { 0, 1, 2237 }, { 0, 1, 2238 },
+	{ 0, 1, 2239 }, { 0, 1, 2240 }, { 0, 1, 2241 }, { 0, 1, 2242 }, { 0, 1, 2243 }, { 0, 1, 2244 },
+	{ 0, 1, 2245 }, { 0, 1, 2246 }, { 0, 1, 2247 }, { 0, 1, 2248 }, { 0, 1, 2249 }, { 0, 1, 2250 },
+	{ 0, 1, 2251 }, { 0, 1, 2252 }, { 0, 1, 2253 }, { 0, 1, 2254 }, { 0, 1, 2255 }, { 0, 1, 2256 },
+	{ 0, 1, 2257 }, { 0, 1, 2258 }, { 0, 1, 2259 }, { 0, 1, 2260 }, { 0, 1, 2261 }, { 0, 1, 2262 },
+	{ 0, 1, 2263 }, { 0, 1, 2264 }, { 0, 1, 2265 }, { 0, 1, 2266 }, { 0, 1, 2267 }, { 0, 1, 2268 },
+	{ 0, 1, 2269 }, { 0, 1, 2270 }, { 0, 1, 2271 }, { 0, 1, 2272 }, { 0, 1, 2273 }, { 0, 1, 2274 },
+	{ 0, 1, 2275 }, { 0, 1, 2276 }, { 0, 1, 2277 }, { 0, 1, 2278 }, { 0, 1, 2279 }, { 0, 1, 2280 },
+	{ 0, 1, 2281 }, { 0, 1, 2282 }, { 0, 1, 2283 }, { 0, 1, 2284 }, { 0, 1, 2285 }, { 0, 1, 2286 },
+	{ 0, 1, 2287 }, { 0, 1, 2288 }, { 0, 1, 2289 }, { 0, 1, 2290 }, { 0, 1, 2291 }, { 0, 1, 2292 },
+	{ 0, 1, 2293 }, { 0, 1, 2294 }, { 0, 1, 2295 }, { 0, 1, 2296 }, { 0, 1, 2297 }, { 0, 1, 2298 },
+	{ 0, 1, 2299 }, { 0, 1, 2300 }, { 0, 1, 2301 }, { 0, 1, 2302 }, { 0, 1, 2303 }, { 0, 1, 2304 },
+	{ 0, 1, 2305 }, { 0, 1, 2306 }, { 0, 1, 2307 }, { 0, 1, 2308 }, { 0, 1, 2309 }, { 0, 1, 2310 },
+	{ 0, 1, 2311 }, { 0, 1, 2312 }, { 0, 1, 2313 }, { 0, 1, 2314 }, { 0, 1, 2315 }, { 0, 1, 2316 },
+	{ 0, 1, 2317 }, { 0, 1, 2318 }, { 0, 1, 2319 }, { 0, 1, 2320 }, { 0, 1, 2321 }, { 0, 1, 2322 },
+	{ 0, 1, 2323 }, { 0, 1, 2324 }, { 0, 1, 2325 }, { 0, 1, 2326 }, { 0, 1, 2327 }, { 0, 1, 2328 },
+	{ 0, 1, 2329 }, { 0, 1, 2330 }, { 0, 1, 2331 }, { 0, 1, 2332 }, { 0, 1, 2333 }, { 0, 1, 2334 },
+	{ 0, 1, 2335 }, { 0, 1, 2336 }, { 0, 1, 2337 }, { 0, 1, 2338 }, { 0, 1, 2339 }, { 0, 1, 2340 },
+	{ 0, 1, 2341 }, { 0, 1, 2342 }, { 0, 1, 2343 }, { 0, 1, 2344 }, { 0, 1, 2345 }, { 0, 1, 2346 },
+	{ 0, 1, 2347 }, { 0, 1, 2348 }, { 0, 1, 2349 }, { 0, 1, 2350 }, { 0, 1, 2351 }, { 0, 1, 2352 },
+	{ 0, 1, 2353 }, { 0, 1, 2354 }, { 0, 1, 2355 }, { 0, 1, 2356 }, { 0, 1, 2357 }, { 0, 1, 2358 },
+	{ 0, 1, 2359 }, { 0, 1, 2360 }, { 0, 1, 2361 }, { 0, 1, 2362 }, { 0, 1, 2363 }, { 0, 1, 2364 },
+	{ 0, 1, 2365 }, { 0, 1, 2366 }, { 0, 1, 2367 }, { 0, 1, 2368 }, { 0, 1, 2369 }, { 0, 1, 2370 },
+	{ 0, 1, 2371 }, { 0, 1, 2372 }, { 0, 1, 2373 }, { 0, 1, 2374 }, { 0, 1, 2375 }, { 0, 1, 2376 },
+	{ 0, 1, 2377 }, { 0, 1, 2378 }, { 0, 1, 2379 }, { 0, 1, 2380 }, { 0, 1, 2381 }, { 0, 1, 2382 },
+	{ 0, 1, 2383 }, { 0, 1, 2384 }, { 0, 1, 2385 }, { 0, 1, 2386 }, { 0, 1, 2387 }, { 0, 1, 2388 },
+	{ 0, 1, 2389 }, { 0, 1, 2390 }, { 0, 1, 2391 }, { 0, 1, 2392 }, { 0, 1, 2393 }, { 0, 1, 2394 },
+	{ 0, 1, 2395 }, { 0, 1, 2396 }, { 0, 1, 2397 }, { 0, 1, 2398 }, { 0, 1, 2399 }, { 0, 1, 2400 },
+	{ 0, 1, 2401 }, { 0, 1, 2402 }, { 0, 1, 2403 }, { 0, 1, 2404 }, { 0, 1, 2405 }, { 0, 1, 2406 },
+	{ 0, 1, 2407 }, { 0, 1, 2408 }, { 0, 1, 2409 }, { 0, 1, 2410 }, { 0, 1, 2411 }, { 0, 1, 2412 },
+	{ 0, 1, 2413 }, { 0, 1, 2414 }, { 0, 1, 2415 }, { 0, 1, 2416 }, { 0, 1, 2417 }, { 0, 1, 2418 },
+	{ 0, 1, 2419 }, { 0, 1, 2420 }, { 0, 1, 2421 }, { 0, 1, 2422 }, { 0, 1, 2423 }, { 0, 1, 2424 },
+	{ 0, 1, 2425 }, { 0, 1, 2426 }, { 0, 1, 2427 }, { 0, 1, 2428 }, { 0, 1, 2429 }, { 0, 1, 2430 },
+	{ 0, 1, 2431 }, { 0, 1, 2432 }, { 0, 1, 2433 }, { 0, 1, 2434 }, { 0, 1, 2435 }, { 0, 1, 2436 },
+	{ 0, 1, 2437 }, { 0, 1, 2438 }, { 0, 1, 2439 }, { 0, 1, 2440 }, { 0, 1, 2441 }, { 0, 1, 2442 },
+	{ 0, 1, 2443 }, { 0, 1, 2444 }, { 0, 1, 2445 }, { 0, 1, 2446 }, { 0, 1, 2447 }, { 0, 1, 2448 },
+	{ 0, 1, 2449 }, { 0, 1, 2450 }, { 0, 1, 2451 }, { 0, 1, 2452 }, { 0, 1, 2453 }, { 0, 1, 2454 },
+	{ 0, 1, 2455 }, { 0, 1, 2456 }, { 0, 1, 2457 }, { 0, 1, 2458 }, { 0, 1, 2459 }, { 0, 1, 2460 },
+	{ 0, 1, 2461 }, { 0, 1, 2462 }, { 0, 1, 2463 }, { 0, 1, 2464 }, { 0, 1, 2465 }, { 0, 1, 2466 },
+	{ 0, 1, 2467 }, { 0, 1, 2468 }, { 0, 1, 2469 }, { 0, 1, 2470 }, { 0, 1, 2471 }, { 0, 1, 2472 },
+	{ 0, 1, 2473 }, { 0, 1, 2474 }, { 0, 1, 2475 }, { 0, 1, 2476 }, { 0, 1, 2477 }, { 0, 1, 2478 },
+	{ 0, 1, 2479 }, { 0, 1, 2480 }, { 0, 1, 2481 }, { 0, 1, 2482 }, { 0, 1, 2483 }, { 0, 1, 2484 },
+	{ 0, 1, 2485 }, { 0, 1, 2486 }, { 0, 1, 2487 }, { 0, 1, 2488 }, { 0, 1, 2489 }, { 0, 1, 2490 },
+	{ 0, 1, 2491 }, { 0, 1, 2492 }, { 0, 1, 2493 }, { 0, 1, 2494 }, { 0, 1, 2495 }, { 0, 1, 2496 },
+	{ 0, 1, 2497 }, { 0, 1, 2498 }, { 0, 1, 2499 }, { 0, 1, 2500 }, { 0, 1, 2501 }, { 0, 1, 2502 },
+	{ 0, 1, 2503 }, { 0, 1, 2504 }, { 0, 1, 2505 }, { 0, 1, 2506 }, { 0, 1, 2507 }, { 0, 1, 2508 },
+	{ 0, 1, 2509 }, { 0, 1, 2510 }, { 0, 1, 2511 }, { 0, 1, 2512 }, { 0, 1, 2513 }, { 0, 1, 2514 },
+	{ 0, 1, 2515 }, { 0, 1, 2516 }, { 0, 1, 2517 }, { 0, 1, 2518 }, { 0, 1, 2519 }, { 0, 1, 2520 },
+	{ 0, 1, 2521 }, { 0, 1, 2522 }, { 0, 1, 2523 }, { 0, 1, 2524 }, { 0, 1, 2525 }, { 0, 1, 2526 },
+	{ 0, 1, 2527 }, { 0, 1, 2528 }, { 0, 1, 2529 }, { 0, 1, 2530 }, { 0, 1, 2531 }, { 0, 1, 2532 },
+	{ 0, 1, 2533 }, { 0, 1, 2534 }, { 0, 1, 2535 }, { 0, 1, 2536 }, { 0, 1, 2537 }, { 0, 1, 2538 },
+	{ 0, 1, 2539 }, { 0, 1, 2540 }, { 0, 1, 2541 }, { 0, 1, 2542 }, { 0, 1, 2543 }, { 0, 1, 2544 },
+	{ 0, 1, 2545 }, { 0, 1, 2546 }, { 0, 1, 2547 }, { 0, 1, 2548 }, { 0, 1, 2549 }, { 0, 1, 2550 },
+	{ 0, 1, 2551 }, { 0, 1, 2552 }, { 0, 1, 2553 }, { 0, 1, 2554 }, { 0, 1, 2555 }, { 0, 1, 2556 },
+	{ 0, 1, 2557 }, { 0, 1, 2558 }, { 0, 1, 2559 }, { 0, 1, 2560 }, { 0, 1, 2561 }, { 0, 1, 2562 },
+	{ 0, 1, 2563 }, { 0, 1, 2564 }, { 0, 1, 2565 }, { 0, 1, 2566 }, { 0, 1, 2567 }, { 0, 1, 2568 },
+	{ 0, 1, 2569 }, { 0, 1, 2570 }, { 0, 1, 2571 }, { 0, 1, 2572 }, { 0, 1, 2573 }, { 0, 1, 2574 },
+	{ 0, 1, 2575 }, { 0, 1, 2576 }, { 0, 1, 2577 }, { 0, 1, 2578 }, { 0, 1, 2579 }, { 0, 1, 2580 },
+	{ 0, 1, 2581 }, { 0, 1, 2582 }, { 0, 1, 2583 }, { 0, 1, 2584 }, { 0, 1, 2585 }, { 0, 1, 2586 },
+	{ 0, 1, 2587 }, { 0, 1, 2588 }, { 0, 1, 2589 }, { 0, 1, 2590 }, { 0, 1, 2591 }, { 0, 1, 2592 },
+	{ 0, 1, 2593 }, { 0, 1, 2594 }, { 0, 1, 2595 }, { 0, 1, 2596 }, { 0, 1, 2597 }, { 0, 1, 2598 },
+	{ 0, 1, 2599 }, { 0, 1, 2600 }, { 0, 1, 2601 }, { 0, 1, 2602 }, { 0, 1, 2603 }, { 0, 1, 2604 },
+	{ 0, 1, 2605 }, { 0, 1, 2606 }, { 0, 1, 2607 }, { 0, 1, 2608 }, { 0, 1, 2609 }, { 0, 1, 2610 },
+	{ 0, 1, 2611 }, { 0, 1, 2612 }, { 0, 1, 2613 }, { 0, 1, 2614 }, { 0, 1, 2615 }, { 0, 1, 2616 },
+	{ 0, 1, 2617 }, { 0, 1, 2618 }, { 0, 1, 2619 }, { 0, 1, 2620 }, { 0, 1, 2621 }, { 0, 1, 2622 },
+	{ 0, 1, 2623 }, { 0, 1, 2624 }, { 0, 1, 2625 }, { 0, 1, 2626 }, { 0, 1, 2627 }, { 0, 1, 2628 },
+	{ 0, 1, 2629 }, { 0, 1, 2630 }, { 0, 1, 2631 }, { 0, 1, 2632 }, { 0, 1, 2633 }, { 0, 1, 2634 },
+	{ 0, 1, 2635 }, { 0, 1, 2636 }, { 0, 1, 2637 }, { 0, 1, 2638 }, { 0, 1, 2639 }, { 0, 1, 2640 },
+	{ 0, 1, 2641 }, { 0, 1, 2642 }, { 0, 1, 2643 }, { 0, 1, 2644 }, { 0, 1, 2645 }, { 0, 1, 2646 },
+	{ 0, 1, 2647 }, { 0, 1, 2648 }, { 0, 1, 2649 }, { 0, 1, 2650 }, { 0, 1, 2651 }, { 0, 1, 2652 },
+	{ 0, 1, 2653 }, { 0, 1, 2654 }, { 0, 1, 2655 }, { 0, 1, 2656 }, { 0, 1, 2657 }, { 0, 1, 2658 },
+	{ 0, 1, 2659 }, { 0, 2, 2660 }, { 26, 0, 0 }, { 0, 2, 2662 }, { 0, 2, 2664 }, { 0, 2, 2666 },
+	{ 0, 3, 2668 }, { 0, 3, 2671 }, { 0, 2, 2674 }, { 0, 2, 2676 }, { 0, 2, 2678 }, { 0, 2, 2680 },
+	{ 0, 2, 2682 }, { 0, 2, 2684 }, { 0, 2, 2686 }, { 0, 2, 2688 }, { 0, 2, 2690 }, { 0, 2, 2692 },
+	{ 0, 2, 2694 }, { 0, 2, 2696 }, { 0, 2, 2698 }, { 0, 2, 2700 }, { 0, 2, 2702 }, { 0, 2, 2704 },
+	{ 0, 2, 2706 }, { 0, 2, 2708 }, { 0, 2, 2710 }, { 0, 2, 2712 }, { 0, 2, 2714 }, { 0, 2, 2716 },
+	{ 0, 2, 2718 }, { 0, 2, 2720 }, { 0, 2, 2722 }, { 0, 2, 2724 }, { 0, 2, 2726 }, { 0, 2, 2728 },
+	{ 0, 2, 2730 }, { 0, 2, 2732 }, { 0, 2, 2734 }, { 0, 2, 2736 }, { 0, 2, 2738 }, { 0, 2, 2740 },
+	{ 0, 2, 2742 }, { 0, 2, 2744 }, { 0, 2, 2746 }, { 0, 2, 2748 }, { 0, 2, 2750 }, { 0, 2, 2752 },
+	{ 0, 2, 2754 }, { 6, 0, 0 }, { 0, 2, 2756 }, { 0, 2, 2758 }, { 0, 3, 2760 }, { 0, 3, 2763 },
+	{ 0, 3, 2766 }, { 0, 3, 2769 }, { 0, 3, 2772 }, { 226, 0, 0 }, { 0, 2, 2775 }, { 0, 2, 2777 },
+	{ 0, 3, 2779 }, { 0, 3, 2782 }, { 0, 3, 2785 }, { 0, 3, 2788 }, { 0, 1, 2791 }, { 0, 1, 2792 },
+	{ 0, 1, 2793 }, { 0, 1, 2794 }, { 0, 1, 2795 }, { 0, 1, 2796 }, { 0, 1, 2797 }, { 0, 1, 2798 },
+	{ 0, 1, 2799 }, { 0, 1, 2800 }, { 0, 1, 2801 }, { 0, 1, 2802 }, { 0, 1, 2803 }, { 0, 1, 2804 },
+	{ 0, 1, 2805 }, { 0, 1, 2806 }, { 0, 1, 2807 }, { 0, 1, 2808 }, { 0, 1, 2809 }, { 0, 1, 2810 },
+	{ 0, 1, 2811 }, { 0, 1, 2812 }, { 0, 1, 2813 }, { 0, 1, 2814 }, { 0, 1, 2815 }, { 0, 1, 2816 },
+	{ 0, 1, 2817 }, { 0, 1, 2818 }, { 0, 1, 2819 }, { 0, 1, 2820 }, { 0, 1, 2821 }, { 0, 1, 2822 },
+	{ 0, 1, 2823 }, { 0, 1, 2824 }, { 0, 1, 2825 }, { 0, 1, 2826 }, { 0, 1, 2827 }, { 0, 1, 2828 },
+	{ 0, 1, 2829 }, { 0, 1, 2830 }, { 0, 1, 2831 }, { 0, 1, 2832 }, { 0, 1, 2833 }, { 0, 1, 2834 },
+	{ 0, 1, 2835 }, { 0, 1, 2836 }, { 0, 1, 2837 }, { 0, 1, 2838 }, { 0, 1, 2839 }, { 0, 1, 2840 },
+	{ 0, 1, 2841 }, { 0, 1, 2842 }, { 0, 1, 2843 }, { 0, 1, 2844 }, { 0, 1, 2845 }, { 0, 1, 2846 },
+	{ 0, 1, 2847 }, { 0, 1, 2848 }, { 0, 1, 2849 }, { 0, 1, 2850 }, { 0, 1, 2851 }, { 0, 1, 2852 },
+	{ 0, 1, 2853 }, { 0, 1, 2854 }, { 0, 1, 2855 }, { 0, 1, 2856 }, { 0, 1, 2857 }, { 0, 1, 2858 },
+	{ 0, 1, 2859 }, { 0, 1, 2860 }, { 0, 1, 2861 }, { 0, 1, 2862 }, { 0, 1, 2863 }, { 0, 1, 2864 },
+	{ 0, 1, 2865 }, { 0, 1, 2866 }, { 0, 1, 2867 }, { 0, 1, 2868 }, { 0, 1, 2869 }, { 0, 1, 2870 },
+	{ 0, 1, 2871 }, { 0, 1, 2872 }, { 0, 1, 2873 }, { 0, 1, 2874 }, { 0, 1, 2875 }, { 0, 1, 2876 },
+	{ 0, 1, 2877 }, { 0, 1, 2878 }, { 0, 1, 2879 }, { 0, 1, 2880 }, { 0, 1, 2881 }, { 0, 1, 2882 },
+	{ 0, 1, 2883 }, { 0, 1, 2884 }, { 0, 1, 2885 }, { 0, 1, 2886 }, { 0, 1, 2887 }, { 0, 1, 2888 },
+	{ 0, 1, 2889 }, { 0, 1, 2890 }, { 0, 1, 2891 }, { 0, 1, 2892 }, { 0, 1, 2893 }, { 0, 1, 2894 },
+	{ 0, 1, 2895 }, { 0, 1, 2896 }, { 0, 1, 2897 }, { 0, 1, 2898 }, { 0, 1, 2899 }, { 0, 1, 2900 },
+	{ 0, 1, 2901 }, { 0, 1, 2902 }, { 0, 1, 2903 }, { 0, 1, 2904 }, { 0, 1, 2905 }, { 0, 1, 2906 },
+	{ 0, 1, 2907 }, { 0, 1, 2908 }, { 0, 1, 2909 }, { 0, 1, 2910 }, { 0, 1, 2911 }, { 0, 1, 2912 },
+	{ 0, 1, 2913 }, { 0, 1, 2914 }, { 0, 1, 2915 }, { 0, 1, 2916 }, { 0, 1, 2917 }, { 0, 1, 2918 },
+	{ 0, 1, 2919 }, { 0, 1, 2920 }, { 0, 1, 2921 }, { 0, 1, 2922 }, { 0, 1, 2923 }, { 0, 1, 2924 },
+	{ 0, 1, 2925 }, { 0, 1, 2926 }, { 0, 1, 2927 }, { 0, 1, 2928 }, { 0, 1, 2929 }, { 0, 1, 2930 },
+	{ 0, 1, 2931 }, { 0, 1, 2932 }, { 0, 1, 2933 }, { 0, 1, 2934 }, { 0, 1, 2935 }, { 0, 1, 2936 },
+	{ 0, 1, 2937 }, { 0, 1, 2938 }, { 0, 1, 2939 }, { 0, 1, 2940 }, { 0, 1, 2941 }, { 0, 1, 2942 },
+	{ 0, 1, 2943 }, { 0, 1, 2944 }, { 0, 1, 2945 }, { 0, 1, 2946 }, { 0, 1, 2947 }, { 0, 1, 2948 },
+	{ 0, 1, 2949 }, { 0, 1, 2950 }, { 0, 1, 2951 }, { 0, 1, 2952 }, { 0, 1, 2953 }, { 0, 1, 2954 },
+	{ 0, 1, 2955 }, { 0, 1, 2956 }, { 0, 1, 2957 }, { 0, 1, 2958 }, { 0, 1, 2959 }, { 0, 1, 2960 },
+	{ 0, 1, 2961 }, { 0, 1, 2962 }, { 0, 1, 2963 }, { 0, 1, 2964 }, { 0, 1, 2965 }, { 0, 1, 2966 },
+	{ 0, 1, 2967 }, { 0, 1, 2968 }, { 0, 1, 2969 }, { 0, 1, 2970 }, { 0, 1, 2971 }, { 0, 1, 2972 },
+	{ 0, 1, 2973 }, { 0, 1, 2974 }, { 0, 1, 2975 }, { 0, 1, 2976 }, { 0, 1, 2977 }, { 0, 1, 2978 },
+	{ 0, 1, 2979 }, { 0, 1, 2980 }, { 0, 1, 2981 }, { 0, 1, 2982 }, { 0, 1, 2983 }, { 0, 1, 2984 },
+	{ 0, 1, 2985 }, { 0, 1, 2986 }, { 0, 1, 2987 }, { 0, 1, 2988 }, { 0, 1, 2989 }, { 0, 1, 2990 },
+	{ 0, 1, 2991 }, { 0, 1, 2992 }, { 0, 1, 2993 }, { 0, 1, 2994 }, { 0, 1, 2995 }, { 0, 1, 2996 },
+	{ 0, 1, 2997 }, { 0, 1, 2998 }, { 0, 1, 2999 }, { 0, 1, 3000 }, { 0, 1, 3001 }, { 0, 1, 3002 },
+	{ 0, 1, 3003 }, { 0, 1, 3004 }, { 0, 1, 3005 }, { 0, 1, 3006 }, { 0, 1, 3007 }, { 0, 1, 3008 },
+	{ 0, 1, 3009 }, { 0, 1, 3010 }, { 0, 1, 3011 }, { 0, 1, 3012 }, { 0, 1, 3013 }, { 0, 1, 3014 },
+	{ 0, 1, 3015 }, { 0, 1, 3016 }, { 0, 1, 3017 }, { 0, 1, 3018 }, { 0, 1, 3019 }, { 0, 1, 3020 },
+	{ 0, 1, 3021 }, { 0, 1, 3022 }, { 0, 1, 3023 }, { 0, 1, 3024 }, { 0, 1, 3025 }, { 0, 1, 3026 },
+	{ 0, 1, 3027 }, { 0, 1, 3028 }, { 0, 1, 3029 }, { 0, 1, 3030 }, { 0, 1, 3031 }, { 0, 1, 3032 },
+	{ 0, 1, 3033 }, { 0, 1, 3034 }, { 0, 1, 3035 }, { 0, 1, 3036 }, { 0, 1, 3037 }, { 0, 1, 3038 },
+	{ 0, 1, 3039 }, { 0, 1, 3040 }, { 0, 1, 3041 }, { 0, 1, 3042 }, { 0, 1, 3043 }, { 0, 1, 3044 },
+	{ 0, 1, 3045 }, { 0, 1, 3046 }, { 0, 1, 3047 }, { 0, 1, 3048 }, { 0, 1, 3049 }, { 0, 1, 3050 },
+	{ 0, 1, 3051 }, { 0, 1, 3052 }, { 0, 1, 3053 }, { 0, 1, 3054 }, { 0, 1, 3055 }, { 0, 1, 3056 },
+	{ 0, 1, 3057 }, { 0, 1, 3058 }, { 0, 1, 3059 }, { 0, 1, 3060 }, { 0, 1, 3061 }, { 0, 1, 3062 },
+	{ 0, 1, 3063 }, { 0, 1, 3064 }, { 0, 1, 3065 }, { 0, 1, 3066 }, { 0, 1, 3067 }, { 0, 1, 3068 },
+	{ 0, 1, 3069 }, { 0, 1, 3070 }, { 0, 1, 3071 }, { 0, 1, 3072 }, { 0, 1, 3073 }, { 0, 1, 3074 },
+	{ 0, 1, 3075 }, { 0, 1, 3076 }, { 0, 1, 3077 }, { 0, 1, 3078 }, { 0, 1, 3079 }, { 0, 1, 3080 },
+	{ 0, 1, 3081 }, { 0, 1, 3082 }, { 0, 1, 3083 }, { 0, 1, 3084 }, { 0, 1, 3085 }, { 0, 1, 3086 },
+	{ 0, 1, 3087 }, { 0, 1, 3088 }, { 0, 1, 3089 }, { 0, 1, 3090 }, { 0, 1, 3091 }, { 0, 1, 3092 },
+	{ 0, 1, 3093 }, { 0, 1, 3094 }, { 0, 1, 3095 }, { 0, 1, 3096 }, { 0, 1, 3097 }, { 0, 1, 3098 },
+	{ 0, 1, 3099 }, { 0, 1, 3100 }, { 0, 1, 3101 }, { 0, 1, 3102 }, { 0, 1, 3103 }, { 0, 1, 3104 },
+	{ 0, 1, 3105 }, { 0, 1, 3106 }, { 0, 1, 3107 }, { 0, 1, 3108 }, { 0, 1, 3109 }, { 0, 1, 3110 },
+	{ 0, 1, 3111 }, { 0, 1, 3112 }, { 0, 1, 3113 }, { 0, 1, 3114 }, { 0, 1, 3115 }, { 0, 1, 3116 },
+	{ 0, 1, 3117 }, { 0, 1, 3118 }, { 0, 1, 3119 }, { 0, 1, 3120 }, { 0, 1, 3121 }, { 0, 1, 3122 },
+	{ 0, 1, 3123 }, { 0, 1, 3124 }, { 0, 1, 3125 }, { 0, 1, 3126 }, { 0, 1, 3127 }, { 0, 1, 3128 },
+	{ 0, 1, 3129 }, { 0, 1, 3130 }, { 0, 1, 3131 }, { 0, 1, 3132 }, { 0, 1, 3133 }, { 0, 1, 3134 },
+	{ 0, 1, 3135 }, { 0, 1, 3136 }, { 0, 1, 3137 }, { 0, 1, 3138 }, { 0, 1, 3139 }, { 0, 1, 3140 },
+	{ 0, 1, 3141 }, { 0, 1, 3142 }, { 0, 1, 3143 }, { 0, 1, 3144 }, { 0, 1, 3145 }, { 0, 1, 3146 },
+	{ 0, 1, 3147 }, { 0, 1, 3148 }, { 0, 1, 3149 }, { 0, 1, 3150 }, { 0, 1, 3151 }, { 0, 1, 3152 },
+	{ 0, 1, 3153 }, { 0, 1, 3154 }, { 0, 1, 3155 }, { 0, 1, 3156 }, { 0, 1, 3157 }, { 0, 1, 3158 },
+	{ 0, 1, 3159 }, { 0, 1, 3160 }, { 0, 1, 3161 }, { 0, 1, 3162 }, { 0, 1, 3163 }, { 0, 1, 3164 },
+	{ 0, 1, 3165 }, { 0, 1, 3166 }, { 0, 1, 3167 }, { 0, 1, 3168 }, { 0, 1, 3169 }, { 0, 1, 3170 },
+	{ 0, 1, 3171 }, { 0, 1, 3172 }, { 0, 1, 3173 }, { 0, 1, 3174 }, { 0, 1, 3175 }, { 0, 1, 3176 },
+	{ 0, 1, 3177 }, { 0, 1, 3178 }, { 0, 1, 3179 }, { 0, 1, 3180 }, { 0, 1, 3181 }, { 0, 1, 3182 },
+	{ 0, 1, 3183 }, { 0, 1, 3184 }, { 0, 1, 3185 }, { 0, 1, 3186 }, { 0, 1, 3187 }, { 0, 1, 3188 },
+	{ 0, 1, 3189 }, { 0, 1, 3190 }, { 0, 1, 3191 }, { 0, 1, 3192 }, { 0, 1, 3193 }, { 0, 1, 3194 },
+	{ 0, 1, 3195 }, { 0, 1, 3196 }, { 0, 1, 3197 }, { 0, 1, 3198 }, { 0, 1, 3199 }, { 0, 1, 3200 },
+	{ 0, 1, 3201 }, { 0, 1, 3202 }, { 0, 1, 3203 }, { 0, 1, 3204 }, { 0, 1, 3205 }, { 0, 1, 3206 },
+	{ 0, 1, 3207 }, { 0, 1, 3208 }, { 0, 1, 3209 }, { 0, 1, 3210 }, { 0, 1, 3211 }, { 0, 1, 3212 },
+	{ 0, 1, 3213 }, { 0, 1, 3214 }, { 0, 1, 3215 }, { 0, 1, 3216 }, { 0, 1, 3217 }, { 0, 1, 3218 },
+	{ 0, 1, 3219 }, { 0, 1, 3220 }, { 0, 1, 3221 }, { 0, 1, 3222 }, { 0, 1, 3223 }, { 0, 1, 3224 },
+	{ 0, 1, 3225 }, { 0, 1, 3226 }, { 0, 1, 3227 }, { 0, 1, 3228 }, { 0, 1, 3229 }, { 0, 1, 3230 },
+	{ 0, 1, 3231 }, { 0, 1, 3232 }, { 0, 1, 3233 }, { 0, 1, 3234 }, { 0, 1, 3235 }, { 0, 1, 3236 },
+	{ 0, 1, 3237 }, { 0, 1, 3238 }, { 0, 1, 3239 }, { 0, 1, 3240 }, { 0, 1, 3241 }, { 0, 1, 3242 },
+	{ 0, 1, 3243 }, { 0, 1, 3244 }, { 0, 1, 3245 }, { 0, 1, 3246 }, { 0, 1, 3247 }, { 0, 1, 3248 },
+	{ 0, 1, 3249 }, { 0, 1, 3250 }, { 0, 1, 3251 }, { 0, 1, 3252 }, { 0, 1, 3253 }, { 0, 1, 3254 },
+	{ 0, 1, 3255 }, { 0, 1, 3256 }, { 0, 1, 3257 }, { 0, 1, 3258 }, { 0, 1, 3259 }, { 0, 1, 3260 },
+	{ 0, 1, 3261 }, { 0, 1, 3262 }, { 0, 1, 3263 }, { 0, 1, 3264 }, { 0, 1, 3265 }, { 0, 1, 3266 },
+	{ 0, 1, 3267 }
+};
+
+static const uint32_t g_nfcDecomp[3268] =
+{
+	0x00041, 0x00300, 0x00041, 0x00301, 0x00041, 0x00302, 0x00041, 0x00303, 0x00041, 0x00308,
+	0x00041, 0x0030A, 0x00043, 0x00327, 0x00045, 0x00300, 0x00045, 0x00301, 0x00045, 0x00302,
+	0x00045, 0x00308, 0x00049, 0x00300, 0x00049, 0x00301, 0x00049, 0x00302, 0x00049, 0x00308,
+	0x0004E, 0x00303, 0x0004F, 0x00300, 0x0004F, 0x00301, 0x0004F, 0x00302, 0x0004F, 0x00303,
+	0x0004F, 0x00308, 0x00055, 0x00300, 0x00055, 0x00301, 0x00055, 0x00302, 0x00055, 0x00308,
+	0x00059, 0x00301, 0x00061, 0x00300, 0x00061, 0x00301, 0x00061, 0x00302, 0x00061, 0x00303,
+	0x00061, 0x00308, 0x00061, 0x0030A, 0x00063, 0x00327, 0x00065, 0x00300, 0x00065, 0x00301,
+	0x00065, 0x00302, 0x00065, 0x00308, 0x00069, 0x00300, 0x00069, 0x00301, 0x00069, 0x00302,
+	0x00069, 0x00308, 0x0006E, 0x00303, 0x0006F, 0x00300, 0x0006F, 0x00301, 0x0006F, 0x00302,
+	0x0006F, 0x00303, 0x0006F, 0x00308, 0x00075, 0x00300, 0x00075, 0x00301, 0x00075, 0x00302,
+	0x00075, 0x00308, 0x00079, 0x00301, 0x00079, 0x00308, 0x00041, 0x00304, 0x00061, 0x00304,
+	0x00041, 0x00306, 0x00061, 0x00306, 0x00041, 0x00328, 0x00061, 0x00328, 0x00043, 0x00301,
+	0x00063, 0x00301, 0x00043, 0x00302, 0x00063, 0x00302, 0x00043, 0x00307, 0x00063, 0x00307,
+	0x00043, 0x0030C, 0x00063, 0x0030C, 0x00044, 0x0030C, 0x00064, 0x0030C, 0x00045, 0x00304,
+	0x00065, 0x00304, 0x00045, 0x00306, 0x00065, 0x00306, 0x00045, 0x00307, 0x00065, 0x00307,
+	0x00045, 0x00328, 0x00065, 0x00328, 0x00045, 0x0030C, 0x00065, 0x0030C, 0x00047, 0x00302,
+	0x00067, 0x00302, 0x00047, 0x00306, 0x00067, 0x00306, 0x00047, 0x00307, 0x00067, 0x00307,
+	0x00047, 0x00327, 0x00067, 0x00327, 0x00048, 0x00302, 0x00068, 0x00302, 0x00049, 0x00303,
+	0x00069, 0x00303, 0x00049, 0x00304, 0x00069, 0x00304, 0x00049, 0x00306, 0x00069, 0x00306,
+	0x00049, 0x00328, 0x00069, 0x00328, 0x00049, 0x00307, 0x0004A, 0x00302, 0x0006A, 0x00302,
+	0x0004B, 0x00327, 0x0006B, 0x00327, 0x0004C, 0x00301, 0x0006C, 0x00301, 0x0004C, 0x00327,
+	0x0006C, 0x00327, 0x0004C, 0x0030C, 0x0006C, 0x0030C, 0x0004E, 0x00301, 0x0006E, 0x00301,
+	0x0004E, 0x00327, 0x0006E, 0x00327, 0x0004E, 0x0030C, 0x0006E, 0x0030C, 0x0004F, 0x00304,
+	0x0006F, 0x00304, 0x0004F, 0x00306, 0x0006F, 0x00306, 0x0004F, 0x0030B, 0x0006F, 0x0030B,
+	0x00052, 0x00301, 0x00072, 0x00301, 0x00052, 0x00327, 0x00072, 0x00327, 0x00052, 0x0030C,
+	0x00072, 0x0030C, 0x00053, 0x00301, 0x00073, 0x00301, 0x00053, 0x00302, 0x00073, 0x00302,
+	0x00053, 0x00327, 0x00073, 0x00327, 0x00053, 0x0030C, 0x00073, 0x0030C, 0x00054, 0x00327,
+	0x00074, 0x00327, 0x00054, 0x0030C, 0x00074, 0x0030C, 0x00055, 0x00303, 0x00075, 0x00303,
+	0x00055, 0x00304, 0x00075, 0x00304, 0x00055, 0x00306, 0x00075, 0x00306, 0x00055, 0x0030A,
+	0x00075, 0x0030A, 0x00055, 0x0030B, 0x00075, 0x0030B, 0x00055, 0x00328, 0x00075, 0x00328,
+	0x00057, 0x00302, 0x00077, 0x00302, 0x00059, 0x00302, 0x00079, 0x00302, 0x00059, 0x00308,
+	0x0005A, 0x00301, 0x0007A, 0x00301, 0x0005A, 0x00307, 0x0007A, 0x00307, 0x0005A, 0x0030C,
+	0x0007A, 0x0030C, 0x0004F, 0x0031B, 0x0006F, 0x0031B, 0x00055, 0x0031B, 0x00075, 0x0031B,
+	0x00041, 0x0030C, 0x00061, 0x0030C, 0x00049, 0x0030C, 0x00069, 0x0030C, 0x0004F, 0x0030C,
+	0x0006F, 0x0030C, 0x00055, 0x0030C, 0x00075, 0x0030C, 0x00055, 0x00308, 0x00304, 0x00075,
+	0x00308, 0x00304, 0x00055, 0x00308, 0x00301, 0x00075, 0x00308, 0x00301, 0x00055, 0x00308,
+	0x0030C, 0x00075, 0x00308, 0x0030C, 0x00055, 0x00308, 0x00300, 0x00075, 0x00308, 0x00300,
+	0x00041, 0x00308, 0x00304, 0x00061, 0x00308, 0x00304, 0x00041, 0x00307, 0x00304, 0x00061,
+	0x00307, 0x00304, 0x000C6, 0x00304, 0x000E6, 0x00304, 0x00047, 0x0030C, 0x00067, 0x0030C,
+	0x0004B, 0x0030C, 0x0006B, 0x0030C, 0x0004F, 0x00328, 0x0006F, 0x00328, 0x0004F, 0x00328,
+	0x00304, 0x0006F, 0x00328, 0x00304, 0x001B7, 0x0030C, 0x00292, 0x0030C, 0x0006A, 0x0030C,
+	0x00047, 0x00301, 0x00067, 0x00301, 0x0004E, 0x00300, 0x0006E, 0x00300, 0x00041, 0x0030A,
+	0x00301, 0x00061, 0x0030A, 0x00301, 0x000C6, 0x00301, 0x000E6, 0x00301, 0x000D8, 0x00301,
+	0x000F8, 0x00301, 0x00041, 0x0030F, 0x00061, 0x0030F, 0x00041, 0x00311, 0x00061, 0x00311,
+	0x00045, 0x0030F, 0x00065, 0x0030F, 0x00045, 0x00311, 0x00065, 0x00311, 0x00049, 0x0030F,
+	0x00069, 0x0030F, 0x00049, 0x00311, 0x00069, 0x00311, 0x0004F, 0x0030F, 0x0006F, 0x0030F,
+	0x0004F, 0x00311, 0x0006F, 0x00311, 0x00052, 0x0030F, 0x00072, 0x0030F, 0x00052, 0x00311,
+	0x00072, 0x00311, 0x00055, 0x0030F, 0x00075, 0x0030F, 0x00055, 0x00311, 0x00075, 0x00311,
+	0x00053, 0x00326, 0x00073, 0x00326, 0x00054, 0x00326, 0x00074, 0x00326, 0x00048, 0x0030C,
+	0x00068, 0x0030C, 0x00041, 0x00307, 0x00061, 0x00307, 0x00045, 0x00327, 0x00065, 0x00327,
+	0x0004F, 0x00308, 0x00304, 0x0006F, 0x00308, 0x00304, 0x0004F, 0x00303, 0x00304, 0x0006F,
+	0x00303, 0x00304, 0x0004F, 0x00307, 0x0006F, 0x00307, 0x0004F, 0x00307, 0x00304, 0x0006F,
+	0x00307, 0x00304, 0x00059, 0x00304, 0x00079, 0x00304, 0x00300, 0x00301, 0x00313, 0x00308,
+	0x00301, 0x002B9, 0x0003B, 0x000A8, 0x00301, 0x00391, 0x00301, 0x000B7, 0x00395, 0x00301,
+	0x00397, 0x00301, 0x00399, 0x00301, 0x0039F, 0x00301, 0x003A5, 0x00301, 0x003A9, 0x00301,
+	0x003B9, 0x00308, 0x00301, 0x00399, 0x00308, 0x003A5, 0x00308, 0x003B1, 0x00301, 0x003B5,
+	0x00301, 0x003B7, 0x00301, 0x003B9, 0x00301, 0x003C5, 0x00308, 0x00301, 0x003B9, 0x00308,
+	0x003C5, 0x00308, 0x003BF, 0x00301, 0x003C5, 0x00301, 0x003C9, 0x00301, 0x003D2, 0x00301,
+	0x003D2, 0x00308, 0x00415, 0x00300, 0x00415, 0x00308, 0x00413, 0x00301, 0x00406, 0x00308,
+	0x0041A, 0x00301, 0x00418, 0x00300, 0x00423, 0x00306, 0x00418, 0x00306, 0x00438, 0x00306,
+	0x00435, 0x00300, 0x00435, 0x00308, 0x00433, 0x00301, 0x00456, 0x00308, 0x0043A, 0x00301,
+	0x00438, 0x00300, 0x00443, 0x00306, 0x00474, 0x0030F, 0x00475, 0x0030F, 0x00416, 0x00306,
+	0x00436, 0x00306, 0x00410, 0x00306, 0x00430, 0x00306, 0x00410, 0x00308, 0x00430, 0x00308,
+	0x00415, 0x00306, 0x00435, 0x00306, 0x004D8, 0x00308, 0x004D9, 0x00308, 0x00416, 0x00308,
+	0x00436, 0x00308, 0x00417, 0x00308, 0x00437, 0x00308, 0x00418, 0x00304, 0x00438, 0x00304,
+	0x00418, 0x00308, 0x00438, 0x00308, 0x0041E, 0x00308, 0x0043E, 0x00308, 0x004E8, 0x00308,
+	0x004E9, 0x00308, 0x0042D, 0x00308, 0x0044D, 0x00308, 0x00423, 0x00304, 0x00443, 0x00304,
+	0x00423, 0x00308, 0x00443, 0x00308, 0x00423, 0x0030B, 0x00443, 0x0030B, 0x00427, 0x00308,
+	0x00447, 0x00308, 0x0042B, 0x00308, 0x0044B, 0x00308, 0x00627, 0x00653, 0x00627, 0x00654,
+	0x00648, 0x00654, 0x00627, 0x00655, 0x0064A, 0x00654, 0x006D5, 0x00654, 0x006C1, 0x00654,
+	0x006D2, 0x00654, 0x00928, 0x0093C, 0x00930, 0x0093C, 0x00933, 0x0093C, 0x00915, 0x0093C,
+	0x00916, 0x0093C, 0x00917, 0x0093C, 0x0091C, 0x0093C, 0x00921, 0x0093C, 0x00922, 0x0093C,
+	0x0092B, 0x0093C, 0x0092F, 0x0093C, 0x009C7, 0x009BE, 0x009C7, 0x009D7, 0x009A1, 0x009BC,
+	0x009A2, 0x009BC, 0x009AF, 0x009BC, 0x00A32, 0x00A3C, 0x00A38, 0x00A3C, 0x00A16, 0x00A3C,
+	0x00A17, 0x00A3C, 0x00A1C, 0x00A3C, 0x00A2B, 0x00A3C, 0x00B47, 0x00B56, 0x00B47, 0x00B3E,
+	0x00B47, 0x00B57, 0x00B21, 0x00B3C, 0x00B22, 0x00B3C, 0x00B92, 0x00BD7, 0x00BC6, 0x00BBE,
+	0x00BC7, 0x00BBE, 0x00BC6, 0x00BD7, 0x00C46, 0x00C56, 0x00CBF, 0x00CD5, 0x00CC6, 0x00CD5,
+	0x00CC6, 0x00CD6, 0x00CC6, 0x00CC2, 0x00CC6, 0x00CC2, 0x00CD5, 0x00D46, 0x00D3E, 0x00D47,
+	0x00D3E, 0x00D46, 0x00D57, 0x00DD9, 0x00DCA, 0x00DD9, 0x00DCF, 0x00DD9, 0x00DCF, 0x00DCA,
+	0x00DD9, 0x00DDF, 0x00F42, 0x00FB7, 0x00F4C, 0x00FB7, 0x00F51, 0x00FB7, 0x00F56, 0x00FB7,
+	0x00F5B, 0x00FB7, 0x00F40, 0x00FB5, 0x00F71, 0x00F72, 0x00F71, 0x00F74, 0x00FB2, 0x00F80,
+	0x00FB3, 0x00F80, 0x00F71, 0x00F80, 0x00F92, 0x00FB7, 0x00F9C, 0x00FB7, 0x00FA1, 0x00FB7,
+	0x00FA6, 0x00FB7, 0x00FAB, 0x00FB7, 0x00F90, 0x00FB5, 0x01025, 0x0102E, 0x01B05, 0x01B35,
+	0x01B07, 0x01B35, 0x01B09, 0x01B35, 0x01B0B, 0x01B35, 0x01B0D, 0x01B35, 0x01B11, 0x01B35,
+	0x01B3A, 0x01B35, 0x01B3C, 0x01B35, 0x01B3E, 0x01B35, 0x01B3F, 0x01B35, 0x01B42, 0x01B35,
+	0x00041, 0x00325, 0x00061, 0x00325, 0x00042, 0x00307, 0x00062, 0x00307, 0x00042, 0x00323,
+	0x00062, 0x00323, 0x00042, 0x00331, 0x00062, 0x00331, 0x00043, 0x00327, 0x00301, 0x00063,
+	0x00327, 0x00301, 0x00044, 0x00307, 0x00064, 0x00307, 0x00044, 0x00323, 0x00064, 0x00323,
+	0x00044, 0x00331, 0x00064, 0x00331, 0x00044, 0x00327, 0x00064, 0x00327, 0x00044, 0x0032D,
+	0x00064, 0x0032D, 0x00045, 0x00304, 0x00300, 0x00065, 0x00304, 0x00300, 0x00045, 0x00304,
+	0x00301, 0x00065, 0x00304, 0x00301, 0x00045, 0x0032D, 0x00065, 0x0032D, 0x00045, 0x00330,
+	0x00065, 0x00330, 0x00045, 0x00327, 0x00306, 0x00065, 0x00327, 0x00306, 0x00046, 0x00307,
+	0x00066, 0x00307, 0x00047, 0x00304, 0x00067, 0x00304, 0x00048, 0x00307, 0x00068, 0x00307,
+	0x00048, 0x00323, 0x00068, 0x00323, 0x00048, 0x00308, 0x00068, 0x00308, 0x00048, 0x00327,
+	0x00068, 0x00327, 0x00048, 0x0032E, 0x00068, 0x0032E, 0x00049, 0x00330, 0x00069, 0x00330,
+	0x00049, 0x00308, 0x00301, 0x00069, 0x00308, 0x00301, 0x0004B, 0x00301, 0x0006B, 0x00301,
+	0x0004B, 0x00323, 0x0006B, 0x00323, 0x0004B, 0x00331, 0x0006B, 0x00331, 0x0004C, 0x00323,
+	0x0006C, 0x00323, 0x0004C, 0x00323, 0x00304, 0x0006C, 0x00323, 0x00304, 0x0004C, 0x00331,
+	0x0006C, 0x00331, 0x0004C, 0x0032D, 0x0006C, 0x0032D, 0x0004D, 0x00301, 0x0006D, 0x00301,
+	0x0004D, 0x00307, 0x0006D, 0x00307, 0x0004D, 0x00323, 0x0006D, 0x00323, 0x0004E, 0x00307,
+	0x0006E, 0x00307, 0x0004E, 0x00323, 0x0006E, 0x00323, 0x0004E, 0x00331, 0x0006E, 0x00331,
+	0x0004E, 0x0032D, 0x0006E, 0x0032D, 0x0004F, 0x00303, 0x00301, 0x0006F, 0x00303, 0x00301,
+	0x0004F, 0x00303, 0x00308, 0x0006F, 0x00303, 0x00308, 0x0004F, 0x00304, 0x00300, 0x0006F,
+	0x00304, 0x00300, 0x0004F, 0x00304, 0x00301, 0x0006F, 0x00304, 0x00301, 0x00050, 0x00301,
+	0x00070, 0x00301, 0x00050, 0x00307, 0x00070, 0x00307, 0x00052, 0x00307, 0x00072, 0x00307,
+	0x00052, 0x00323, 0x00072, 0x00323, 0x00052, 0x00323, 0x00304, 0x00072, 0x00323, 0x00304,
+	0x00052, 0x00331, 0x00072, 0x00331, 0x00053, 0x00307, 0x00073, 0x00307, 0x00053, 0x00323,
+	0x00073, 0x00323, 0x00053, 0x00301, 0x00307, 0x00073, 0x00301, 0x00307, 0x00053, 0x0030C,
+	0x00307, 0x00073, 0x0030C, 0x00307, 0x00053, 0x00323, 0x00307, 0x00073, 0x00323, 0x00307,
+	0x00054, 0x00307, 0x00074, 0x00307, 0x00054, 0x00323, 0x00074, 0x00323, 0x00054, 0x00331,
+	0x00074, 0x00331, 0x00054, 0x0032D, 0x00074, 0x0032D, 0x00055, 0x00324, 0x00075, 0x00324,
+	0x00055, 0x00330, 0x00075, 0x00330, 0x00055, 0x0032D, 0x00075, 0x0032D, 0x00055, 0x00303,
+	0x00301, 0x00075, 0x00303, 0x00301, 0x00055, 0x00304, 0x00308, 0x00075, 0x00304, 0x00308,
+	0x00056, 0x00303, 0x00076, 0x00303, 0x00056, 0x00323, 0x00076, 0x00323, 0x00057, 0x00300,
+	0x00077, 0x00300, 0x00057, 0x00301, 0x00077, 0x00301, 0x00057, 0x00308, 0x00077, 0x00308,
+	0x00057, 0x00307, 0x00077, 0x00307, 0x00057, 0x00323, 0x00077, 0x00323, 0x00058, 0x00307,
+	0x00078, 0x00307, 0x00058, 0x00308, 0x00078, 0x00308, 0x00059, 0x00307, 0x00079, 0x00307,
+	0x0005A, 0x00302, 0x0007A, 0x00302, 0x0005A, 0x00323, 0x0007A, 0x00323, 0x0005A, 0x00331,
+	0x0007A, 0x00331, 0x00068, 0x00331, 0x00074, 0x00308, 0x00077, 0x0030A, 0x00079, 0x0030A,
+	0x0017F, 0x00307, 0x00041, 0x00323, 0x00061, 0x00323, 0x00041, 0x00309, 0x00061, 0x00309,
+	0x00041, 0x00302, 0x00301, 0x00061, 0x00302, 0x00301, 0x00041, 0x00302, 0x00300, 0x00061,
+	0x00302, 0x00300, 0x00041, 0x00302, 0x00309, 0x00061, 0x00302, 0x00309, 0x00041, 0x00302,
+	0x00303, 0x00061, 0x00302, 0x00303, 0x00041, 0x00323, 0x00302, 0x00061, 0x00323, 0x00302,
+	0x00041, 0x00306, 0x00301, 0x00061, 0x00306, 0x00301, 0x00041, 0x00306, 0x00300, 0x00061,
+	0x00306, 0x00300, 0x00041, 0x00306, 0x00309, 0x00061, 0x00306, 0x00309, 0x00041, 0x00306,
+	0x00303, 0x00061, 0x00306, 0x00303, 0x00041, 0x00323, 0x00306, 0x00061, 0x00323, 0x00306,
+	0x00045, 0x00323, 0x00065, 0x00323, 0x00045, 0x00309, 0x00065, 0x00309, 0x00045, 0x00303,
+	0x00065, 0x00303, 0x00045, 0x00302, 0x00301, 0x00065, 0x00302, 0x00301, 0x00045, 0x00302,
+	0x00300, 0x00065, 0x00302, 0x00300, 0x00045, 0x00302, 0x00309, 0x00065, 0x00302, 0x00309,
+	0x00045, 0x00302, 0x00303, 0x00065, 0x00302, 0x00303, 0x00045, 0x00323, 0x00302, 0x00065,
+	0x00323, 0x00302, 0x00049, 0x00309, 0x00069, 0x00309, 0x00049, 0x00323, 0x00069, 0x00323,
+	0x0004F, 0x00323, 0x0006F, 0x00323, 0x0004F, 0x00309, 0x0006F, 0x00309, 0x0004F, 0x00302,
+	0x00301, 0x0006F, 0x00302, 0x00301, 0x0004F, 0x00302, 0x00300, 0x0006F, 0x00302, 0x00300,
+	0x0004F, 0x00302, 0x00309, 0x0006F, 0x00302, 0x00309, 0x0004F, 0x00302, 0x00303, 0x0006F,
+	0x00302, 0x00303, 0x0004F, 0x00323, 0x00302, 0x0006F, 0x00323, 0x00302, 0x0004F, 0x0031B,
+	0x00301, 0x0006F, 0x0031B, 0x00301, 0x0004F, 0x0031B, 0x00300, 0x0006F, 0x0031B, 0x00300,
+	0x0004F, 0x0031B, 0x00309, 0x0006F, 0x0031B, 0x00309, 0x0004F, 0x0031B, 0x00303, 0x0006F,
+	0x0031B, 0x00303, 0x0004F, 0x0031B, 0x00323, 0x0006F, 0x0031B, 0x00323, 0x00055, 0x00323,
+	0x00075, 0x00323, 0x00055, 0x00309, 0x00075, 0x00309, 0x00055, 0x0031B, 0x00301, 0x00075,
+	0x0031B, 0x00301, 0x00055, 0x0031B, 0x00300, 0x00075, 0x0031B, 0x00300, 0x00055, 0x0031B,
+	0x00309, 0x00075, 0x0031B, 0x00309, 0x00055, 0x0031B, 0x00303, 0x00075, 0x0031B, 0x00303,
+	0x00055, 0x0031B, 0x00323, 0x00075, 0x0031B, 0x00323, 0x00059, 0x00300, 0x00079, 0x00300,
+	0x00059, 0x00323, 0x00079, 0x00323, 0x00059, 0x00309, 0x00079, 0x00309, 0x00059, 0x00303,
+	0x00079, 0x00303, 0x003B1, 0x00313, 0x003B1, 0x00314, 0x003B1, 0x00313, 0x00300, 0x003B1,
+	0x00314, 0x00300, 0x003B1, 0x00313, 0x00301, 0x003B1, 0x00314, 0x00301, 0x003B1, 0x00313,
+	0x00342, 0x003B1, 0x00314, 0x00342, 0x00391, 0x00313, 0x00391, 0x00314, 0x00391, 0x00313,
+	0x00300, 0x00391, 0x00314, 0x00300, 0x00391, 0x00313, 0x00301, 0x00391, 0x00314, 0x00301,
+	0x00391, 0x00313, 0x00342, 0x00391, 0x00314, 0x00342, 0x003B5, 0x00313, 0x003B5, 0x00314,
+	0x003B5, 0x00313, 0x00300, 0x003B5, 0x00314, 0x00300, 0x003B5, 0x00313, 0x00301, 0x003B5,
+	0x00314, 0x00301, 0x00395, 0x00313, 0x00395, 0x00314, 0x00395, 0x00313, 0x00300, 0x00395,
+	0x00314, 0x00300, 0x00395, 0x00313, 0x00301, 0x00395, 0x00314, 0x00301, 0x003B7, 0x00313,
+	0x003B7, 0x00314, 0x003B7, 0x00313, 0x00300, 0x003B7, 0x00314, 0x00300, 0x003B7, 0x00313,
+	0x00301, 0x003B7, 0x00314, 0x00301, 0x003B7, 0x00313, 0x00342, 0x003B7, 0x00314, 0x00342,
+	0x00397, 0x00313, 0x00397, 0x00314, 0x00397, 0x00313, 0x00300, 0x00397, 0x00314, 0x00300,
+	0x00397, 0x00313, 0x00301, 0x00397, 0x00314, 0x00301, 0x00397, 0x00313, 0x00342, 0x00397,
+	0x00314, 0x00342, 0x003B9, 0x00313, 0x003B9, 0x00314, 0x003B9, 0x00313, 0x00300, 0x003B9,
+	0x00314, 0x00300, 0x003B9, 0x00313, 0x00301, 0x003B9, 0x00314, 0x00301, 0x003B9, 0x00313,
+	0x00342, 0x003B9, 0x00314, 0x00342, 0x00399, 0x00313, 0x00399, 0x00314, 0x00399, 0x00313,
+	0x00300, 0x00399, 0x00314, 0x00300, 0x00399, 0x00313, 0x00301, 0x00399, 0x00314, 0x00301,
+	0x00399, 0x00313, 0x00342, 0x00399, 0x00314, 0x00342, 0x003BF, 0x00313, 0x003BF, 0x00314,
+	0x003BF, 0x00313, 0x00300, 0x003BF, 0x00314, 0x00300, 0x003BF, 0x00313, 0x00301, 0x003BF,
+	0x00314, 0x00301, 0x0039F, 0x00313, 0x0039F, 0x00314, 0x0039F, 0x00313, 0x00300, 0x0039F,
+	0x00314, 0x00300, 0x0039F, 0x00313, 0x00301, 0x0039F, 0x00314, 0x00301, 0x003C5, 0x00313,
+	0x003C5, 0x00314, 0x003C5, 0x00313, 0x00300, 0x003C5, 0x00314, 0x00300, 0x003C5, 0x00313,
+	0x00301, 0x003C5, 0x00314, 0x00301, 0x003C5, 0x00313, 0x00342, 0x003C5, 0x00314, 0x00342,
+	0x003A5, 0x00314, 0x003A5, 0x00314, 0x00300, 0x003A5, 0x00314, 0x00301, 0x003A5, 0x00314,
+	0x00342, 0x003C9, 0x00313, 0x003C9, 0x00314, 0x003C9, 0x00313, 0x00300, 0x003C9, 0x00314,
+	0x00300, 0x003C9, 0x00313, 0x00301, 0x003C9, 0x00314, 0x00301, 0x003C9, 0x00313, 0x00342,
+	0x003C9, 0x00314, 0x00342, 0x003A9, 0x00313, 0x003A9, 0x00314, 0x003A9, 0x00313, 0x00300,
+	0x003A9, 0x00314, 0x00300, 0x003A9, 0x00313, 0x00301, 0x003A9, 0x00314, 0x00301, 0x003A9,
+	0x00313, 0x00342, 0x003A9, 0x00314, 0x00342, 0x003B1, 0x00300, 0x003B5, 0x00300, 0x003B7,
+	0x00300, 0x003B9, 0x00300, 0x003BF, 0x00300, 0x003C5, 0x00300, 0x003C9, 0x00300, 0x003B1,
+	0x00313, 0x00345, 0x003B1, 0x00314, 0x00345, 0x003B1, 0x00313, 0x00300, 0x00345, 0x003B1,
+	0x00314, 0x00300, 0x00345, 0x003B1, 0x00313, 0x00301, 0x00345, 0x003B1, 0x00314, 0x00301,
+	0x00345, 0x003B1, 0x00313, 0x00342, 0x00345, 0x003B1, 0x00314, 0x00342, 0x00345, 0x00391,
+	0x00313, 0x00345, 0x00391, 0x00314, 0x00345, 0x00391, 0x00313, 0x00300, 0x00345, 0x00391,
+	0x00314, 0x00300, 0x00345, 0x00391, 0x00313, 0x00301, 0x00345, 0x00391, 0x00314, 0x00301,
+	0x00345, 0x00391, 0x00313, 0x00342, 0x00345, 0x00391, 0x00314, 0x00342, 0x00345, 0x003B7,
+	0x00313, 0x00345, 0x003B7, 0x00314, 0x00345, 0x003B7, 0x00313, 0x00300, 0x00345, 0x003B7,
+	0x00314, 0x00300, 0x00345, 0x003B7, 0x00313, 0x00301, 0x00345, 0x003B7, 0x00314, 0x00301,
+	0x00345, 0x003B7, 0x00313, 0x00342, 0x00345, 0x003B7, 0x00314, 0x00342, 0x00345, 0x00397,
+	0x00313, 0x00345, 0x00397, 0x00314, 0x00345, 0x00397, 0x00313, 0x00300, 0x00345, 0x00397,
+	0x00314, 0x00300, 0x00345, 0x00397, 0x00313, 0x00301, 0x00345, 0x00397, 0x00314, 0x00301,
+	0x00345, 0x00397, 0x00313, 0x00342, 0x00345, 0x00397, 0x00314, 0x00342, 0x00345, 0x003C9,
+	0x00313, 0x00345, 0x003C9, 0x00314, 0x00345, 0x003C9, 0x00313, 0x00300, 0x00345, 0x003C9,
+	0x00314, 0x00300, 0x00345, 0x003C9, 0x00313, 0x00301, 0x00345, 0x003C9, 0x00314, 0x00301,
+	0x00345, 0x003C9, 0x00313, 0x00342, 0x00345, 0x003C9, 0x00314, 0x00342, 0x00345, 0x003A9,
+	0x00313, 0x00345, 0x003A9, 0x00314, 0x00345, 0x003A9, 0x00313, 0x00300, 0x00345, 0x003A9,
+	0x00314, 0x00300, 0x00345, 0x003A9, 0x00313, 0x00301, 0x00345, 0x003A9, 0x00314, 0x00301,
+	0x00345, 0x003A9, 0x00313, 0x00342, 0x00345, 0x003A9, 0x00314, 0x00342, 0x00345, 0x003B1,
+	0x00306, 0x003B1, 0x00304, 0x003B1, 0x00300, 0x00345, 0x003B1, 0x00345, 0x003B1, 0x00301,
+	0x00345, 0x003B1, 0x00342, 0x003B1, 0x00342, 0x00345, 0x00391, 0x00306, 0x00391, 0x00304,
+	0x00391, 0x00300, 0x00391, 0x00345, 0x003B9, 0x000A8, 0x00342, 0x003B7, 0x00300, 0x00345,
+	0x003B7, 0x00345, 0x003B7, 0x00301, 0x00345, 0x003B7, 0x00342, 0x003B7, 0x00342, 0x00345,
+	0x00395, 0x00300, 0x00397, 0x00300, 0x00397, 0x00345, 0x01FBF, 0x00300, 0x01FBF, 0x00301,
+	0x01FBF, 0x00342, 0x003B9, 0x00306, 0x003B9, 0x00304, 0x003B9, 0x00308, 0x00300, 0x003B9,
+	0x00342, 0x003B9, 0x00308, 0x00342, 0x00399, 0x00306, 0x00399, 0x00304, 0x00399, 0x00300,
+	0x01FFE, 0x00300, 0x01FFE, 0x00301, 0x01FFE, 0x00342, 0x003C5, 0x00306, 0x003C5, 0x00304,
+	0x003C5, 0x00308, 0x00300, 0x003C1, 0x00313, 0x003C1, 0x00314, 0x003C5, 0x00342, 0x003C5,
+	0x00308, 0x00342, 0x003A5, 0x00306, 0x003A5, 0x00304, 0x003A5, 0x00300, 0x003A1, 0x00314,
+	0x000A8, 0x00300, 0x00060, 0x003C9, 0x00300, 0x00345, 0x003C9, 0x00345, 0x003C9, 0x00301,
+	0x00345, 0x003C9, 0x00342, 0x003C9, 0x00342, 0x00345, 0x0039F, 0x00300, 0x003A9, 0x00300,
+	0x003A9, 0x00345, 0x000B4, 0x02002, 0x02003, 0x003A9, 0x0004B, 0x02190, 0x00338, 0x02192,
+	0x00338, 0x02194, 0x00338, 0x021D0, 0x00338, 0x021D4, 0x00338, 0x021D2, 0x00338, 0x02203,
+	0x00338, 0x02208, 0x00338, 0x0220B, 0x00338, 0x02223, 0x00338, 0x02225, 0x00338, 0x0223C,
+	0x00338, 0x02243, 0x00338, 0x02245, 0x00338, 0x02248, 0x00338, 0x0003D, 0x00338, 0x02261,
+	0x00338, 0x0224D, 0x00338, 0x0003C, 0x00338, 0x0003E, 0x00338, 0x02264, 0x00338, 0x02265,
+	0x00338, 0x02272, 0x00338, 0x02273, 0x00338, 0x02276, 0x00338, 0x02277, 0x00338, 0x0227A,
+	0x00338, 0x0227B, 0x00338, 0x02282, 0x00338, 0x02283, 0x00338, 0x02286, 0x00338, 0x02287,
+	0x00338, 0x022A2, 0x00338, 0x022A8, 0x00338, 0x022A9, 0x00338, 0x022AB, 0x00338, 0x0227C,
+	0x00338, 0x0227D, 0x00338, 0x02291, 0x00338, 0x02292, 0x00338, 0x022B2, 0x00338, 0x022B3,
+	0x00338, 0x022B4, 0x00338, 0x022B5, 0x00338, 0x03008, 0x03009, 0x02ADD, 0x00338, 0x0304B,
+	0x03099, 0x0304D, 0x03099, 0x0304F, 0x03099, 0x03051, 0x03099, 0x03053, 0x03099, 0x03055,
+	0x03099, 0x03057, 0x03099, 0x03059, 0x03099, 0x0305B, 0x03099, 0x0305D, 0x03099, 0x0305F,
+	0x03099, 0x03061, 0x03099, 0x03064, 0x03099, 0x03066, 0x03099, 0x03068, 0x03099, 0x0306F,
+	0x03099, 0x0306F, 0x0309A, 0x03072, 0x03099, 0x03072, 0x0309A, 0x03075, 0x03099, 0x03075,
+	0x0309A, 0x03078, 0x03099, 0x03078, 0x0309A, 0x0307B, 0x03099, 0x0307B, 0x0309A, 0x03046,
+	0x03099, 0x0309D, 0x03099, 0x030AB, 0x03099, 0x030AD, 0x03099, 0x030AF, 0x03099, 0x030B1,
+	0x03099, 0x030B3, 0x03099, 0x030B5, 0x03099, 0x030B7, 0x03099, 0x030B9, 0x03099, 0x030BB,
+	0x03099, 0x030BD, 0x03099, 0x030BF, 0x03099, 0x030C1, 0x03099, 0x030C4, 0x03099, 0x030C6,
+	0x03099, 0x030C8, 0x03099, 0x030CF, 0x03099, 0x030CF, 0x0309A, 0x030D2, 0x03099, 0x030D2,
+	0x0309A, 0x030D5, 0x03099, 0x030D5, 0x0309A, 0x030D8, 0x03099, 0x030D8, 0x0309A, 0x030DB,
+	0x03099, 0x030DB, 0x0309A, 0x030A6, 0x03099, 0x030EF, 0x03099, 0x030F0, 0x03099, 0x030F1,
+	0x03099, 0x030F2, 0x03099, 0x030FD, 0x03099, 0x08C48, 0x066F4, 0x08ECA, 0x08CC8, 0x06ED1,
+	0x04E32, 0x053E5, 0x09F9C, 0x05951, 0x091D1, 0x05587, 0x05948, 0x061F6, 0x07669, 0x07F85,
+	0x0863F, 0x087BA, 0x088F8, 0x0908F, 0x06A02, 0x06D1B, 0x070D9, 0x073DE, 0x0843D, 0x0916A,
+	0x099F1, 0x04E82, 0x05375, 0x06B04, 0x0721B, 0x0862D, 0x09E1E, 0x05D50, 0x06FEB, 0x085CD,
+	0x08964, 0x062C9, 0x081D8, 0x0881F, 0x05ECA, 0x06717, 0x06D6A, 0x072FC, 0x090CE, 0x04F86,
+	0x051B7, 0x052DE, 0x064C4, 0x06AD3, 0x07210, 0x076E7, 0x08001, 0x08606, 0x0865C, 0x08DEF,
+	0x09732, 0x09B6F, 0x09DFA, 0x0788C, 0x0797F, 0x07DA0, 0x083C9, 0x09304, 0x09E7F, 0x08AD6,
+	0x058DF, 0x05F04, 0x07C60, 0x0807E, 0x07262, 0x078CA, 0x08CC2, 0x096F7, 0x058D8, 0x05C62,
+	0x06A13, 0x06DDA, 0x06F0F, 0x07D2F, 0x07E37, 0x0964B, 0x052D2, 0x0808B, 0x051DC, 0x051CC,
+	0x07A1C, 0x07DBE, 0x083F1, 0x09675, 0x08B80, 0x062CF, 0x08AFE, 0x04E39, 0x05BE7, 0x06012,
+	0x07387, 0x07570, 0x05317, 0x078FB, 0x04FBF, 0x05FA9, 0x04E0D, 0x06CCC, 0x06578, 0x07D22,
+	0x053C3, 0x0585E, 0x07701, 0x08449, 0x08AAA, 0x06BBA, 0x08FB0, 0x06C88, 0x062FE, 0x082E5,
+	0x063A0, 0x07565, 0x04EAE, 0x05169, 0x051C9, 0x06881, 0x07CE7, 0x0826F, 0x08AD2, 0x091CF,
+	0x052F5, 0x05442, 0x05973, 0x05EEC, 0x065C5, 0x06FFE, 0x0792A, 0x095AD, 0x09A6A, 0x09E97,
+	0x09ECE, 0x0529B, 0x066C6, 0x06B77, 0x08F62, 0x05E74, 0x06190, 0x06200, 0x0649A, 0x06F23,
+	0x07149, 0x07489, 0x079CA, 0x07DF4, 0x0806F, 0x08F26, 0x084EE, 0x09023, 0x0934A, 0x05217,
+	0x052A3, 0x054BD, 0x070C8, 0x088C2, 0x05EC9, 0x05FF5, 0x0637B, 0x06BAE, 0x07C3E, 0x07375,
+	0x04EE4, 0x056F9, 0x05DBA, 0x0601C, 0x073B2, 0x07469, 0x07F9A, 0x08046, 0x09234, 0x096F6,
+	0x09748, 0x09818, 0x04F8B, 0x079AE, 0x091B4, 0x096B8, 0x060E1, 0x04E86, 0x050DA, 0x05BEE,
+	0x05C3F, 0x06599, 0x071CE, 0x07642, 0x084FC, 0x0907C, 0x09F8D, 0x06688, 0x0962E, 0x05289,
+	0x0677B, 0x067F3, 0x06D41, 0x06E9C, 0x07409, 0x07559, 0x0786B, 0x07D10, 0x0985E, 0x0516D,
+	0x0622E, 0x09678, 0x0502B, 0x05D19, 0x06DEA, 0x08F2A, 0x05F8B, 0x06144, 0x06817, 0x09686,
+	0x05229, 0x0540F, 0x05C65, 0x06613, 0x0674E, 0x068A8, 0x06CE5, 0x07406, 0x075E2, 0x07F79,
+	0x088CF, 0x088E1, 0x091CC, 0x096E2, 0x0533F, 0x06EBA, 0x0541D, 0x071D0, 0x07498, 0x085FA,
+	0x096A3, 0x09C57, 0x09E9F, 0x06797, 0x06DCB, 0x081E8, 0x07ACB, 0x07B20, 0x07C92, 0x072C0,
+	0x07099, 0x08B58, 0x04EC0, 0x08336, 0x0523A, 0x05207, 0x05EA6, 0x062D3, 0x07CD6, 0x05B85,
+	0x06D1E, 0x066B4, 0x08F3B, 0x0884C, 0x0964D, 0x0898B, 0x05ED3, 0x05140, 0x055C0, 0x0585A,
+	0x06674, 0x051DE, 0x0732A, 0x076CA, 0x0793C, 0x0795E, 0x07965, 0x0798F, 0x09756, 0x07CBE,
+	0x07FBD, 0x08612, 0x08AF8, 0x09038, 0x090FD, 0x098EF, 0x098FC, 0x09928, 0x09DB4, 0x090DE,
+	0x096B7, 0x04FAE, 0x050E7, 0x0514D, 0x052C9, 0x052E4, 0x05351, 0x0559D, 0x05606, 0x05668,
+	0x05840, 0x058A8, 0x05C64, 0x05C6E, 0x06094, 0x06168, 0x0618E, 0x061F2, 0x0654F, 0x065E2,
+	0x06691, 0x06885, 0x06D77, 0x06E1A, 0x06F22, 0x0716E, 0x0722B, 0x07422, 0x07891, 0x0793E,
+	0x07949, 0x07948, 0x07950, 0x07956, 0x0795D, 0x0798D, 0x0798E, 0x07A40, 0x07A81, 0x07BC0,
+	0x07E09, 0x07E41, 0x07F72, 0x08005, 0x081ED, 0x08279, 0x08457, 0x08910, 0x08996, 0x08B01,
+	0x08B39, 0x08CD3, 0x08D08, 0x08FB6, 0x096E3, 0x097FF, 0x0983B, 0x06075, 0x242EE, 0x08218,
+	0x04E26, 0x051B5, 0x05168, 0x04F80, 0x05145, 0x05180, 0x052C7, 0x052FA, 0x05555, 0x05599,
+	0x055E2, 0x058B3, 0x05944, 0x05954, 0x05A62, 0x05B28, 0x05ED2, 0x05ED9, 0x05F69, 0x05FAD,
+	0x060D8, 0x0614E, 0x06108, 0x06160, 0x06234, 0x063C4, 0x0641C, 0x06452, 0x06556, 0x0671B,
+	0x06756, 0x06B79, 0x06EDB, 0x06ECB, 0x0701E, 0x077A7, 0x07235, 0x072AF, 0x07471, 0x07506,
+	0x0753B, 0x0761D, 0x0761F, 0x076DB, 0x076F4, 0x0774A, 0x07740, 0x078CC, 0x07AB1, 0x07C7B,
+	0x07D5B, 0x07F3E, 0x08352, 0x083EF, 0x08779, 0x08941, 0x08986, 0x08ABF, 0x08ACB, 0x08AED,
+	0x08B8A, 0x08F38, 0x09072, 0x09199, 0x09276, 0x0967C, 0x097DB, 0x0980B, 0x09B12, 0x2284A,
+	0x22844, 0x233D5, 0x03B9D, 0x04018, 0x04039, 0x25249, 0x25CD0, 0x27ED3, 0x09F43, 0x09F8E,
+	0x005D9, 0x005B4, 0x005F2, 0x005B7, 0x005E9, 0x005C1, 0x005E9, 0x005C2, 0x005E9, 0x005BC,
+	0x005C1, 0x005E9, 0x005BC, 0x005C2, 0x005D0, 0x005B7, 0x005D0, 0x005B8, 0x005D0, 0x005BC,
+	0x005D1, 0x005BC, 0x005D2, 0x005BC, 0x005D3, 0x005BC, 0x005D4, 0x005BC, 0x005D5, 0x005BC,
+	0x005D6, 0x005BC, 0x005D8, 0x005BC, 0x005D9, 0x005BC, 0x005DA, 0x005BC, 0x005DB, 0x005BC,
+	0x005DC, 0x005BC, 0x005DE, 0x005BC, 0x005E0, 0x005BC, 0x005E1, 0x005BC, 0x005E3, 0x005BC,
+	0x005E4, 0x005BC, 0x005E6, 0x005BC, 0x005E7, 0x005BC, 0x005E8, 0x005BC, 0x005E9, 0x005BC,
+	0x005EA, 0x005BC, 0x005D5, 0x005B9, 0x005D1, 0x005BF, 0x005DB, 0x005BF, 0x005E4, 0x005BF,
+	0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5, 0x110BA, 0x11131, 0x11127, 0x11132, 0x11127,
+	0x11347, 0x1133E, 0x11347, 0x11357, 0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9, 0x114BD,
+	0x115B8, 0x115AF, 0x115B9, 0x115AF, 0x11935, 0x11930, 0x1D157, 0x1D165, 0x1D158, 0x1D165,
+	0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158, 0x1D165, 0x1D170, 0x1D158,
+	0x1D165, 0x1D171, 0x1D158, 0x1D165, 0x1D172, 0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9,
+	0x1D165, 0x1D16E, 0x1D1BA, 0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165,
+	0x1D16F, 0x04E3D, 0x04E38, 0x04E41, 0x20122, 0x04F60, 0x04FBB, 0x05002, 0x0507A, 0x05099,
+	0x050CF, 0x0349E, 0x2063A, 0x05154, 0x05164, 0x05177, 0x2051C, 0x034B9, 0x05167, 0x0518D,
+	0x2054B, 0x05197, 0x051A4, 0x04ECC, 0x051AC, 0x291DF, 0x051F5, 0x05203, 0x034DF, 0x0523B,
+	0x05246, 0x05272, 0x05277, 0x03515, 0x05305, 0x05306, 0x05349, 0x0535A, 0x05373, 0x0537D,
+	0x0537F, 0x20A2C, 0x07070, 0x053CA, 0x053DF, 0x20B63, 0x053EB, 0x053F1, 0x05406, 0x0549E,
+	0x05438, 0x05448, 0x05468, 0x054A2, 0x054F6, 0x05510, 0x05553, 0x05563, 0x05584, 0x055AB,
+	0x055B3, 0x055C2, 0x05716, 0x05717, 0x05651, 0x05674, 0x058EE, 0x057CE, 0x057F4, 0x0580D,
+	0x0578B, 0x05832, 0x05831, 0x058AC, 0x214E4, 0x058F2, 0x058F7, 0x05906, 0x0591A, 0x05922,
+	0x05962, 0x216A8, 0x216EA, 0x059EC, 0x05A1B, 0x05A27, 0x059D8, 0x05A66, 0x036EE, 0x036FC,
+	0x05B08, 0x05B3E, 0x219C8, 0x05BC3, 0x05BD8, 0x05BF3, 0x21B18, 0x05BFF, 0x05C06, 0x05F53,
+	0x05C22, 0x03781, 0x05C60, 0x05CC0, 0x05C8D, 0x21DE4, 0x05D43, 0x21DE6, 0x05D6E, 0x05D6B,
+	0x05D7C, 0x05DE1, 0x05DE2, 0x0382F, 0x05DFD, 0x05E28, 0x05E3D, 0x05E69, 0x03862, 0x22183,
+	0x0387C, 0x05EB0, 0x05EB3, 0x05EB6, 0x2A392, 0x05EFE, 0x22331, 0x08201, 0x05F22, 0x038C7,
+	0x232B8, 0x261DA, 0x05F62, 0x05F6B, 0x038E3, 0x05F9A, 0x05FCD, 0x05FD7, 0x05FF9, 0x06081,
+	0x0393A, 0x0391C, 0x226D4, 0x060C7, 0x06148, 0x0614C, 0x0617A, 0x061B2, 0x061A4, 0x061AF,
+	0x061DE, 0x06210, 0x0621B, 0x0625D, 0x062B1, 0x062D4, 0x06350, 0x22B0C, 0x0633D, 0x062FC,
+	0x06368, 0x06383, 0x063E4, 0x22BF1, 0x06422, 0x063C5, 0x063A9, 0x03A2E, 0x06469, 0x0647E,
+	0x0649D, 0x06477, 0x03A6C, 0x0656C, 0x2300A, 0x065E3, 0x066F8, 0x06649, 0x03B19, 0x03B08,
+	0x03AE4, 0x05192, 0x05195, 0x06700, 0x0669C, 0x080AD, 0x043D9, 0x06721, 0x0675E, 0x06753,
+	0x233C3, 0x03B49, 0x067FA, 0x06785, 0x06852, 0x2346D, 0x0688E, 0x0681F, 0x06914, 0x06942,
+	0x069A3, 0x069EA, 0x06AA8, 0x236A3, 0x06ADB, 0x03C18, 0x06B21, 0x238A7, 0x06B54, 0x03C4E,
+	0x06B72, 0x06B9F, 0x06BBB, 0x23A8D, 0x21D0B, 0x23AFA, 0x06C4E, 0x23CBC, 0x06CBF, 0x06CCD,
+	0x06C67, 0x06D16, 0x06D3E, 0x06D69, 0x06D78, 0x06D85, 0x23D1E, 0x06D34, 0x06E2F, 0x06E6E,
+	0x03D33, 0x06EC7, 0x23ED1, 0x06DF9, 0x06F6E, 0x23F5E, 0x23F8E, 0x06FC6, 0x07039, 0x0701B,
+	0x03D96, 0x0704A, 0x0707D, 0x07077, 0x070AD, 0x20525, 0x07145, 0x24263, 0x0719C, 0x243AB,
+	0x07228, 0x07250, 0x24608, 0x07280, 0x07295, 0x24735, 0x24814, 0x0737A, 0x0738B, 0x03EAC,
+	0x073A5, 0x03EB8, 0x07447, 0x0745C, 0x07485, 0x074CA, 0x03F1B, 0x07524, 0x24C36, 0x0753E,
+	0x24C92, 0x2219F, 0x07610, 0x24FA1, 0x24FB8, 0x25044, 0x03FFC, 0x04008, 0x250F3, 0x250F2,
+	0x25119, 0x25133, 0x0771E, 0x0771F, 0x0778B, 0x04046, 0x04096, 0x2541D, 0x0784E, 0x040E3,
+	0x25626, 0x2569A, 0x256C5, 0x079EB, 0x0412F, 0x07A4A, 0x07A4F, 0x2597C, 0x25AA7, 0x07AEE,
+	0x04202, 0x25BAB, 0x07BC6, 0x07BC9, 0x04227, 0x25C80, 0x07CD2, 0x042A0, 0x07CE8, 0x07CE3,
+	0x07D00, 0x25F86, 0x07D63, 0x04301, 0x07DC7, 0x07E02, 0x07E45, 0x04334, 0x26228, 0x26247,
+	0x04359, 0x262D9, 0x07F7A, 0x2633E, 0x07F95, 0x07FFA, 0x264DA, 0x26523, 0x08060, 0x265A8,
+	0x08070, 0x2335F, 0x043D5, 0x080B2, 0x08103, 0x0440B, 0x0813E, 0x05AB5, 0x267A7, 0x267B5,
+	0x23393, 0x2339C, 0x08204, 0x08F9E, 0x0446B, 0x08291, 0x0828B, 0x0829D, 0x052B3, 0x082B1,
+	0x082B3, 0x082BD, 0x082E6, 0x26B3C, 0x0831D, 0x08363, 0x083AD, 0x08323, 0x083BD, 0x083E7,
+	0x08353, 0x083CA, 0x083CC, 0x083DC, 0x26C36, 0x26D6B, 0x26CD5, 0x0452B, 0x084F1, 0x084F3,
+	0x08516, 0x273CA, 0x08564, 0x26F2C, 0x0455D, 0x04561, 0x26FB1, 0x270D2, 0x0456B, 0x08650,
+	0x08667, 0x08669, 0x086A9, 0x08688, 0x0870E, 0x086E2, 0x08728, 0x0876B, 0x08786, 0x045D7,
+	0x087E1, 0x08801, 0x045F9, 0x08860, 0x08863, 0x27667, 0x088D7, 0x088DE, 0x04635, 0x088FA,
+	0x034BB, 0x278AE, 0x27966, 0x046BE, 0x046C7, 0x08AA0, 0x08C55, 0x27CA8, 0x08CAB, 0x08CC1,
+	0x08D1B, 0x08D77, 0x27F2F, 0x20804, 0x08DCB, 0x08DBC, 0x08DF0, 0x208DE, 0x08ED4, 0x285D2,
+	0x285ED, 0x09094, 0x090F1, 0x09111, 0x2872E, 0x0911B, 0x09238, 0x092D7, 0x092D8, 0x0927C,
+	0x093F9, 0x09415, 0x28BFA, 0x0958B, 0x04995, 0x095B7, 0x28D77, 0x049E6, 0x096C3, 0x05DB2,
+	0x09723, 0x29145, 0x2921A, 0x04A6E, 0x04A76, 0x097E0, 0x2940A, 0x04AB2, 0x29496, 0x09829,
+	0x295B6, 0x098E2, 0x04B33, 0x09929, 0x099A7, 0x099C2, 0x099FE, 0x04BCE, 0x29B30, 0x09C40,
+	0x09CFD, 0x04CCE, 0x04CED, 0x09D67, 0x2A0CE, 0x04CF8, 0x2A105, 0x2A20E, 0x2A291, 0x09EBB,
+	0x04D56, 0x09EF9, 0x09EFE, 0x09F05, 0x09F0F, 0x09F16, 0x09F3B, 0x2A600
+};
+
+// Primary composites, sorted by (first << 21) | second
+typedef struct
+{
+	uint64_t pair;
+	uint32_t composite;
+}
+nfc_comp_t;
+
+static const nfc_comp_t g_nfcComp[941] =
+{
+	{ 0x00007800338ULL, 0x0226E }, { 0x00007A00338ULL, 0x02260 }, { 0x00007C00338ULL, 0x0226F },
+	{ 0x00008200300ULL, 0x000C0 }, { 0x00008200301ULL, 0x000C1 }, { 0x00008200302ULL, 0x000C2 },
+	{ 0x00008200303ULL, 0x000C3 }, { 0x00008200304ULL, 0x00100 }, { 0x00008200306ULL, 0x00102 },
+	{ 0x00008200307ULL, 0x00226 }, { 0x00008200308ULL, 0x000C4 }, { 0x00008200309ULL, 0x01EA2 },
+	{ 0x0000820030AULL, 0x000C5 }, { 0x0000820030CULL, 0x001CD }, { 0x0000820030FULL, 0x00200 },
+	{ 0x00008200311ULL, 0x00202 }, { 0x00008200323ULL, 0x01EA0 }, { 0x00008200325ULL, 0x01E00 },
+	{ 0x00008200328ULL, 0x00104 }, { 0x00008400307ULL, 0x01E02 }, { 0x00008400323ULL, 0x01E04 },
+	{ 0x00008400331ULL, 0x01E06 }, { 0x00008600301ULL, 0x00106 }, { 0x00008600302ULL, 0x00108 },
+	{ 0x00008600307ULL, 0x0010A }, { 0x0000860030CULL, 0x0010C }, { 0x00008600327ULL, 0x000C7 },
+	{ 0x00008800307ULL, 0x01E0A }, { 0x0000880030CULL, 0x0010E }, { 0x00008800323ULL, 0x01E0C },
+	{ 0x00008800327ULL, 0x01E10 }, { 0x0000880032DULL, 0x01E12 }, { 0x00008800331ULL, 0x01E0E },
+	{ 0x00008A00300ULL, 0x000C8 }, { 0x00008A00301ULL, 0x000C9 }, { 0x00008A00302ULL, 0x000CA },
+	{ 0x00008A00303ULL, 0x01EBC }, { 0x00008A00304ULL, 0x00112 }, { 0x00008A00306ULL, 0x00114 },
+	{ 0x00008A00307ULL, 0x00116 }, { 0x00008A00308ULL, 0x000CB }, { 0x00008A00309ULL, 0x01EBA },
+	{ 0x00008A0030CULL, 0x0011A }, { 0x00008A0030FULL, 0x00204 }, { 0x00008A00311ULL, 0x00206 },
+	{ 0x00008A00323ULL, 0x01EB8 }, { 0x00008A00327ULL, 0x00228 }, { 0x00008A00328ULL, 0x00118 },
+	{ 0x00008A0032DULL, 0x01E18 }, { 0x00008A00330ULL, 0x01E1A }, { 0x00008C00307ULL, 0x01E1E },
+	{ 0x00008E00301ULL, 0x001F4 }, { 0x00008E00302ULL, 0x0011C }, { 0x00008E00304ULL, 0x01E20 },
+	{ 0x00008E00306ULL, 0x0011E }, { 0x00008E00307ULL, 0x00120 }, { 0x00008E0030CULL, 0x001E6 },
+	{ 0x00008E00327ULL, 0x00122 }, { 0x00009000302ULL, 0x00124 }, { 0x00009000307ULL, 0x01E22 },
+	{ 0x00009000308ULL, 0x01E26 }, { 0x0000900030CULL, 0x0021E }, { 0x00009000323ULL, 0x01E24 },
+	{ 0x00009000327ULL, 0x01E28 }, { 0x0000900032EULL, 0x01E2A }, { 0x00009200300ULL, 0x000CC },
+	{ 0x00009200301ULL, 0x000CD }, { 0x00009200302ULL, 0x000CE }, { 0x00009200303ULL, 0x00128 },
+	{ 0x00009200304ULL, 0x0012A }, { 0x00009200306ULL, 0x0012C }, { 0x00009200307ULL, 0x00130 },
+	{ 0x00009200308ULL, 0x000CF }, { 0x00009200309ULL, 0x01EC8 }, { 0x0000920030CULL, 0x001CF },
+	{ 0x0000920030FULL, 0x00208 }, { 0x00009200311ULL, 0x0020A }, { 0x00009200323ULL, 0x01ECA },
+	{ 0x00009200328ULL, 0x0012E }, { 0x00009200330ULL, 0x01E2C }, { 0x00009400302ULL, 0x00134 },
+	{ 0x00009600301ULL, 0x01E30 }, { 0x0000960030CULL, 0x001E8 }, { 0x00009600323ULL, 0x01E32 },
+	{ 0x00009600327ULL, 0x00136 }, { 0x00009600331ULL, 0x01E34 }, { 0x00009800301ULL, 0x00139 },
+	{ 0x0000980030CULL, 0x0013D }, { 0x00009800323ULL, 0x01E36 }, { 0x00009800327ULL, 0x0013B },
+	{ 0x0000980032DULL, 0x01E3C }, { 0x00009800331ULL, 0x01E3A }, { 0x00009A00301ULL, 0x01E3E },
+	{ 0x00009A00307ULL, 0x01E40 }, { 0x00009A00323ULL, 0x01E42 }, { 0x00009C00300ULL, 0x001F8 },
+	{ 0x00009C00301ULL, 0x00143 }, { 0x00009C00303ULL, 0x000D1 }, { 0x00009C00307ULL, 0x01E44 },
+	{ 0x00009C0030CULL, 0x00147 }, { 0x00009C00323ULL, 0x01E46 }, { 0x00009C00327ULL, 0x00145 },
+	{ 0x00009C0032DULL, 0x01E4A }, { 0x00009C00331ULL, 0x01E48 }, { 0x00009E00300ULL, 0x000D2 },
+	{ 0x00009E00301ULL, 0x000D3 }, { 0x00009E00302ULL, 0x000D4 }, { 0x00009E00303ULL, 0x000D5 },
+	{ 0x00009E00304ULL, 0x0014C }, { 0x00009E00306ULL, 0x0014E }, { 0x00009E00307ULL, 0x0022E },
+	{ 0x00009E00308ULL, 0x000D6 }, { 0x00009E00309ULL, 0x01ECE }, { 0x00009E0030BULL, 0x00150 },
+	{ 0x00009E0030CULL, 0x001D1 }, { 0x00009E0030FULL, 0x0020C }, { 0x00009E00311ULL, 0x0020E },
+	{ 0x00009E0031BULL, 0x001A0 }, { 0x00009E00323ULL, 0x01ECC }, { 0x00009E00328ULL, 0x001EA },
+	{ 0x0000A000301ULL, 0x01E54 }, { 0x0000A000307ULL, 0x01E56 }, { 0x0000A400301ULL, 0x00154 },
+	{ 0x0000A400307ULL, 0x01E58 }, { 0x0000A40030CULL, 0x00158 }, { 0x0000A40030FULL, 0x00210 },
+	{ 0x0000A400311ULL, 0x00212 }, { 0x0000A400323ULL, 0x01E5A }, { 0x0000A400327ULL, 0x00156 },
+	{ 0x0000A400331ULL, 0x01E5E }, { 0x0000A600301ULL, 0x0015A }, { 0x0000A600302ULL, 0x0015C },
+	{ 0x0000A600307ULL, 0x01E60 }, { 0x0000A60030CULL, 0x00160 }, { 0x0000A600323ULL, 0x01E62 },
+	{ 0x0000A600326ULL, 0x00218 }, { 0x0000A600327ULL, 0x0015E }, { 0x0000A800307ULL, 0x01E6A },
+	{ 0x0000A80030CULL, 0x00164 }, { 0x0000A800323ULL, 0x01E6C }, { 0x0000A800326ULL, 0x0021A },
+	{ 0x0000A800327ULL, 0x00162 }, { 0x0000A80032DULL, 0x01E70 }, { 0x0000A800331ULL, 0x01E6E },
+	{ 0x0000AA00300ULL, 0x000D9 }, { 0x0000AA00301ULL, 0x000DA }, { 0x0000AA00302ULL, 0x000DB },
+	{ 0x0000AA00303ULL, 0x00168 }, { 0x0000AA00304ULL, 0x0016A }, { 0x0000AA00306ULL, 0x0016C },
+	{ 0x0000AA00308ULL, 0x000DC }, { 0x0000AA00309ULL, 0x01EE6 }, { 0x0000AA0030AULL, 0x0016E },
+	{ 0x0000AA0030BULL, 0x00170 }, { 0x0000AA0030CULL, 0x001D3 }, { 0x0000AA0030FULL, 0x00214 },
+	{ 0x0000AA00311ULL, 0x00216 }, { 0x0000AA0031BULL, 0x001AF }, { 0x0000AA00323ULL, 0x01EE4 },
+	{ 0x0000AA00324ULL, 0x01E72 }, { 0x0000AA00328ULL, 0x00172 }, { 0x0000AA0032DULL, 0x01E76 },
+	{ 0x0000AA00330ULL, 0x01E74 }, { 0x0000AC00303ULL, 0x01E7C }, { 0x0000AC00323ULL, 0x01E7E },
+	{ 0x0000AE00300ULL, 0x01E80 }, { 0x0000AE00301ULL, 0x01E82 }, { 0x0000AE00302ULL, 0x00174 },
+	{ 0x0000AE00307ULL, 0x01E86 }, { 0x0000AE00308ULL, 0x01E84 }, { 0x0000AE00323ULL, 0x01E88 },
+	{ 0x0000B000307ULL, 0x01E8A }, { 0x0000B000308ULL, 0x01E8C }, { 0x0000B200300ULL, 0x01EF2 },
+	{ 0x0000B200301ULL, 0x000DD }, { 0x0000B200302ULL, 0x00176 }, { 0x0000B200303ULL, 0x01EF8 },
+	{ 0x0000B200304ULL, 0x00232 }, { 0x0000B200307ULL, 0x01E8E }, { 0x0000B200308ULL, 0x00178 },
+	{ 0x0000B200309ULL, 0x01EF6 }, { 0x0000B200323ULL, 0x01EF4 }, { 0x0000B400301ULL, 0x00179 },
+	{ 0x0000B400302ULL, 0x01E90 }, { 0x0000B400307ULL, 0x0017B }, { 0x0000B40030CULL, 0x0017D },
+	{ 0x0000B400323ULL, 0x01E92 }, { 0x0000B400331ULL, 0x01E94 }, { 0x0000C200300ULL, 0x000E0 },
+	{ 0x0000C200301ULL, 0x000E1 }, { 0x0000C200302ULL, 0x000E2 }, { 0x0000C200303ULL, 0x000E3 },
+	{ 0x0000C200304ULL, 0x00101 }, { 0x0000C200306ULL, 0x00103 }, { 0x0000C200307ULL, 0x00227 },
+	{ 0x0000C200308ULL, 0x000E4 }, { 0x0000C200309ULL, 0x01EA3 }, { 0x0000C20030AULL, 0x000E5 },
+	{ 0x0000C20030CULL, 0x001CE }, { 0x0000C20030FULL, 0x00201 }, { 0x0000C200311ULL, 0x00203 },
+	{ 0x0000C200323ULL, 0x01EA1 }, { 0x0000C200325ULL, 0x01E01 }, { 0x0000C200328ULL, 0x00105 },
+	{ 0x0000C400307ULL, 0x01E03 }, { 0x0000C400323ULL, 0x01E05 }, { 0x0000C400331ULL, 0x01E07 },
+	{ 0x0000C600301ULL, 0x00107 }, { 0x0000C600302ULL, 0x00109 }, { 0x0000C600307ULL, 0x0010B },
+	{ 0x0000C60030CULL, 0x0010D }, { 0x0000C600327ULL, 0x000E7 }, { 0x0000C800307ULL, 0x01E0B },
+	{ 0x0000C80030CULL, 0x0010F }, { 0x0000C800323ULL, 0x01E0D }, { 0x0000C800327ULL, 0x01E11 },
+	{ 0x0000C80032DULL, 0x01E13 }, { 0x0000C800331ULL, 0x01E0F }, { 0x0000CA00300ULL, 0x000E8 },
+	{ 0x0000CA00301ULL, 0x000E9 }, { 0x0000CA00302ULL, 0x000EA }, { 0x0000CA00303ULL, 0x01EBD },
+	{ 0x0000CA00304ULL, 0x00113 }, { 0x0000CA00306ULL, 0x00115 }, { 0x0000CA00307ULL, 0x00117 },
+	{ 0x0000CA00308ULL, 0x000EB }, { 0x0000CA00309ULL, 0x01EBB }, { 0x0000CA0030CULL, 0x0011B },
+	{ 0x0000CA0030FULL, 0x00205 }, { 0x0000CA00311ULL, 0x00207 }, { 0x0000CA00323ULL, 0x01EB9 },
+	{ 0x0000CA00327ULL, 0x00229 }, { 0x0000CA00328ULL, 0x00119 }, { 0x0000CA0032DULL, 0x01E19 },
+	{ 0x0000CA00330ULL, 0x01E1B }, { 0x0000CC00307ULL, 0x01E1F }, { 0x0000CE00301ULL, 0x001F5 },
+	{ 0x0000CE00302ULL, 0x0011D }, { 0x0000CE00304ULL, 0x01E21 }, { 0x0000CE00306ULL, 0x0011F },
+	{ 0x0000CE00307ULL, 0x00121 }, { 0x0000CE0030CULL, 0x001E7 }, { 0x0000CE00327ULL, 0x00123 },
+	{ 0x0000D000302ULL, 0x00125 }, { 0x0000D000307ULL, 0x01E23 }, { 0x0000D000308ULL, 0x01E27 },
+	{ 0x0000D00030CULL, 0x0021F }, { 0x0000D000323ULL, 0x01E25 }, { 0x0000D000327ULL, 0x01E29 },
+	{ 0x0000D00032EULL, 0x01E2B }, { 0x0000D000331ULL, 0x01E96 }, { 0x0000D200300ULL, 0x000EC },
+	{ 0x0000D200301ULL, 0x000ED }, { 0x0000D200302ULL, 0x000EE }, { 0x0000D200303ULL, 0x00129 },
+	{ 0x0000D200304ULL, 0x0012B }, { 0x0000D200306ULL, 0x0012D }, { 0x0000D200308ULL, 0x000EF },
+	{ 0x0000D200309ULL, 0x01EC9 }, { 0x0000D20030CULL, 0x001D0 }, { 0x0000D20030FULL, 0x00209 },
+	{ 0x0000D200311ULL, 0x0020B }, { 0x0000D200323ULL, 0x01ECB }, { 0x0000D200328ULL, 0x0012F },
+	{ 0x0000D200330ULL, 0x01E2D }, { 0x0000D400302ULL, 0x00135 }, { 0x0000D40030CULL, 0x001F0 },
+	{ 0x0000D600301ULL, 0x01E31 }, { 0x0000D60030CULL, 0x001E9 }, { 0x0000D600323ULL, 0x01E33 },
+	{ 0x0000D600327ULL, 0x00137 }, { 0x0000D600331ULL, 0x01E35 }, { 0x0000D800301ULL, 0x0013A },
+	{ 0x0000D80030CULL, 0x0013E }, { 0x0000D800323ULL, 0x01E37 }, { 0x0000D800327ULL, 0x0013C },
+	{ 0x0000D80032DULL, 0x01E3D }, { 0x0000D800331ULL, 0x01E3B }, { 0x0000DA00301ULL, 0x01E3F },
+	{ 0x0000DA00307ULL, 0x01E41 }, { 0x0000DA00323ULL, 0x01E43 }, { 0x0000DC00300ULL, 0x001F9 },
+	{ 0x0000DC00301ULL, 0x00144 }, { 0x0000DC00303ULL, 0x000F1 }, { 0x0000DC00307ULL, 0x01E45 },
+	{ 0x0000DC0030CULL, 0x00148 }, { 0x0000DC00323ULL, 0x01E47 }, { 0x0000DC00327ULL, 0x00146 },
+	{ 0x0000DC0032DULL, 0x01E4B }, { 0x0000DC00331ULL, 0x01E49 }, { 0x0000DE00300ULL, 0x000F2 },
+	{ 0x0000DE00301ULL, 0x000F3 }, { 0x0000DE00302ULL, 0x000F4 }, { 0x0000DE00303ULL, 0x000F5 },
+	{ 0x0000DE00304ULL, 0x0014D }, { 0x0000DE00306ULL, 0x0014F }, { 0x0000DE00307ULL, 0x0022F },
+	{ 0x0000DE00308ULL, 0x000F6 }, { 0x0000DE00309ULL, 0x01ECF }, { 0x0000DE0030BULL, 0x00151 },
+	{ 0x0000DE0030CULL, 0x001D2 }, { 0x0000DE0030FULL, 0x0020D }, { 0x0000DE00311ULL, 0x0020F },
+	{ 0x0000DE0031BULL, 0x001A1 }, { 0x0000DE00323ULL, 0x01ECD }, { 0x0000DE00328ULL, 0x001EB },
+	{ 0x0000E000301ULL, 0x01E55 }, { 0x0000E000307ULL, 0x01E57 }, { 0x0000E400301ULL, 0x00155 },
+	{ 0x0000E400307ULL, 0x01E59 }, { 0x0000E40030CULL, 0x00159 }, { 0x0000E40030FULL, 0x00211 },
+	{ 0x0000E400311ULL, 0x00213 }, { 0x0000E400323ULL, 0x01E5B }, { 0x0000E400327ULL, 0x00157 },
+	{ 0x0000E400331ULL, 0x01E5F }, { 0x0000E600301ULL, 0x0015B }, { 0x0000E600302ULL, 0x0015D },
+	{ 0x0000E600307ULL, 0x01E61 }, { 0x0000E60030CULL, 0x00161 }, { 0x0000E600323ULL, 0x01E63 },
+	{ 0x0000E600326ULL, 0x00219 }, { 0x0000E600327ULL, 0x0015F }, { 0x0000E800307ULL, 0x01E6B },
+	{ 0x0000E800308ULL, 0x01E97 }, { 0x0000E80030CULL, 0x00165 }, { 0x0000E800323ULL, 0x01E6D },
+	{ 0x0000E800326ULL, 0x0021B }, { 0x0000E800327ULL, 0x00163 }, { 0x0000E80032DULL, 0x01E71 },
+	{ 0x0000E800331ULL, 0x01E6F }, { 0x0000EA00300ULL, 0x000F9 }, { 0x0000EA00301ULL, 0x000FA },
+	{ 0x0000EA00302ULL, 0x000FB }, { 0x0000EA00303ULL, 0x00169 }, { 0x0000EA00304ULL, 0x0016B },
+	{ 0x0000EA00306ULL, 0x0016D }, { 0x0000EA00308ULL, 0x000FC }, { 0x0000EA00309ULL, 0x01EE7 },
+	{ 0x0000EA0030AULL, 0x0016F }, { 0x0000EA0030BULL, 0x00171 }, { 0x0000EA0030CULL, 0x001D4 },
+	{ 0x0000EA0030FULL, 0x00215 }, { 0x0000EA00311ULL, 0x00217 }, { 0x0000EA0031BULL, 0x001B0 },
+	{ 0x0000EA00323ULL, 0x01EE5 }, { 0x0000EA00324ULL, 0x01E73 }, { 0x0000EA00328ULL, 0x00173 },
+	{ 0x0000EA0032DULL, 0x01E77 }, { 0x0000EA00330ULL, 0x01E75 }, { 0x0000EC00303ULL, 0x01E7D },
+	{ 0x0000EC00323ULL, 0x01E7F }, { 0x0000EE00300ULL, 0x01E81 }, { 0x0000EE00301ULL, 0x01E83 },
+	{ 0x0000EE00302ULL, 0x00175 }, { 0x0000EE00307ULL, 0x01E87 }, { 0x0000EE00308ULL, 0x01E85 },
+	{ 0x0000EE0030AULL, 0x01E98 }, { 0x0000EE00323ULL, 0x01E89 }, { 0x0000F000307ULL, 0x01E8B },
+	{ 0x0000F000308ULL, 0x01E8D }, { 0x0000F200300ULL, 0x01EF3 }, { 0x0000F200301ULL, 0x000FD },
+	{ 0x0000F200302ULL, 0x00177 }, { 0x0000F200303ULL, 0x01EF9 }, { 0x0000F200304ULL, 0x00233 },
+	{ 0x0000F200307ULL, 0x01E8F }, { 0x0000F200308ULL, 0x000FF }, { 0x0000F200309ULL, 0x01EF7 },
+	{ 0x0000F20030AULL, 0x01E99 }, { 0x0000F200323ULL, 0x01EF5 }, { 0x0000F400301ULL, 0x0017A },
+	{ 0x0000F400302ULL, 0x01E91 }, { 0x0000F400307ULL, 0x0017C }, { 0x0000F40030CULL, 0x0017E },
+	{ 0x0000F400323ULL, 0x01E93 }, { 0x0000F400331ULL, 0x01E95 }, { 0x00015000300ULL, 0x01FED },
+	{ 0x00015000301ULL, 0x00385 }, { 0x00015000342ULL, 0x01FC1 }, { 0x00018400300ULL, 0x01EA6 },
+	{ 0x00018400301ULL, 0x01EA4 }, { 0x00018400303ULL, 0x01EAA }, { 0x00018400309ULL, 0x01EA8 },
+	{ 0x00018800304ULL, 0x001DE }, { 0x00018A00301ULL, 0x001FA }, { 0x00018C00301ULL, 0x001FC },
+	{ 0x00018C00304ULL, 0x001E2 }, { 0x00018E00301ULL, 0x01E08 }, { 0x00019400300ULL, 0x01EC0 },
+	{ 0x00019400301ULL, 0x01EBE }, { 0x00019400303ULL, 0x01EC4 }, { 0x00019400309ULL, 0x01EC2 },
+	{ 0x00019E00301ULL, 0x01E2E }, { 0x0001A800300ULL, 0x01ED2 }, { 0x0001A800301ULL, 0x01ED0 },
+	{ 0x0001A800303ULL, 0x01ED6 }, { 0x0001A800309ULL, 0x01ED4 }, { 0x0001AA00301ULL, 0x01E4C },
+	{ 0x0001AA00304ULL, 0x0022C }, { 0x0001AA00308ULL, 0x01E4E }, { 0x0001AC00304ULL, 0x0022A },
+	{ 0x0001B000301ULL, 0x001FE }, { 0x0001B800300ULL, 0x001DB }, { 0x0001B800301ULL, 0x001D7 },
+	{ 0x0001B800304ULL, 0x001D5 }, { 0x0001B80030CULL, 0x001D9 }, { 0x0001C400300ULL, 0x01EA7 },
+	{ 0x0001C400301ULL, 0x01EA5 }, { 0x0001C400303ULL, 0x01EAB }, { 0x0001C400309ULL, 0x01EA9 },
+	{ 0x0001C800304ULL, 0x001DF }, { 0x0001CA00301ULL, 0x001FB }, { 0x0001CC00301ULL, 0x001FD },
+	{ 0x0001CC00304ULL, 0x001E3 }, { 0x0001CE00301ULL, 0x01E09 }, { 0x0001D400300ULL, 0x01EC1 },
+	{ 0x0001D400301ULL, 0x01EBF }, { 0x0001D400303ULL, 0x01EC5 }, { 0x0001D400309ULL, 0x01EC3 },
+	{ 0x0001DE00301ULL, 0x01E2F }, { 0x0001E800300ULL, 0x01ED3 }, { 0x0001E800301ULL, 0x01ED1 },
+	{ 0x0001E800303ULL, 0x01ED7 }, { 0x0001E800309ULL, 0x01ED5 }, { 0x0001EA00301ULL, 0x01E4D },
+	{ 0x0001EA00304ULL, 0x0022D }, { 0x0001EA00308ULL, 0x01E4F }, { 0x0001EC00304ULL, 0x0022B },
+	{ 0x0001F000301ULL, 0x001FF }, { 0x0001F800300ULL, 0x001DC }, { 0x0001F800301ULL, 0x001D8 },
+	{ 0x0001F800304ULL, 0x001D6 }, { 0x0001F80030CULL, 0x001DA }, { 0x00020400300ULL, 0x01EB0 },
+	{ 0x00020400301ULL, 0x01EAE }, { 0x00020400303ULL, 0x01EB4 }, { 0x00020400309ULL, 0x01EB2 },
+	{ 0x00020600300ULL, 0x01EB1 }, { 0x00020600301ULL, 0x01EAF }, { 0x00020600303ULL, 0x01EB5 },
+	{ 0x00020600309ULL, 0x01EB3 }, { 0x00022400300ULL, 0x01E14 }, { 0x00022400301ULL, 0x01E16 },
+	{ 0x00022600300ULL, 0x01E15 }, { 0x00022600301ULL, 0x01E17 }, { 0x00029800300ULL, 0x01E50 },
+	{ 0x00029800301ULL, 0x01E52 }, { 0x00029A00300ULL, 0x01E51 }, { 0x00029A00301ULL, 0x01E53 },
+	{ 0x0002B400307ULL, 0x01E64 }, { 0x0002B600307ULL, 0x01E65 }, { 0x0002C000307ULL, 0x01E66 },
+	{ 0x0002C200307ULL, 0x01E67 }, { 0x0002D000301ULL, 0x01E78 }, { 0x0002D200301ULL, 0x01E79 },
+	{ 0x0002D400308ULL, 0x01E7A }, { 0x0002D600308ULL, 0x01E7B }, { 0x0002FE00307ULL, 0x01E9B },
+	{ 0x00034000300ULL, 0x01EDC }, { 0x00034000301ULL, 0x01EDA }, { 0x00034000303ULL, 0x01EE0 },
+	{ 0x00034000309ULL, 0x01EDE }, { 0x00034000323ULL, 0x01EE2 }, { 0x00034200300ULL, 0x01EDD },
+	{ 0x00034200301ULL, 0x01EDB }, { 0x00034200303ULL, 0x01EE1 }, { 0x00034200309ULL, 0x01EDF },
+	{ 0x00034200323ULL, 0x01EE3 }, { 0x00035E00300ULL, 0x01EEA }, { 0x00035E00301ULL, 0x01EE8 },
+	{ 0x00035E00303ULL, 0x01EEE }, { 0x00035E00309ULL, 0x01EEC }, { 0x00035E00323ULL, 0x01EF0 },
+	{ 0x00036000300ULL, 0x01EEB }, { 0x00036000301ULL, 0x01EE9 }, { 0x00036000303ULL, 0x01EEF },
+	{ 0x00036000309ULL, 0x01EED }, { 0x00036000323ULL, 0x01EF1 }, { 0x00036E0030CULL, 0x001EE },
+	{ 0x0003D400304ULL, 0x001EC }, { 0x0003D600304ULL, 0x001ED }, { 0x00044C00304ULL, 0x001E0 },
+	{ 0x00044E00304ULL, 0x001E1 }, { 0x00045000306ULL, 0x01E1C }, { 0x00045200306ULL, 0x01E1D },
+	{ 0x00045C00304ULL, 0x00230 }, { 0x00045E00304ULL, 0x00231 }, { 0x0005240030CULL, 0x001EF },
+	{ 0x00072200300ULL, 0x01FBA }, { 0x00072200301ULL, 0x00386 }, { 0x00072200304ULL, 0x01FB9 },
+	{ 0x00072200306ULL, 0x01FB8 }, { 0x00072200313ULL, 0x01F08 }, { 0x00072200314ULL, 0x01F09 },
+	{ 0x00072200345ULL, 0x01FBC }, { 0x00072A00300ULL, 0x01FC8 }, { 0x00072A00301ULL, 0x00388 },
+	{ 0x00072A00313ULL, 0x01F18 }, { 0x00072A00314ULL, 0x01F19 }, { 0x00072E00300ULL, 0x01FCA },
+	{ 0x00072E00301ULL, 0x00389 }, { 0x00072E00313ULL, 0x01F28 }, { 0x00072E00314ULL, 0x01F29 },
+	{ 0x00072E00345ULL, 0x01FCC }, { 0x00073200300ULL, 0x01FDA }, { 0x00073200301ULL, 0x0038A },
+	{ 0x00073200304ULL, 0x01FD9 }, { 0x00073200306ULL, 0x01FD8 }, { 0x00073200308ULL, 0x003AA },
+	{ 0x00073200313ULL, 0x01F38 }, { 0x00073200314ULL, 0x01F39 }, { 0x00073E00300ULL, 0x01FF8 },
+	{ 0x00073E00301ULL, 0x0038C }, { 0x00073E00313ULL, 0x01F48 }, { 0x00073E00314ULL, 0x01F49 },
+	{ 0x00074200314ULL, 0x01FEC }, { 0x00074A00300ULL, 0x01FEA }, { 0x00074A00301ULL, 0x0038E },
+	{ 0x00074A00304ULL, 0x01FE9 }, { 0x00074A00306ULL, 0x01FE8 }, { 0x00074A00308ULL, 0x003AB },
+	{ 0x00074A00314ULL, 0x01F59 }, { 0x00075200300ULL, 0x01FFA }, { 0x00075200301ULL, 0x0038F },
+	{ 0x00075200313ULL, 0x01F68 }, { 0x00075200314ULL, 0x01F69 }, { 0x00075200345ULL, 0x01FFC },
+	{ 0x00075800345ULL, 0x01FB4 }, { 0x00075C00345ULL, 0x01FC4 }, { 0x00076200300ULL, 0x01F70 },
+	{ 0x00076200301ULL, 0x003AC }, { 0x00076200304ULL, 0x01FB1 }, { 0x00076200306ULL, 0x01FB0 },
+	{ 0x00076200313ULL, 0x01F00 }, { 0x00076200314ULL, 0x01F01 }, { 0x00076200342ULL, 0x01FB6 },
+	{ 0x00076200345ULL, 0x01FB3 }, { 0x00076A00300ULL, 0x01F72 }, { 0x00076A00301ULL, 0x003AD },
+	{ 0x00076A00313ULL, 0x01F10 }, { 0x00076A00314ULL, 0x01F11 }, { 0x00076E00300ULL, 0x01F74 },
+	{ 0x00076E00301ULL, 0x003AE }, { 0x00076E00313ULL, 0x01F20 }, { 0x00076E00314ULL, 0x01F21 },
+	{ 0x00076E00342ULL, 0x01FC6 }, { 0x00076E00345ULL, 0x01FC3 }, { 0x00077200300ULL, 0x01F76 },
+	{ 0x00077200301ULL, 0x003AF }, { 0x00077200304ULL, 0x01FD1 }, { 0x00077200306ULL, 0x01FD0 },
+	{ 0x00077200308ULL, 0x003CA }, { 0x00077200313ULL, 0x01F30 }, { 0x00077200314ULL, 0x01F31 },
+	{ 0x00077200342ULL, 0x01FD6 }, { 0x00077E00300ULL, 0x01F78 }, { 0x00077E00301ULL, 0x003CC },
+	{ 0x00077E00313ULL, 0x01F40 }, { 0x00077E00314ULL, 0x01F41 }, { 0x00078200313ULL, 0x01FE4 },
+	{ 0x00078200314ULL, 0x01FE5 }, { 0x00078A00300ULL, 0x01F7A }, { 0x00078A00301ULL, 0x003CD },
+	{ 0x00078A00304ULL, 0x01FE1 }, { 0x00078A00306ULL, 0x01FE0 }, { 0x00078A00308ULL, 0x003CB },
+	{ 0x00078A00313ULL, 0x01F50 }, { 0x00078A00314ULL, 0x01F51 }, { 0x00078A00342ULL, 0x01FE6 },
+	{ 0x00079200300ULL, 0x01F7C }, { 0x00079200301ULL, 0x003CE }, { 0x00079200313ULL, 0x01F60 },
+	{ 0x00079200314ULL, 0x01F61 }, { 0x00079200342ULL, 0x01FF6 }, { 0x00079200345ULL, 0x01FF3 },
+	{ 0x00079400300ULL, 0x01FD2 }, { 0x00079400301ULL, 0x00390 }, { 0x00079400342ULL, 0x01FD7 },
+	{ 0x00079600300ULL, 0x01FE2 }, { 0x00079600301ULL, 0x003B0 }, { 0x00079600342ULL, 0x01FE7 },
+	{ 0x00079C00345ULL, 0x01FF4 }, { 0x0007A400301ULL, 0x003D3 }, { 0x0007A400308ULL, 0x003D4 },
+	{ 0x00080C00308ULL, 0x00407 }, { 0x00082000306ULL, 0x004D0 }, { 0x00082000308ULL, 0x004D2 },
+	{ 0x00082600301ULL, 0x00403 }, { 0x00082A00300ULL, 0x00400 }, { 0x00082A00306ULL, 0x004D6 },
+	{ 0x00082A00308ULL, 0x00401 }, { 0x00082C00306ULL, 0x004C1 }, { 0x00082C00308ULL, 0x004DC },
+	{ 0x00082E00308ULL, 0x004DE }, { 0x00083000300ULL, 0x0040D }, { 0x00083000304ULL, 0x004E2 },
+	{ 0x00083000306ULL, 0x00419 }, { 0x00083000308ULL, 0x004E4 }, { 0x00083400301ULL, 0x0040C },
+	{ 0x00083C00308ULL, 0x004E6 }, { 0x00084600304ULL, 0x004EE }, { 0x00084600306ULL, 0x0040E },
+	{ 0x00084600308ULL, 0x004F0 }, { 0x0008460030BULL, 0x004F2 }, { 0x00084E00308ULL, 0x004F4 },
+	{ 0x00085600308ULL, 0x004F8 }, { 0x00085A00308ULL, 0x004EC }, { 0x00086000306ULL, 0x004D1 },
+	{ 0x00086000308ULL, 0x004D3 }, { 0x00086600301ULL, 0x00453 }, { 0x00086A00300ULL, 0x00450 },
+	{ 0x00086A00306ULL, 0x004D7 }, { 0x00086A00308ULL, 0x00451 }, { 0x00086C00306ULL, 0x004C2 },
+	{ 0x00086C00308ULL, 0x004DD }, { 0x00086E00308ULL, 0x004DF }, { 0x00087000300ULL, 0x0045D },
+	{ 0x00087000304ULL, 0x004E3 }, { 0x00087000306ULL, 0x00439 }, { 0x00087000308ULL, 0x004E5 },
+	{ 0x00087400301ULL, 0x0045C }, { 0x00087C00308ULL, 0x004E7 }, { 0x00088600304ULL, 0x004EF },
+	{ 0x00088600306ULL, 0x0045E }, { 0x00088600308ULL, 0x004F1 }, { 0x0008860030BULL, 0x004F3 },
+	{ 0x00088E00308ULL, 0x004F5 }, { 0x00089600308ULL, 0x004F9 }, { 0x00089A00308ULL, 0x004ED },
+	{ 0x0008AC00308ULL, 0x00457 }, { 0x0008E80030FULL, 0x00476 }, { 0x0008EA0030FULL, 0x00477 },
+	{ 0x0009B000308ULL, 0x004DA }, { 0x0009B200308ULL, 0x004DB }, { 0x0009D000308ULL, 0x004EA },
+	{ 0x0009D200308ULL, 0x004EB }, { 0x000C4E00653ULL, 0x00622 }, { 0x000C4E00654ULL, 0x00623 },
+	{ 0x000C4E00655ULL, 0x00625 }, { 0x000C9000654ULL, 0x00624 }, { 0x000C9400654ULL, 0x00626 },
+	{ 0x000D8200654ULL, 0x006C2 }, { 0x000DA400654ULL, 0x006D3 }, { 0x000DAA00654ULL, 0x006C0 },
+	{ 0x0012500093CULL, 0x00929 }, { 0x0012600093CULL, 0x00931 }, { 0x0012660093CULL, 0x00934 },
+	{ 0x00138E009BEULL, 0x009CB }, { 0x00138E009D7ULL, 0x009CC }, { 0x00168E00B3EULL, 0x00B4B },
+	{ 0x00168E00B56ULL, 0x00B48 }, { 0x00168E00B57ULL, 0x00B4C }, { 0x00172400BD7ULL, 0x00B94 },
+	{ 0x00178C00BBEULL, 0x00BCA }, { 0x00178C00BD7ULL, 0x00BCC }, { 0x00178E00BBEULL, 0x00BCB },
+	{ 0x00188C00C56ULL, 0x00C48 }, { 0x00197E00CD5ULL, 0x00CC0 }, { 0x00198C00CC2ULL, 0x00CCA },
+	{ 0x00198C00CD5ULL, 0x00CC7 }, { 0x00198C00CD6ULL, 0x00CC8 }, { 0x00199400CD5ULL, 0x00CCB },
+	{ 0x001A8C00D3EULL, 0x00D4A }, { 0x001A8C00D57ULL, 0x00D4C }, { 0x001A8E00D3EULL, 0x00D4B },
+	{ 0x001BB200DCAULL, 0x00DDA }, { 0x001BB200DCFULL, 0x00DDC }, { 0x001BB200DDFULL, 0x00DDE },
+	{ 0x001BB800DCAULL, 0x00DDD }, { 0x00204A0102EULL, 0x01026 }, { 0x00360A01B35ULL, 0x01B06 },
+	{ 0x00360E01B35ULL, 0x01B08 }, { 0x00361201B35ULL, 0x01B0A }, { 0x00361601B35ULL, 0x01B0C },
+	{ 0x00361A01B35ULL, 0x01B0E }, { 0x00362201B35ULL, 0x01B12 }, { 0x00367401B35ULL, 0x01B3B },
+	{ 0x00367801B35ULL, 0x01B3D }, { 0x00367C01B35ULL, 0x01B40 }, { 0x00367E01B35ULL, 0x01B41 },
+	{ 0x00368401B35ULL, 0x01B43 }, { 0x003C6C00304ULL, 0x01E38 }, { 0x003C6E00304ULL, 0x01E39 },
+	{ 0x003CB400304ULL, 0x01E5C }, { 0x003CB600304ULL, 0x01E5D }, { 0x003CC400307ULL, 0x01E68 },
+	{ 0x003CC600307ULL, 0x01E69 }, { 0x003D4000302ULL, 0x01EAC }, { 0x003D4000306ULL, 0x01EB6 },
+	{ 0x003D4200302ULL, 0x01EAD }, { 0x003D4200306ULL, 0x01EB7 }, { 0x003D7000302ULL, 0x01EC6 },
+	{ 0x003D7200302ULL, 0x01EC7 }, { 0x003D9800302ULL, 0x01ED8 }, { 0x003D9A00302ULL, 0x01ED9 },
+	{ 0x003E0000300ULL, 0x01F02 }, { 0x003E0000301ULL, 0x01F04 }, { 0x003E0000342ULL, 0x01F06 },
+	{ 0x003E0000345ULL, 0x01F80 }, { 0x003E0200300ULL, 0x01F03 }, { 0x003E0200301ULL, 0x01F05 },
+	{ 0x003E0200342ULL, 0x01F07 }, { 0x003E0200345ULL, 0x01F81 }, { 0x003E0400345ULL, 0x01F82 },
+	{ 0x003E0600345ULL, 0x01F83 }, { 0x003E0800345ULL, 0x01F84 }, { 0x003E0A00345ULL, 0x01F85 },
+	{ 0x003E0C00345ULL, 0x01F86 }, { 0x003E0E00345ULL, 0x01F87 }, { 0x003E1000300ULL, 0x01F0A },
+	{ 0x003E1000301ULL, 0x01F0C }, { 0x003E1000342ULL, 0x01F0E }, { 0x003E1000345ULL, 0x01F88 },
+	{ 0x003E1200300ULL, 0x01F0B }, { 0x003E1200301ULL, 0x01F0D }, { 0x003E1200342ULL, 0x01F0F },
+	{ 0x003E1200345ULL, 0x01F89 }, { 0x003E1400345ULL, 0x01F8A }, { 0x003E1600345ULL, 0x01F8B },
+	{ 0x003E1800345ULL, 0x01F8C }, { 0x003E1A00345ULL, 0x01F8D }, { 0x003E1C00345ULL, 0x01F8E },
+	{ 0x003E1E00345ULL, 0x01F8F }, { 0x003E2000300ULL, 0x01F12 }, { 0x003E2000301ULL, 0x01F14 },
+	{ 0x003E2200300ULL, 0x01F13 }, { 0x003E2200301ULL, 0x01F15 }, { 0x003E3000300ULL, 0x01F1A },
+	{ 0x003E3000301ULL, 0x01F1C }, { 0x003E3200300ULL, 0x01F1B }, { 0x003E3200301ULL, 0x01F1D },
+	{ 0x003E4000300ULL, 0x01F22 }, { 0x003E4000301ULL, 0x01F24 }, { 0x003E4000342ULL, 0x01F26 },
+	{ 0x003E4000345ULL, 0x01F90 }, { 0x003E4200300ULL, 0x01F23 }, { 0x003E4200301ULL, 0x01F25 },
+	{ 0x003E4200342ULL, 0x01F27 }, { 0x003E4200345ULL, 0x01F91 }, { 0x003E4400345ULL, 0x01F92 },
+	{ 0x003E4600345ULL, 0x01F93 }, { 0x003E4800345ULL, 0x01F94 }, { 0x003E4A00345ULL, 0x01F95 },
+	{ 0x003E4C00345ULL, 0x01F96 }, { 0x003E4E00345ULL, 0x01F97 }, { 0x003E5000300ULL, 0x01F2A },
+	{ 0x003E5000301ULL, 0x01F2C }, { 0x003E5000342ULL, 0x01F2E }, { 0x003E5000345ULL, 0x01F98 },
+	{ 0x003E5200300ULL, 0x01F2B }, { 0x003E5200301ULL, 0x01F2D }, { 0x003E5200342ULL, 0x01F2F },
+	{ 0x003E5200345ULL, 0x01F99 }, { 0x003E5400345ULL, 0x01F9A }, { 0x003E5600345ULL, 0x01F9B },
+	{ 0x003E5800345ULL, 0x01F9C }, { 0x003E5A00345ULL, 0x01F9D }, { 0x003E5C00345ULL, 0x01F9E },
+	{ 0x003E5E00345ULL, 0x01F9F }, { 0x003E6000300ULL, 0x01F32 }, { 0x003E6000301ULL, 0x01F34 },
+	{ 0x003E6000342ULL, 0x01F36 }, { 0x003E6200300ULL, 0x01F33 }, { 0x003E6200301ULL, 0x01F35 },
+	{ 0x003E6200342ULL, 0x01F37 }, { 0x003E7000300ULL, 0x01F3A }, { 0x003E7000301ULL, 0x01F3C },
+	{ 0x003E7000342ULL, 0x01F3E }, { 0x003E7200300ULL, 0x01F3B }, { 0x003E7200301ULL, 0x01F3D },
+	{ 0x003E7200342ULL, 0x01F3F }, { 0x003E8000300ULL, 0x01F42 }, { 0x003E8000301ULL, 0x01F44 },
+	{ 0x003E8200300ULL, 0x01F43 }, { 0x003E8200301ULL, 0x01F45 }, { 0x003E9000300ULL, 0x01F4A },
+	{ 0x003E9000301ULL, 0x01F4C }, { 0x003E9200300ULL, 0x01F4B }, { 0x003E9200301ULL, 0x01F4D },
+	{ 0x003EA000300ULL, 0x01F52 }, { 0x003EA000301ULL, 0x01F54 }, { 0x003EA000342ULL, 0x01F56 },
+	{ 0x003EA200300ULL, 0x01F53 }, { 0x003EA200301ULL, 0x01F55 }, { 0x003EA200342ULL, 0x01F57 },
+	{ 0x003EB200300ULL, 0x01F5B }, { 0x003EB200301ULL, 0x01F5D }, { 0x003EB200342ULL, 0x01F5F },
+	{ 0x003EC000300ULL, 0x01F62 }, { 0x003EC000301ULL, 0x01F64 }, { 0x003EC000342ULL, 0x01F66 },
+	{ 0x003EC000345ULL, 0x01FA0 }, { 0x003EC200300ULL, 0x01F63 }, { 0x003EC200301ULL, 0x01F65 },
+	{ 0x003EC200342ULL, 0x01F67 }, { 0x003EC200345ULL, 0x01FA1 }, { 0x003EC400345ULL, 0x01FA2 },
+	{ 0x003EC600345ULL, 0x01FA3 }, { 0x003EC800345ULL, 0x01FA4 }, { 0x003ECA00345ULL, 0x01FA5 },
+	{ 0x003ECC00345ULL, 0x01FA6 }, { 0x003ECE00345ULL, 0x01FA7 }, { 0x003ED000300ULL, 0x01F6A },
+	{ 0x003ED000301ULL, 0x01F6C }, { 0x003ED000342ULL, 0x01F6E }, { 0x003ED000345ULL, 0x01FA8 },
+	{ 0x003ED200300ULL, 0x01F6B }, { 0x003ED200301ULL, 0x01F6D }, { 0x003ED200342ULL, 0x01F6F },
+	{ 0x003ED200345ULL, 0x01FA9 }, { 0x003ED400345ULL, 0x01FAA }, { 0x003ED600345ULL, 0x01FAB },
+	{ 0x003ED800345ULL, 0x01FAC }, { 0x003EDA00345ULL, 0x01FAD }, { 0x003EDC00345ULL, 0x01FAE },
+	{ 0x003EDE00345ULL, 0x01FAF }, { 0x003EE000345ULL, 0x01FB2 }, { 0x003EE800345ULL, 0x01FC2 },
+	{ 0x003EF800345ULL, 0x01FF2 }, { 0x003F6C00345ULL, 0x01FB7 }, { 0x003F7E00300ULL, 0x01FCD },
+	{ 0x003F7E00301ULL, 0x01FCE }, { 0x003F7E00342ULL, 0x01FCF }, { 0x003F8C00345ULL, 0x01FC7 },
+	{ 0x003FEC00345ULL, 0x01FF7 }, { 0x003FFC00300ULL, 0x01FDD }, { 0x003FFC00301ULL, 0x01FDE },
+	{ 0x003FFC00342ULL, 0x01FDF }, { 0x00432000338ULL, 0x0219A }, { 0x00432400338ULL, 0x0219B },
+	{ 0x00432800338ULL, 0x021AE }, { 0x0043A000338ULL, 0x021CD }, { 0x0043A400338ULL, 0x021CF },
+	{ 0x0043A800338ULL, 0x021CE }, { 0x00440600338ULL, 0x02204 }, { 0x00441000338ULL, 0x02209 },
+	{ 0x00441600338ULL, 0x0220C }, { 0x00444600338ULL, 0x02224 }, { 0x00444A00338ULL, 0x02226 },
+	{ 0x00447800338ULL, 0x02241 }, { 0x00448600338ULL, 0x02244 }, { 0x00448A00338ULL, 0x02247 },
+	{ 0x00449000338ULL, 0x02249 }, { 0x00449A00338ULL, 0x0226D }, { 0x0044C200338ULL, 0x02262 },
+	{ 0x0044C800338ULL, 0x02270 }, { 0x0044CA00338ULL, 0x02271 }, { 0x0044E400338ULL, 0x02274 },
+	{ 0x0044E600338ULL, 0x02275 }, { 0x0044EC00338ULL, 0x02278 }, { 0x0044EE00338ULL, 0x02279 },
+	{ 0x0044F400338ULL, 0x02280 }, { 0x0044F600338ULL, 0x02281 }, { 0x0044F800338ULL, 0x022E0 },
+	{ 0x0044FA00338ULL, 0x022E1 }, { 0x00450400338ULL, 0x02284 }, { 0x00450600338ULL, 0x02285 },
+	{ 0x00450C00338ULL, 0x02288 }, { 0x00450E00338ULL, 0x02289 }, { 0x00452200338ULL, 0x022E2 },
+	{ 0x00452400338ULL, 0x022E3 }, { 0x00454400338ULL, 0x022AC }, { 0x00455000338ULL, 0x022AD },
+	{ 0x00455200338ULL, 0x022AE }, { 0x00455600338ULL, 0x022AF }, { 0x00456400338ULL, 0x022EA },
+	{ 0x00456600338ULL, 0x022EB }, { 0x00456800338ULL, 0x022EC }, { 0x00456A00338ULL, 0x022ED },
+	{ 0x00608C03099ULL, 0x03094 }, { 0x00609603099ULL, 0x0304C }, { 0x00609A03099ULL, 0x0304E },
+	{ 0x00609E03099ULL, 0x03050 }, { 0x0060A203099ULL, 0x03052 }, { 0x0060A603099ULL, 0x03054 },
+	{ 0x0060AA03099ULL, 0x03056 }, { 0x0060AE03099ULL, 0x03058 }, { 0x0060B203099ULL, 0x0305A },
+	{ 0x0060B603099ULL, 0x0305C }, { 0x0060BA03099ULL, 0x0305E }, { 0x0060BE03099ULL, 0x03060 },
+	{ 0x0060C203099ULL, 0x03062 }, { 0x0060C803099ULL, 0x03065 }, { 0x0060CC03099ULL, 0x03067 },
+	{ 0x0060D003099ULL, 0x03069 }, { 0x0060DE03099ULL, 0x03070 }, { 0x0060DE0309AULL, 0x03071 },
+	{ 0x0060E403099ULL, 0x03073 }, { 0x0060E40309AULL, 0x03074 }, { 0x0060EA03099ULL, 0x03076 },
+	{ 0x0060EA0309AULL, 0x03077 }, { 0x0060F003099ULL, 0x03079 }, { 0x0060F00309AULL, 0x0307A },
+	{ 0x0060F603099ULL, 0x0307C }, { 0x0060F60309AULL, 0x0307D }, { 0x00613A03099ULL, 0x0309E },
+	{ 0x00614C03099ULL, 0x030F4 }, { 0x00615603099ULL, 0x030AC }, { 0x00615A03099ULL, 0x030AE },
+	{ 0x00615E03099ULL, 0x030B0 }, { 0x00616203099ULL, 0x030B2 }, { 0x00616603099ULL, 0x030B4 },
+	{ 0x00616A03099ULL, 0x030B6 }, { 0x00616E03099ULL, 0x030B8 }, { 0x00617203099ULL, 0x030BA },
+	{ 0x00617603099ULL, 0x030BC }, { 0x00617A03099ULL, 0x030BE }, { 0x00617E03099ULL, 0x030C0 },
+	{ 0x00618203099ULL, 0x030C2 }, { 0x00618803099ULL, 0x030C5 }, { 0x00618C03099ULL, 0x030C7 },
+	{ 0x00619003099ULL, 0x030C9 }, { 0x00619E03099ULL, 0x030D0 }, { 0x00619E0309AULL, 0x030D1 },
+	{ 0x0061A403099ULL, 0x030D3 }, { 0x0061A40309AULL, 0x030D4 }, { 0x0061AA03099ULL, 0x030D6 },
+	{ 0x0061AA0309AULL, 0x030D7 }, { 0x0061B003099ULL, 0x030D9 }, { 0x0061B00309AULL, 0x030DA },
+	{ 0x0061B603099ULL, 0x030DC }, { 0x0061B60309AULL, 0x030DD }, { 0x0061DE03099ULL, 0x030F7 },
+	{ 0x0061E003099ULL, 0x030F8 }, { 0x0061E203099ULL, 0x030F9 }, { 0x0061E403099ULL, 0x030FA },
+	{ 0x0061FA03099ULL, 0x030FE }, { 0x022132110BAULL, 0x1109A }, { 0x022136110BAULL, 0x1109C },
+	{ 0x02214A110BAULL, 0x110AB }, { 0x02226211127ULL, 0x1112E }, { 0x02226411127ULL, 0x1112F },
+	{ 0x02268E1133EULL, 0x1134B }, { 0x02268E11357ULL, 0x1134C }, { 0x022972114B0ULL, 0x114BC },
+	{ 0x022972114BAULL, 0x114BB }, { 0x022972114BDULL, 0x114BE }, { 0x022B70115AFULL, 0x115BA },
+	{ 0x022B72115AFULL, 0x115BB }, { 0x02326A11930ULL, 0x11938 }
+};
+
+#endif //TAG_NORMALIZE_TABLES_H_INCLUDED
@@ -0,0 +1,470 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ogg_tag.h"
+#include "vorbis_comment.h"
+#include "utils.h"
+#include "unicode_support.h"
+#include "log.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Ogg constants
+///////////////////////////////////////////////////////////////////////////////
+
+static const char OGG_ID[4] = { 'O', 'g', 'g', 'S' };
+
+static const size_t OGG_HEADER_SIZE  = 27;
+static const size_t OGG_MAX_SEGMENTS = 255;
+static const size_t OGG_CRC_OFFSET   = 22;
+
+static const unsigned int OGG_FLAG_CONTINUED = 0x01;
+static const unsigned int OGG_FLAG_BOS       = 0x02;
+static const unsigned int OGG_FLAG_EOS       = 0x04;
+
+static const char VORBIS_ID_HEADER[7]      = { 0x01, 'v', 'o', 'r', 'b', 'i', 's' };
+static const char VORBIS_COMMENT_HEADER[7] = { 0x03, 'v', 'o', 'r', 'b', 'i', 's' };
+static const char OPUS_ID_HEADER[8]        = { 'O', 'p', 'u', 's', 'H', 'e', 'a', 'd' };
+static const char OPUS_COMMENT_HEADER[8]   = { 'O', 'p', 'u', 's', 'T', 'a', 'g', 's' };
+
+static const size_t OGG_NEW_PADDING = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+// Ogg CRC-32 (polynomial 0x04C11DB7, MSB first, slicing-by-8)
+///////////////////////////////////////////////////////////////////////////////
+
+static const struct ogg_crc_init_t
+{
+	ogg_crc_init_t(void)
+	{
+		for(uint32_t i = 0; i < 256; i++)
+		{
+			uint32_t crc = i << 24;
+			for(int k = 0; k < 8; k++)
+			{
+				crc = (crc & 0x80000000) ? ((crc << 1) ^ 0x04C11DB7) : (crc << 1);
+			}
+			table[0][i] = crc;
+		}
+		for(int t = 1; t < 8; t++)
+		{
+			for(uint32_t i = 0; i < 256; i++)
+			{
+				table[t][i] = (table[t - 1][i] << 8) ^ table[0][table[t - 1][i] >> 24];
+			}
+		}
+	}
+
+	uint32_t table[8][256];
+}
+g_oggCrc;
+
+static uint32_t ogg_crc_update(uint32_t crc, const unsigned char *data, size_t len)
+{
+	const uint32_t (*const t)[256] = g_oggCrc.table;
+	for(; len >= 8; len -= 8, data += 8)
+	{
+		crc ^= (((uint32_t)data[0]) << 24) | (((uint32_t)data[1]) << 16) | (((uint32_t)data[2]) << 8) | ((uint32_t)data[3]);
+		crc = t[7][crc >> 24] ^ t[6][(crc >> 16) & 0xFF] ^ t[5][(crc >> 8) & 0xFF] ^ t[4][crc & 0xFF] ^ t[3][data[4]] ^ t[2][data[5]] ^ t[1][data[6]] ^ t[0][data[7]];
+	}
+	while(len--)
+	{
+		crc = (crc << 8) ^ t[0][(crc >> 24) ^ (*data++)];
+	}
+	return crc;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+inline static uint32_t read_uint32_le(const unsigned char *src)
+{
+	return ((uint32_t)src[0]) | (((uint32_t)src[1]) << 8) | (((uint32_t)src[2]) << 16) | (((uint32_t)src[3]) << 24);
+}
+
+inline static void write_uint32_le(unsigned char *dest, const uint32_t value)
+{
+	dest[0] = (unsigned char)((value >>  0) & 0xFF);
+	dest[1] = (unsigned char)((value >>  8) & 0xFF);
+	dest[2] = (unsigned char)((value >> 16) & 0xFF);
+	dest[3] = (unsigned char)((value >> 24) & 0xFF);
+}
+
+//Computes the CRC of a complete page and stores it in the page header
+static void update_page_crc(unsigned char *page, const size_t size)
+{
+	write_uint32_le(&page[OGG_CRC_OFFSET], 0);
+	write_uint32_le(&page[OGG_CRC_OFFSET], ogg_crc_update(0, page, size));
+}
+
+static void append_page(std::vector<unsigned char> &dest, const unsigned int flags, const uint64_t granule, const uint32_t serial, const uint32_t seqno, const std::vector<unsigned char> &lacing, const std::vector<unsigned char> &data)
+{
+	const size_t offset = dest.size();
+	dest.resize(offset + OGG_HEADER_SIZE);
+
+	unsigned char *const header = &dest[offset];
+	memcpy(&header[0], OGG_ID, 4);
+	header[4] = 0; /*version*/
+	header[5] = (unsigned char) flags;
+	write_uint32_le(&header[ 6], (uint32_t)(granule & 0xFFFFFFFF));
+	write_uint32_le(&header[10], (uint32_t)(granule >> 32));
+	write_uint32_le(&header[14], serial);
+	write_uint32_le(&header[18], seqno);
+	header[26] = (unsigned char) lacing.size();
+
+	dest.insert(dest.end(), lacing.cbegin(), lacing.cend());
+	dest.insert(dest.end(), data.cbegin(), data.cend());
+	update_page_crc(&dest[offset], dest.size() - offset);
+}
+
+//Size of the header pages, as created by paginate(), for packets of the given total size and lacing count
+static uint64_t paginated_size(const uint64_t dataSize, const uint64_t segments, unsigned int &pages)
+{
+	pages = (unsigned int)((segments + OGG_MAX_SEGMENTS - 1) / OGG_MAX_SEGMENTS);
+	return (pages * OGG_HEADER_SIZE) + segments + dataSize;
+}
+
+static inline uint64_t lacing_count(const uint64_t packetSize)
+{
+	return (packetSize / 255) + 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Ogg Tagger
+///////////////////////////////////////////////////////////////////////////////
+
+bool OggTagger::writeTags(const char *fileName, const std::vector<TagItem*> &items)
+{
+	FILE *file = fopen_utf8(fileName, "r+b");
+	if(!file)
+	{
+		LOG("File operation has failed:\nUnable to open the Ogg file for update!\n\n");
+		return false;
+	}
+
+	//Collect the header packets that follow the identification header
+	bool isOpus = false;
+	page_t firstPage;
+	uint64_t headerEnd = 0;
+	unsigned int headerPages = 0;
+	std::vector<packet_t> packets;
+	if(!readHeaders(file, isOpus, firstPage, headerEnd, headerPages, packets))
+	{
+		fclose(file);
+		return false;
+	}
+
+	//Merge the existing comments with the new items
+	const char *const prefix = isOpus ? OPUS_COMMENT_HEADER : VORBIS_COMMENT_HEADER;
+	const size_t prefixLen = isOpus ? sizeof(OPUS_COMMENT_HEADER) : sizeof(VORBIS_COMMENT_HEADER);
+
+	std::vector<unsigned char> vendor, body;
+	std::vector<std::vector<unsigned char>> comments;
+	if((packets[0].size() < prefixLen) || (memcmp(packets[0].data(), prefix, prefixLen) != 0) || (!VorbisComment::parse(&packets[0][prefixLen], packets[0].size() - prefixLen, vendor, comments)))
+	{
+		LOG("File operation has failed:\nThe existing comment header is malformed!\n\n");
+		fclose(file);
+		return false;
+	}
+	VorbisComment::build(items, vendor, comments, body);
+	LOG_VERBOSE("\n");
+
+	packet_t &comment = packets[0];
+	comment.assign(prefix, prefix + prefixLen);
+	comment.insert(comment.end(), body.cbegin(), body.cend());
+	if(!isOpus)
+	{
+		comment.push_back(0x01); /*framing bit*/
+	}
+
+	//Decoders ignore data after the comment list, so padding can make the new header pages match the old layout exactly
+	uint64_t dataSize = 0, segments = 0;
+	for(std::vector<packet_t>::const_iterator iter = packets.cbegin(); iter != packets.cend(); iter++)
+	{
+		dataSize += iter->size();
+		segments += lacing_count(iter->size());
+	}
+
+	const uint64_t oldSize = headerEnd - firstPage.size;
+	const size_t commentSize = comment.size();
+	size_t padding = 0;
+	bool fits = false;
+	for(;;)
+	{
+		unsigned int pages;
+		const uint64_t size = paginated_size(dataSize + padding, segments - lacing_count(commentSize) + lacing_count(commentSize + padding), pages);
+		if(size >= oldSize)
+		{
+			fits = (size == oldSize) && (pages == headerPages);
+			break;
+		}
+		padding++;
+	}
+
+	std::vector<const packet_t*> packetPtrs;
+	for(std::vector<packet_t>::const_iterator iter = packets.cbegin(); iter != packets.cend(); iter++)
+	{
+		packetPtrs.push_back(&(*iter));
+	}
+
+	std::vector<unsigned char> pages;
+	const uint32_t firstSeqno = firstPage.seqno + 1;
+
+	if(fits)
+	{
+		comment.resize(commentSize + padding, 0x00);
+		paginate(packetPtrs, firstPage.serial, firstSeqno, pages);
+
+		bool success = (_fseeki64(file, firstPage.size, SEEK_SET) == 0);
+		success = success && (fwrite(pages.data(), sizeof(unsigned char), pages.size(), file) == pages.size());
+		success = (fclose(file) == 0) && success;
+
+		if(!success)
+		{
+			LOG("File operation has failed:\nUnable to update the header pages in place!\n\n");
+		}
+		return success;
+	}
+
+	//The header pages change in size, so the whole file needs to be re-written
+	LOG_VERBOSE("Header pages do not fit the existing layout, re-writing the complete file!\n\n");
+
+	comment.resize(commentSize + OGG_NEW_PADDING, 0x00);
+	const unsigned int newPages = paginate(packetPtrs, firstPage.serial, firstSeqno, pages);
+
+	const std::string tempName = std::string(fileName) + ".tmp";
+	const bool success = rewriteFile(tempName.c_str(), file, firstPage, headerEnd, pages, ((int) newPages) - ((int) headerPages));
+	fclose(file);
+
+	if(!success)
+	{
+		unlink_utf8(tempName.c_str());
+		return false;
+	}
+	if(rename_utf8(tempName.c_str(), fileName) != 0)
+	{
+		LOG("File operation has failed:\nUnable to replace the original file!\n\n");
+		unlink_utf8(tempName.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+//Reads the complete page at the current position, the page header is at the start of the buffer
+bool OggTagger::readPage(FILE *file, page_t &page, std::vector<unsigned char> &buffer)
+{
+	const int64_t offset = _ftelli64(file);
+	buffer.resize(OGG_HEADER_SIZE + OGG_MAX_SEGMENTS);
+
+	if((offset < 0) || (fread(buffer.data(), sizeof(unsigned char), OGG_HEADER_SIZE, file) != OGG_HEADER_SIZE) || (memcmp(buffer.data(), OGG_ID, 4) != 0) || (buffer[4] != 0))
+	{
+		return false;
+	}
+
+	page.offset   = offset;
+	page.flags    = buffer[5];
+	page.serial   = read_uint32_le(&buffer[14]);
+	page.seqno    = read_uint32_le(&buffer[18]);
+	page.segments = buffer[26];
+
+	if(fread(&buffer[OGG_HEADER_SIZE], sizeof(unsigned char), page.segments, file) != page.segments)
+	{
+		return false;
+	}
+
+	size_t dataSize = 0;
+	for(size_t i = 0; i < page.segments; i++)
+	{
+		dataSize += buffer[OGG_HEADER_SIZE + i];
+	}
+
+	page.size = OGG_HEADER_SIZE + page.segments + dataSize;
+	buffer.resize(page.size);
+	return (fread(&buffer[OGG_HEADER_SIZE + page.segments], sizeof(unsigned char), dataSize, file) == dataSize);
+}
+
+bool OggTagger::readHeaders(FILE *file, bool &isOpus, page_t &firstPage, uint64_t &headerEnd, unsigned int &headerPages, std::vector<packet_t> &packets)
+{
+	std::vector<unsigned char> buffer;
+
+	//The identification header must be the only packet on the first page
+	if((_fseeki64(file, 0, SEEK_SET) != 0) || (!readPage(file, firstPage, buffer)) || (!(firstPage.flags & OGG_FLAG_BOS)) || (firstPage.segments != 1))
+	{
+		LOG("File operation has failed:\nThe file is not a valid Ogg stream!\n\n");
+		return false;
+	}
+
+	const unsigned char *const idHeader = &buffer[OGG_HEADER_SIZE + 1];
+	const size_t idSize = buffer[OGG_HEADER_SIZE];
+	if((idSize >= sizeof(OPUS_ID_HEADER)) && (memcmp(idHeader, OPUS_ID_HEADER, sizeof(OPUS_ID_HEADER)) == 0))
+	{
+		isOpus = true;
+	}
+	else if((idSize >= sizeof(VORBIS_ID_HEADER)) && (memcmp(idHeader, VORBIS_ID_HEADER, sizeof(VORBIS_ID_HEADER)) == 0))
+	{
+		isOpus = false;
+	}
+	else
+	{
+		LOG("File operation has failed:\nThe Ogg stream contains neither Vorbis nor Opus audio!\n\n");
+		return false;
+	}
+
+	//Vorbis has the comment and the setup header, Opus only has the comment header
+	const size_t required = isOpus ? 1 : 2;
+	packet_t current;
+	page_t page;
+	headerPages = 0;
+	packets.clear();
+
+	while(packets.size() < required)
+	{
+		if(!readPage(file, page, buffer))
+		{
+			LOG("File operation has failed:\nThe Ogg header pages are truncated or malformed!\n\n");
+			return false;
+		}
+		if((page.serial != firstPage.serial) || (page.flags & OGG_FLAG_BOS))
+		{
+			LOG("File operation has failed:\nMultiplexed Ogg streams are not supported!\n\n");
+			return false;
+		}
+
+		headerPages++;
+		size_t dataPos = OGG_HEADER_SIZE + page.segments;
+		for(size_t i = 0; i < page.segments; i++)
+		{
+			const size_t len = buffer[OGG_HEADER_SIZE + i];
+			if(packets.size() >= required)
+			{
+				LOG("File operation has failed:\nAudio data starts on the last header page, not supported!\n\n");
+				return false;
+			}
+			current.insert(current.end(), &buffer[dataPos], &buffer[dataPos] + len);
+			dataPos += len;
+			if(len < 255)
+			{
+				packets.push_back(packet_t());
+				packets.back().swap(current);
+			}
+		}
+	}
+
+	headerEnd = page.offset + page.size;
+	return true;
+}
+
+//Splits the packets into pages of up to 255 segments, the last packet always completes the last page
+unsigned int OggTagger::paginate(const std::vector<const packet_t*> &packets, const uint32_t serial, const uint32_t seqno, std::vector<unsigned char> &dest)
+{
+	std::vector<unsigned char> lacing, data;
+	unsigned int pages = 0;
+	bool continued = false, packetEnds = false;
+
+	dest.clear();
+	for(size_t p = 0; p < packets.size(); p++)
+	{
+		const packet_t &packet = *packets[p];
+		size_t pos = 0, len;
+		do
+		{
+			len = ((packet.size() - pos) > 255) ? 255 : (packet.size() - pos);
+			lacing.push_back((unsigned char) len);
+			data.insert(data.end(), packet.data() + pos, packet.data() + pos + len);
+			pos += len;
+			packetEnds = packetEnds || (len < 255);
+
+			if((lacing.size() == OGG_MAX_SEGMENTS) || ((len < 255) && (p + 1 == packets.size())))
+			{
+				//Pages on which no packet ends have no granule position
+				append_page(dest, continued ? OGG_FLAG_CONTINUED : 0, packetEnds ? 0 : UINT64_MAX, serial, seqno + pages, lacing, data);
+				continued = (len == 255);
+				packetEnds = false;
+				lacing.clear();
+				data.clear();
+				pages++;
+			}
+		}
+		while(len == 255);
+	}
+
+	return pages;
+}
+
+bool OggTagger::rewriteFile(const char *tempName, FILE *file, const page_t &firstPage, const uint64_t headerEnd, const std::vector<unsigned char> &headerPages, const int seqnoDelta)
+{
+	uint64_t fileSize = 0;
+	if(!get_file_size(file, fileSize))
+	{
+		return false;
+	}
+
+	FILE *temp = fopen_utf8(tempName, "wb");
+	if(!temp)
+	{
+		LOG("File operation has failed:\nUnable to create temporary file!\n\n");
+		return false;
+	}
+
+	//Copy the identification page and write the new header pages
+	bool success = (_fseeki64(file, 0, SEEK_SET) == 0) && copy_file_data(file, temp, firstPage.size);
+	success = success && (fwrite(headerPages.data(), sizeof(unsigned char), headerPages.size(), temp) == headerPages.size());
+	success = success && (_fseeki64(file, headerEnd, SEEK_SET) == 0);
+
+	//The audio pages of the stream need new sequence numbers (and thus new CRCs), unless the page count is unchanged
+	uint64_t position = headerEnd;
+	if(seqnoDelta != 0)
+	{
+		std::vector<unsigned char> buffer;
+		page_t page;
+		bool streamEnded = false;
+
+		while(success && (position < fileSize) && readPage(file, page, buffer))
+		{
+			if((!streamEnded) && (page.serial == firstPage.serial))
+			{
+				write_uint32_le(&buffer[18], page.seqno + seqnoDelta);
+				update_page_crc(buffer.data(), buffer.size());
+				streamEnded = ((page.flags & OGG_FLAG_EOS) != 0);
+			}
+			success = (fwrite(buffer.data(), sizeof(unsigned char), buffer.size(), temp) == buffer.size());
+			position += page.size;
+		}
+	}
+
+	//Data that is not a valid page (e.g. a trailing tag) is copied unchanged
+	success = success && (_fseeki64(file, position, SEEK_SET) == 0) && copy_file_data(file, temp, fileSize - position);
+
+	success = (fclose(temp) == 0) && success;
+	if(!success)
+	{
+		LOG("File operation has failed:\nUnable to write the temporary file!\n\n");
+	}
+
+	return success;
+}
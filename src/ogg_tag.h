@@ -0,0 +1,57 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef OGG_TAGGER_H_INCLUDED
+#define OGG_TAGGER_H_INCLUDED
+
+#include <cstdio>
+#include <vector>
+#include <stdint.h>
+
+class TagItem;
+
+class OggTagger
+{
+public:
+	static bool writeTags(const char *fileName, const std::vector<TagItem*> &items);
+
+private:
+	typedef struct
+	{
+		uint64_t offset;
+		uint32_t serial;
+		uint32_t seqno;
+		unsigned int flags;
+		size_t segments;
+		size_t size;
+	}
+	page_t;
+
+	typedef std::vector<unsigned char> packet_t;
+
+	static bool readPage(FILE *file, page_t &page, std::vector<unsigned char> &buffer);
+	static bool readHeaders(FILE *file, bool &isOpus, page_t &firstPage, uint64_t &headerEnd, unsigned int &headerPages, std::vector<packet_t> &packets);
+	static unsigned int paginate(const std::vector<const packet_t*> &packets, const uint32_t serial, const uint32_t seqno, std::vector<unsigned char> &dest);
+	static bool rewriteFile(const char *tempName, FILE *file, const page_t &firstPage, const uint64_t headerEnd, const std::vector<unsigned char> &headerPages, const int seqnoDelta);
+};
+
+#endif //OGG_TAGGER_H_INCLUDED
@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TAG_OPTIONS_H_INCLUDED
+#define TAG_OPTIONS_H_INCLUDED
+
+#include "log.h"
+
+#include <stdint.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Types
+///////////////////////////////////////////////////////////////////////////////
+
+//Formats are bit flags, APE2, ID3V1 and ID3V2 may be combined
+typedef enum
+{
+	TAG_FORMAT_APE2  = 0x01,
+	TAG_FORMAT_FLAC  = 0x02,
+	TAG_FORMAT_MP4   = 0x04,
+	TAG_FORMAT_OGG   = 0x08,
+	TAG_FORMAT_ID3V1 = 0x10,
+	TAG_FORMAT_ID3V2 = 0x20
+}
+TagFormat;
+
+static const unsigned int TAG_FORMATS_CONTAINER = TAG_FORMAT_FLAC | TAG_FORMAT_MP4 | TAG_FORMAT_OGG;
+
+typedef enum
+{
+	STAGE_STAT      = 0,
+	STAGE_READ      = 1,
+	STAGE_SERIALIZE = 2,
+	STAGE_WRITE     = 3,
+	STAGE_COUNT     = 4
+}
+PipelineStage;
+
+typedef enum
+{
+	SINK_STDIO  = 0,
+	SINK_PWRITE = 1,
+	SINK_MMAP   = 2,
+	SINK_MEMORY = 3
+}
+SinkType;
+
+///////////////////////////////////////////////////////////////////////////////
+// Options
+///////////////////////////////////////////////////////////////////////////////
+
+class TagOptions
+{
+public:
+	TagOptions(void)
+	:
+		formats(TAG_FORMAT_APE2),
+		sink(SINK_STDIO),
+		replayGain(false),
+		checksum(false),
+		physicalOrder(false),
+		shardIndex(0),
+		shardCount(1),
+		journal(NULL),
+		trace(NULL),
+		watch(false),
+		rules(NULL),
+		debounce(500),
+		normalize(false),
+		copyFrom(NULL),
+		strip(false),
+		migrate(false),
+		index(NULL),
+		query(NULL),
+		verify(false),
+		memoryLimit(0),
+		cacheLimit(64U << 20),
+		logLevel(LOG_LEVEL_SUMMARY),
+		logFormat(LOG_FORMAT_TEXT)
+	{
+		stageThreads[STAGE_STAT     ] = 2;
+		stageThreads[STAGE_READ     ] = 4;
+		stageThreads[STAGE_SERIALIZE] = 2;
+		stageThreads[STAGE_WRITE    ] = 2;
+	}
+
+	unsigned int formats;
+	SinkType sink;
+	unsigned int stageThreads[STAGE_COUNT];
+	bool replayGain;
+	bool checksum;
+	bool physicalOrder;
+	unsigned int shardIndex;
+	unsigned int shardCount;
+	const char *journal;
+	const char *trace;
+	bool watch;
+	const char *rules;
+	unsigned int debounce;
+	bool normalize;
+	const char *copyFrom;
+	bool strip;
+	bool migrate;
+	const char *index;
+	const char *query;
+	bool verify;
+	uint64_t memoryLimit;
+	uint64_t cacheLimit;
+	LogLevel logLevel;
+	LogFormat logFormat;
+};
+
+#endif //TAG_OPTIONS_H_INCLUDED
@@ -23,13 +23,17 @@
 #include "parser.h"
 #include "types.h"
 #include "keys.h"
+#include "options.h"
+#include "normalize.h"
+#include "binary_cache.h"
+#include "log.h"
 
 #include <cstdio>
 #include <cstring>
 #include <stdexcept>
 
-//Macros
-#define LOG(...) fprintf(stderr, __VA_ARGS__)
+//Const
+static const unsigned int MAX_THREADS = 64;
 
 ///////////////////////////////////////////////////////////////////////////////
 // Helper functions
@@ -53,82 +57,311 @@ static void trim(char **str)
 	}
 }
 
+static bool check_threads(const unsigned int *threads, const size_t count)
+{
+	for(size_t i = 0; i < count; i++)
+	{
+		if((threads[i] < 1) || (threads[i] > MAX_THREADS))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // CLI Parser
 ///////////////////////////////////////////////////////////////////////////////
 
-bool TagParser::parse(int argc, char* argv[], std::vector<TagItem*> &items)
+bool TagParser::parse(int argc, char* argv[], std::vector<TagItem*> &items, const bool normalize)
 {
 	for(int i = 3; i < argc; i++)
 	{
-		char *tmp = _strdup(argv[i]);
-		char *key = tmp;
-		char *val = strchr(tmp, '=');
-
-		if(val == NULL)
+		if(!parseItem(argv[i], items, normalize))
 		{
-			LOG("Separator is missing in tag specification:\n%s\n\n", argv[i]);
-			free(tmp);
 			return false;
 		}
+	}
+	
+	return true;
+}
+
+bool TagParser::parseItem(const char *spec, std::vector<TagItem*> &items, const bool normalize)
+{
+	char *tmp = _strdup(spec);
+	char *key = tmp;
+	char *val = strchr(tmp, '=');
+
+	if(val == NULL)
+	{
+		LOG("Separator is missing in tag specification:\n%s\n\n", spec);
+		free(tmp);
+		return false;
+	}
 
-		*val++ = '\0';
-		trim(&key); trim(&val);
+	*val++ = '\0';
+	trim(&key); trim(&val);
 
-		if(!(val[0] && key[0]))
+	if(!(val[0] && key[0]))
+	{
+		LOG("Key or value is empty in tag specification:\n\"%s\" = \"%s\"\n\n", key, val);
+		free(tmp);
+		return false;
+	}
+
+	bool ok = false;
+
+	for(int j = 0; g_tagSpec[j].key != NULL; j++)
+	{
+		if(_stricmp(key, g_tagSpec[j].key) == 0)
 		{
-			LOG("Key or value is empty in tag specification:\n\"%s\" = \"%s\"\n\n", key, val);
-			free(tmp);
-			return false;
+			switch(g_tagSpec[j].type)
+			{
+			case TAG_TYPE_STRING:
+				ok = parseString(g_tagSpec[j].key, val, items, normalize);
+				break;
+			case TAG_TYPE_NUMBER:
+				ok = parseNumber(g_tagSpec[j].key, val, items);
+				break;
+			case TAG_TYPE_DATE:
+				ok = parseDate  (g_tagSpec[j].key, val, items);
+				break;
+			case TAG_TYPE_BINARY:
+				ok = parseBinary(g_tagSpec[j].key, val, items);
+				break;
+			default:
+				throw std::runtime_error("Bad tag type!");
+			}
+			
+			if(!ok)
+			{
+				LOG("Tag specification contains a malformed value:\n\"%s\" = \"%s\"\n\n", key, val);
+				free(tmp);
+				return false;
+			}
 		}
+	}
+
+	if(!ok)
+	{
+		LOG("Tag specification uses an unknown key:\n\"%s\" = \"%s\"\n\n", key, val);
+		free(tmp);
+		return false;
+	}
 
-		bool ok = false;
+	free(tmp);
+	return true;
+}
 
-		for(int j = 0; g_tagSpec[j].key != NULL; j++)
+int TagParser::parseOptions(int argc, char* argv[], TagOptions &options)
+{
+	int i = 1;
+
+	for(; (i < argc) && (strncmp(argv[i], "--", 2) == 0); i++)
+	{
+		const char *const arg = argv[i];
+
+		if(_strnicmp(arg, "--stages=", 9) == 0)
 		{
-			if(_stricmp(key, g_tagSpec[j].key) == 0)
+			unsigned int *const n = options.stageThreads;
+			if((sscanf(&arg[9], "%u,%u,%u,%u", &n[STAGE_STAT], &n[STAGE_READ], &n[STAGE_SERIALIZE], &n[STAGE_WRITE]) != 4) || (!check_threads(n, STAGE_COUNT)))
 			{
-				switch(g_tagSpec[j].type)
-				{
-				case TAG_TYPE_STRING:
-					ok = parseString(g_tagSpec[j].key, val, items);
-					break;
-				case TAG_TYPE_NUMBER:
-					ok = parseNumber(g_tagSpec[j].key, val, items);
-					break;
-				case TAG_TYPE_DATE:
-					ok = parseDate  (g_tagSpec[j].key, val, items);
-					break;
-				default:
-					throw std::runtime_error("Bad tag type!");
-				}
-				
-				if(!ok)
-				{
-					LOG("Tag specification contains a malformed value:\n\"%s\" = \"%s\"\n\n", key, val);
-					free(tmp);
-					return false;
-				}
+				LOG("Invalid pipeline stage specification:\n%s\n\n", arg);
+				return -1;
 			}
 		}
-
-		if(!ok)
+		else if(_strnicmp(arg, "--sink=", 7) == 0)
 		{
-			LOG("Tag specification uses an unknown key:\n\"%s\" = \"%s\"\n\n", key, val);
-			free(tmp);
-			return false;
+			static const char *const SINK_NAMES[] = { "stdio", "pwrite", "mmap", "memory", NULL };
+			int type = -1;
+			for(int j = 0; SINK_NAMES[j]; j++)
+			{
+				if(_stricmp(&arg[7], SINK_NAMES[j]) == 0) type = j;
+			}
+			if(type < 0)
+			{
+				LOG("Unknown output sink:\n%s\n\n", arg);
+				return -1;
+			}
+			options.sink = (SinkType) type;
+		}
+		else if(_strnicmp(arg, "--log-level=", 12) == 0)
+		{
+			static const char *const LEVEL_NAMES[] = { "quiet", "summary", "verbose", NULL };
+			int level = -1;
+			for(int j = 0; LEVEL_NAMES[j]; j++)
+			{
+				if(_stricmp(&arg[12], LEVEL_NAMES[j]) == 0) level = j;
+			}
+			if(level < 0)
+			{
+				LOG("Unknown log level:\n%s\n\n", arg);
+				return -1;
+			}
+			options.logLevel = (LogLevel) level;
+		}
+		else if(_strnicmp(arg, "--log-format=", 13) == 0)
+		{
+			static const char *const FORMAT_NAMES[] = { "text", "json", NULL };
+			int format = -1;
+			for(int j = 0; FORMAT_NAMES[j]; j++)
+			{
+				if(_stricmp(&arg[13], FORMAT_NAMES[j]) == 0) format = j;
+			}
+			if(format < 0)
+			{
+				LOG("Unknown log format:\n%s\n\n", arg);
+				return -1;
+			}
+			options.logFormat = (LogFormat) format;
+		}
+		else if(_strnicmp(arg, "--shard=", 8) == 0)
+		{
+			unsigned int index, count;
+			if((sscanf(&arg[8], "%u/%u", &index, &count) != 2) || (count < 1) || (index < 1) || (index > count))
+			{
+				LOG("Invalid shard specification:\n%s\n\n", arg);
+				return -1;
+			}
+			options.shardIndex = index - 1;
+			options.shardCount = count;
+		}
+		else if(_strnicmp(arg, "--journal=", 10) == 0)
+		{
+			if(!arg[10])
+			{
+				LOG("Journal file name is missing:\n%s\n\n", arg);
+				return -1;
+			}
+			options.journal = &arg[10];
+		}
+		else if(_strnicmp(arg, "--trace=", 8) == 0)
+		{
+			if(!arg[8])
+			{
+				LOG("Trace file name is missing:\n%s\n\n", arg);
+				return -1;
+			}
+			options.trace = &arg[8];
+		}
+		else if(_strnicmp(arg, "--rules=", 8) == 0)
+		{
+			if(!arg[8])
+			{
+				LOG("Rules file name is missing:\n%s\n\n", arg);
+				return -1;
+			}
+			options.rules = &arg[8];
+		}
+		else if(_strnicmp(arg, "--copy-from=", 12) == 0)
+		{
+			if(!arg[12])
+			{
+				LOG("Source file name is missing:\n%s\n\n", arg);
+				return -1;
+			}
+			options.copyFrom = &arg[12];
+		}
+		else if(_strnicmp(arg, "--index=", 8) == 0)
+		{
+			if(!arg[8])
+			{
+				LOG("Index file name is missing:\n%s\n\n", arg);
+				return -1;
+			}
+			options.index = &arg[8];
+		}
+		else if(_strnicmp(arg, "--query=", 8) == 0)
+		{
+			if(!arg[8])
+			{
+				LOG("Index file name is missing:\n%s\n\n", arg);
+				return -1;
+			}
+			options.query = &arg[8];
+		}
+		else if(_strnicmp(arg, "--memory=", 9) == 0)
+		{
+			unsigned int megabytes;
+			if((sscanf(&arg[9], "%u", &megabytes) != 1) || (megabytes < 1) || (megabytes > 1048576U))
+			{
+				LOG("Invalid memory budget:\n%s\n\n", arg);
+				return -1;
+			}
+			options.memoryLimit = ((uint64_t) megabytes) << 20;
+		}
+		else if(_strnicmp(arg, "--cache=", 8) == 0)
+		{
+			unsigned int megabytes;
+			if((sscanf(&arg[8], "%u", &megabytes) != 1) || (megabytes > 1048576U))
+			{
+				LOG("Invalid cache size:\n%s\n\n", arg);
+				return -1;
+			}
+			options.cacheLimit = ((uint64_t) megabytes) << 20;
+		}
+		else if(_strnicmp(arg, "--debounce=", 11) == 0)
+		{
+			if((sscanf(&arg[11], "%u", &options.debounce) != 1) || (options.debounce > 3600000U))
+			{
+				LOG("Invalid debounce interval:\n%s\n\n", arg);
+				return -1;
+			}
+		}
+		else if(_stricmp(arg, "--watch") == 0)
+		{
+			options.watch = true;
+		}
+		else if(_stricmp(arg, "--strip") == 0)
+		{
+			options.strip = true;
+		}
+		else if(_stricmp(arg, "--migrate") == 0)
+		{
+			options.migrate = true;
+		}
+		else if(_stricmp(arg, "--verify") == 0)
+		{
+			options.verify = true;
+		}
+		else if(_stricmp(arg, "--nfc") == 0)
+		{
+			options.normalize = true;
+		}
+		else if(_stricmp(arg, "--replaygain") == 0)
+		{
+			options.replayGain = true;
+		}
+		else if(_stricmp(arg, "--checksum") == 0)
+		{
+			options.checksum = true;
+		}
+		else if(_stricmp(arg, "--physical-order") == 0)
+		{
+			options.physicalOrder = true;
+		}
+		else
+		{
+			LOG("Unknown option:\n%s\n\n", arg);
+			return -1;
 		}
-
-		free(tmp);
 	}
-	
-	return true;
+
+	return i;
 }
 
-bool TagParser::parseString(const char *key, const char *value, std::vector<TagItem*> &items)
+bool TagParser::parseString(const char *key, const char *value, std::vector<TagItem*> &items, const bool normalize)
 {
 	if(value && value[0])
 	{
+		if(normalize)
+		{
+			//Keys always come from the key table, which is plain ASCII
+			char *normalized = Normalizer::toNFC(value);
+			items.push_back(TagItem::fromString(key, normalized));
+			free(normalized);
+			return true;
+		}
 		items.push_back(TagItem::fromString(key, value));
 		return true;
 	}
@@ -181,3 +414,17 @@ bool TagParser::parseDate(const char *key, const char *value, std::vector<TagIte
 	}
 	return false;
 }
+
+//The file is loaded right away, so that a missing file is reported early and the cache is warm
+bool TagParser::parseBinary(const char *key, const char *value, std::vector<TagItem*> &items)
+{
+	if(value && value[0])
+	{
+		if(BinaryCache::load(value))
+		{
+			items.push_back(TagItem::fromBinary(key, value));
+			return true;
+		}
+	}
+	return false;
+}
@@ -26,16 +26,20 @@
 #include <vector>
 
 class TagItem;
+class TagOptions;
 
 class TagParser
 {
 public:
-	static bool parse(int argc, char* argv[], std::vector<TagItem*> &items);
+	static bool parse(int argc, char* argv[], std::vector<TagItem*> &items, const bool normalize);
+	static bool parseItem(const char *spec, std::vector<TagItem*> &items, const bool normalize);
+	static int parseOptions(int argc, char* argv[], TagOptions &options);
 
 private:
-	static bool parseString(const char *key, const char *value, std::vector<TagItem*> &items);
+	static bool parseString(const char *key, const char *value, std::vector<TagItem*> &items, const bool normalize);
 	static bool parseNumber(const char *key, const char *value, std::vector<TagItem*> &items);
 	static bool parseDate  (const char *key, const char *value, std::vector<TagItem*> &items);
+	static bool parseBinary(const char *key, const char *value, std::vector<TagItem*> &items);
 };
 
 #endif //TAG_PARSER_H_INCLUDED
@@ -0,0 +1,381 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "pipeline.h"
+#include "job.h"
+#include "queue.h"
+#include "parser.h"
+#include "options.h"
+#include "replaygain.h"
+#include "journal.h"
+#include "layout.h"
+#include "trace.h"
+#include "memory_budget.h"
+#include "binary_cache.h"
+#include "unicode_support.h"
+#include "log.h"
+
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+//Const
+static const size_t QUEUE_CAPACITY = 256;
+static const size_t MAX_LINE_LENGTH = 65536;
+static const size_t VERIFY_BATCH_SIZE = 64;
+static const size_t VERIFY_QUEUE_CAPACITY = 16;
+static const unsigned int VERIFY_INTERVAL = 5000; /*milliseconds*/
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+//Manifest lines have the form "<file>[<TAB><key>=<value>]*"
+static bool parse_manifest_line(char *line, const bool normalize, TagJob **job)
+{
+	*job = NULL;
+
+	size_t len = strlen(line);
+	while((len > 0) && ((line[len - 1] == '\r') || (line[len - 1] == '\n')))
+	{
+		line[--len] = '\0';
+	}
+	if((len == 0) || (line[0] == '#'))
+	{
+		return true;
+	}
+
+	char *next = strchr(line, '\t');
+	if(next) *next++ = '\0';
+
+	*job = new TagJob(line);
+	while(next)
+	{
+		char *spec = next;
+		next = strchr(spec, '\t');
+		if(next) *next++ = '\0';
+
+		if(!TagParser::parseItem(spec, (*job)->getItems(), normalize))
+		{
+			LOG("Invalid tag specification in manifest, skipping file:\n%s\n\n", line);
+			delete (*job); *job = NULL;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//All files of a batch are flushed before the first one is read back, so that the tails are read from the storage device
+static void verify_batch(std::vector<TagJob*> &jobs, const std::vector<TagItem*> &items, Journal *const journal, std::atomic<unsigned int> &completed, std::atomic<unsigned int> &failed)
+{
+	LOG_VERBOSE("Verifying %u file(s)...\n\n", (unsigned int) jobs.size());
+
+	std::vector<char> synced(jobs.size(), 0);
+	for(size_t i = 0; i < jobs.size(); i++)
+	{
+		LOG_CHUNK(jobs[i]->getFileName());
+		synced[i] = jobs[i]->sync() ? 1 : 0;
+	}
+
+	for(size_t i = 0; i < jobs.size(); i++)
+	{
+		LOG_CHUNK(jobs[i]->getFileName());
+		if(synced[i] && jobs[i]->verify(items))
+		{
+			if(journal && (!journal->append(jobs[i]->getFileName())))
+			{
+				LOG_SUMMARY("Warning: Failed to record file in the journal:\n%s\n\n", jobs[i]->getFileName());
+			}
+			completed++;
+		}
+		else
+		{
+			failed++;
+		}
+		delete jobs[i];
+	}
+
+	jobs.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Pipeline
+///////////////////////////////////////////////////////////////////////////////
+
+bool Pipeline::run(const char *manifest, const std::vector<TagItem*> &items, const TagOptions &options)
+{
+	FILE *list = fopen_utf8(manifest, "rb");
+	if(!list)
+	{
+		LOG("Failed to open manifest file:\n%s\n\nInvalid file specified or access denied!\n\n", manifest);
+		return false;
+	}
+
+	Journal journal;
+	if(options.journal)
+	{
+		if(!journal.open(options.journal))
+		{
+			fclose(list);
+			return false;
+		}
+		LOG_SUMMARY("Resuming from journal, %u file(s) have been completed before.\n\n", (unsigned int) journal.size());
+	}
+
+	const unsigned int *const threads = options.stageThreads;
+	const unsigned int formats = options.formats;
+
+	//Queues between the stages, a full queue blocks the upstream stage
+	BoundedQueue<TagJob*> statQueue     (QUEUE_CAPACITY, 1);
+	BoundedQueue<TagJob*> readQueue     (QUEUE_CAPACITY, threads[STAGE_STAT]);
+	BoundedQueue<TagJob*> serializeQueue(QUEUE_CAPACITY, threads[STAGE_READ]);
+	BoundedQueue<TagJob*> writeQueue    (QUEUE_CAPACITY, threads[STAGE_SERIALIZE]);
+
+	//Written files are verified in batches, which are handed to a verify stage with as many threads as the read stage
+	BoundedQueue<std::vector<TagJob*>*> verifyQueue(VERIFY_QUEUE_CAPACITY, threads[STAGE_WRITE]);
+
+	std::atomic<unsigned int> completed(0), failed(0), skipped(0);
+	std::vector<std::thread> workers;
+
+	const uint64_t memoryLimit = options.memoryLimit;
+	MemoryBudget::setLimit(memoryLimit);
+
+	for(unsigned int i = 0; i < threads[STAGE_STAT]; i++)
+	{
+		workers.push_back(std::thread([&]()
+		{
+			Trace::setThreadName("stat");
+			TagJob *job;
+			while(statQueue.pop(job))
+			{
+				LOG_CHUNK(job->getFileName());
+				if(job->stat())
+				{
+					readQueue.push(job);
+				}
+				else
+				{
+					failed++;
+					delete job;
+				}
+			}
+			readQueue.close();
+		}));
+	}
+
+	const unsigned int cpus = std::thread::hardware_concurrency();
+	const unsigned int checksumThreads = (cpus > 0) ? cpus : 1;
+
+	for(unsigned int i = 0; i < threads[STAGE_READ]; i++)
+	{
+		workers.push_back(std::thread([&]()
+		{
+			Trace::setThreadName("read");
+			TagJob *job;
+			while(readQueue.pop(job))
+			{
+				LOG_CHUNK(job->getFileName());
+				if(job->readTail() && ((!options.checksum) || job->checksum(checksumThreads)))
+				{
+					serializeQueue.push(job);
+				}
+				else
+				{
+					failed++;
+					delete job;
+				}
+			}
+			serializeQueue.close();
+		}));
+	}
+
+	for(unsigned int i = 0; i < threads[STAGE_SERIALIZE]; i++)
+	{
+		workers.push_back(std::thread([&]()
+		{
+			Trace::setThreadName("serialize");
+			TagJob *job;
+			while(serializeQueue.pop(job))
+			{
+				LOG_CHUNK(job->getFileName());
+				if(options.strip || options.migrate || job->serialize(formats, items))
+				{
+					writeQueue.push(job);
+				}
+				else
+				{
+					failed++;
+					delete job;
+				}
+			}
+			writeQueue.close();
+		}));
+	}
+
+	for(unsigned int i = 0; i < threads[STAGE_WRITE]; i++)
+	{
+		workers.push_back(std::thread([&]()
+		{
+			Trace::setThreadName("write");
+			std::vector<TagJob*> *batch = new std::vector<TagJob*>();
+			std::chrono::steady_clock::time_point batchStart = std::chrono::steady_clock::now();
+			uint64_t batchBytes = 0;
+			TagJob *job;
+			while(writeQueue.pop(job))
+			{
+				LOG_CHUNK(job->getFileName());
+				if(options.strip ? job->strip() : (options.migrate ? job->migrate() : job->write(formats, options.sink, items)))
+				{
+					if(options.verify)
+					{
+						//Batches are bounded in size and age, so that progress is journaled as the run goes on
+						batch->push_back(job); /*journaled once it has been verified*/
+						batchBytes += job->getBufferSize();
+						if((batch->size() >= VERIFY_BATCH_SIZE) || (std::chrono::steady_clock::now() - batchStart >= std::chrono::milliseconds(VERIFY_INTERVAL)) || (memoryLimit && (batchBytes >= (memoryLimit / (2 * threads[STAGE_WRITE])))))
+						{
+							verifyQueue.push(batch);
+							batch = new std::vector<TagJob*>();
+							batchStart = std::chrono::steady_clock::now();
+							batchBytes = 0;
+						}
+						continue;
+					}
+					if(options.journal && (!journal.append(job->getFileName())))
+					{
+						LOG_SUMMARY("Warning: Failed to record file in the journal:\n%s\n\n", job->getFileName());
+					}
+					completed++;
+				}
+				else
+				{
+					failed++;
+				}
+				delete job;
+			}
+			if(!batch->empty())
+			{
+				verifyQueue.push(batch);
+			}
+			else
+			{
+				delete batch;
+			}
+			verifyQueue.close();
+		}));
+	}
+
+	//Verified files release their buffers, so that retained buffers cannot starve the serialize stage
+	for(unsigned int i = 0; options.verify && (i < threads[STAGE_READ]); i++)
+	{
+		workers.push_back(std::thread([&]()
+		{
+			Trace::setThreadName("verify");
+			std::vector<TagJob*> *batch;
+			while(verifyQueue.pop(batch))
+			{
+				verify_batch(*batch, items, options.journal ? &journal : NULL, completed, failed);
+				delete batch;
+			}
+		}));
+	}
+
+	//Discovery runs on the calling thread
+	Trace::setThreadName("discovery");
+	std::vector<TagJob*> pending;
+	std::vector<char> line(MAX_LINE_LENGTH);
+	bool firstLine = true;
+	while(fgets(line.data(), MAX_LINE_LENGTH, list))
+	{
+		char *start = line.data();
+		if(firstLine && (memcmp(start, "\xEF\xBB\xBF", 3) == 0))
+		{
+			start += 3; /*skip the UTF-8 BOM*/
+		}
+		firstLine = false;
+
+		TagJob *job = NULL;
+		if(!parse_manifest_line(start, options.normalize, &job))
+		{
+			failed++;
+		}
+		else if(job)
+		{
+			//Files of other shards and files completed by a previous run are skipped
+			if(((Journal::hashPath(job->getFileName()) % options.shardCount) != options.shardIndex) || journal.contains(job->getFileName()))
+			{
+				skipped++;
+				delete job;
+				continue;
+			}
+			if(options.replayGain || options.physicalOrder)
+			{
+				pending.push_back(job); /*album gain and ordering need all files first*/
+				continue;
+			}
+			statQueue.push(job);
+		}
+	}
+	fclose(list);
+
+	if(options.replayGain || options.physicalOrder)
+	{
+		if(options.physicalOrder)
+		{
+			PhysicalLayout::sortJobs(pending, threads[STAGE_STAT]);
+		}
+		if(options.replayGain)
+		{
+			ReplayGain::analyzeJobs(pending, items, checksumThreads);
+		}
+		for(std::vector<TagJob*>::iterator iter = pending.begin(); iter != pending.end(); iter++)
+		{
+			statQueue.push(*iter);
+		}
+	}
+	statQueue.close();
+
+	for(std::vector<std::thread>::iterator iter = workers.begin(); iter != workers.end(); iter++)
+	{
+		iter->join();
+	}
+
+	if(memoryLimit)
+	{
+		LOG_SUMMARY("Peak memory of tag buffers: %.1f of %.1f MiB, %u tag(s) have been streamed.\n", MemoryBudget::getPeak() / 1048576.0, memoryLimit / 1048576.0, MemoryBudget::getRefused());
+	}
+	else
+	{
+		LOG_SUMMARY("Peak memory of tag buffers: %.1f MiB.\n", MemoryBudget::getPeak() / 1048576.0);
+	}
+
+	if(BinaryCache::getReads() > 0)
+	{
+		LOG_SUMMARY("Binary items: %u file(s) read, %u read(s) served from the cache.\n", BinaryCache::getReads(), BinaryCache::getHits());
+	}
+
+	LOG_SUMMARY("Batch completed: %u file(s) tagged, %u file(s) failed, %u file(s) skipped.\n\n", completed.load(), failed.load(), skipped.load());
+	return (failed.load() == 0);
+}
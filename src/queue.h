@@ -0,0 +1,183 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TAG_QUEUE_H_INCLUDED
+#define TAG_QUEUE_H_INCLUDED
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <stdexcept>
+
+///////////////////////////////////////////////////////////////////////////////
+// Bounded lock-free MPMC queue
+///////////////////////////////////////////////////////////////////////////////
+
+// Fixed capacity ring buffer with per-cell sequence numbers, safe for any
+// number of producers and consumers. push() blocks while the queue is full,
+// which provides backpressure to the upstream stage. pop() blocks until an
+// element is available, or returns false once the queue has been closed by
+// all of its producers and is drained.
+template<typename T>
+class BoundedQueue
+{
+public:
+	BoundedQueue(const size_t capacity, const unsigned int producers)
+	:
+		m_mask(roundUp(capacity) - 1), m_cells(new cell_t[roundUp(capacity)]), m_producers(producers), m_enqueuePos(0), m_dequeuePos(0)
+	{
+		for(size_t i = 0; i <= m_mask; i++)
+		{
+			m_cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	~BoundedQueue(void)
+	{
+		delete [] m_cells;
+	}
+
+	void push(const T &value)
+	{
+		unsigned int spin = 0;
+		while(!tryPush(value))
+		{
+			backoff(spin);
+		}
+	}
+
+	bool pop(T &value)
+	{
+		unsigned int spin = 0;
+		for(;;)
+		{
+			if(tryPop(value))
+			{
+				return true;
+			}
+			if(m_producers.load(std::memory_order_acquire) == 0)
+			{
+				return tryPop(value); /*re-check after the last producer went away*/
+			}
+			backoff(spin);
+		}
+	}
+
+	//Called once by every producer when it has no more elements
+	void close(void)
+	{
+		m_producers.fetch_sub(1, std::memory_order_release);
+	}
+
+private:
+	typedef struct
+	{
+		std::atomic<size_t> sequence;
+		T value;
+	}
+	cell_t;
+
+	bool tryPush(const T &value)
+	{
+		size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+		for(;;)
+		{
+			cell_t &cell = m_cells[pos & m_mask];
+			const size_t seq = cell.sequence.load(std::memory_order_acquire);
+			const intptr_t diff = ((intptr_t) seq) - ((intptr_t) pos);
+			if(diff == 0)
+			{
+				if(m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					cell.value = value;
+					cell.sequence.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if(diff < 0)
+			{
+				return false; /*full*/
+			}
+			else
+			{
+				pos = m_enqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	bool tryPop(T &value)
+	{
+		size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+		for(;;)
+		{
+			cell_t &cell = m_cells[pos & m_mask];
+			const size_t seq = cell.sequence.load(std::memory_order_acquire);
+			const intptr_t diff = ((intptr_t) seq) - ((intptr_t)(pos + 1));
+			if(diff == 0)
+			{
+				if(m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					value = cell.value;
+					cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if(diff < 0)
+			{
+				return false; /*empty*/
+			}
+			else
+			{
+				pos = m_dequeuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	static void backoff(unsigned int &spin)
+	{
+		if(++spin < 64)
+		{
+			std::this_thread::yield();
+		}
+		else
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+
+	static size_t roundUp(const size_t capacity)
+	{
+		size_t size = 2;
+		while(size < capacity) size <<= 1;
+		return size;
+	}
+
+	const size_t m_mask;
+	cell_t *const m_cells;
+	std::atomic<unsigned int> m_producers;
+	std::atomic<size_t> m_enqueuePos;
+	std::atomic<size_t> m_dequeuePos;
+
+	BoundedQueue &operator=(const BoundedQueue &rhs) { throw std::runtime_error("Unimplemented!"); }
+};
+
+#endif //TAG_QUEUE_H_INCLUDED
@@ -0,0 +1,513 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "replaygain.h"
+#include "job.h"
+#include "types.h"
+#include "unicode_support.h"
+#include "trace.h"
+#include "log.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <stdexcept>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <stdint.h>
+#include <emmintrin.h>
+
+//Const
+static const double       RG_PINK_REF       = 64.82;
+static const double       RG_PERCENTILE     = 0.95;
+static const double       RG_WINDOW         = 0.050;
+static const unsigned int RG_STEPS_PER_DB   = 100;
+static const unsigned int RG_MAX_DB         = 120;
+static const size_t       RG_HISTOGRAM_SIZE = RG_STEPS_PER_DB * RG_MAX_DB;
+static const size_t       RG_ORDER          = 10;
+static const size_t       RG_BLOCK_FRAMES   = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+// Equal loudness filter
+///////////////////////////////////////////////////////////////////////////////
+
+//Yule-Walker coefficients of the ReplayGain equal loudness filter
+static const struct
+{
+	unsigned int sampleRate;
+	double b[RG_ORDER + 1];
+	double a[RG_ORDER + 1];
+}
+g_yuleCoeffs[] =
+{
+	{
+		44100,
+		{ 0.05418656406430, -0.02911007808948, -0.00848709379851, -0.00851165645469, -0.00834990904936, 0.02245293253339, -0.02596338512915, 0.01624864962975, -0.00240879051584, 0.00674613682247, -0.00187763777362 },
+		{ 1.00000000000000, -3.47845948550071,  6.36317777566148, -8.54751527471874,  9.47693607801280, -8.81498681370155,  6.85401540936998, -4.39470996079559,  2.19611684890774, -0.75104302451432,  0.13149317958808 }
+	},
+	{
+		48000,
+		{ 0.03857599435200, -0.02160367184185, -0.00123395316851, -0.00009291677959, -0.01655260341619, 0.02161526843274, -0.02074045215285, 0.00594298065125, 0.00306428023191, 0.00012025322027, 0.00288463683916 },
+		{ 1.00000000000000, -3.84664617118067,  7.81501653005538, -11.34170355132042, 13.05504219327545, -12.28759895145294, 9.48293806319790, -5.87257861775999, 2.75465861874613, -0.86984376593551, 0.13919314567432 }
+	},
+	{ 0 }
+};
+
+//2nd order Butterworth high-pass at 150 Hz (bilinear transform)
+static void butterworth_coeffs(const unsigned int sampleRate, double *b, double *a)
+{
+	static const double PI = 3.14159265358979323846;
+	const double k = tan(PI * 150.0 / sampleRate);
+	const double q = sqrt(2.0);
+	const double norm = 1.0 / (1.0 + (k * q) + (k * k));
+
+	b[0] = norm; b[1] = -2.0 * norm; b[2] = norm;
+	a[0] = 1.0;  a[1] = 2.0 * ((k * k) - 1.0) * norm; a[2] = (1.0 - (k * q) + (k * k)) * norm;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// WAV input
+///////////////////////////////////////////////////////////////////////////////
+
+typedef struct
+{
+	unsigned int formatTag;
+	unsigned int channels;
+	unsigned int sampleRate;
+	unsigned int bitsPerSample;
+	unsigned int blockAlign;
+	uint64_t dataSize;
+}
+wav_format_t;
+
+inline static unsigned int read_uint16_le(const unsigned char *src)
+{
+	return ((unsigned int)src[0]) | (((unsigned int)src[1]) << 8);
+}
+
+inline static unsigned int read_uint32_le(const unsigned char *src)
+{
+	return ((unsigned int)src[0]) | (((unsigned int)src[1]) << 8) | (((unsigned int)src[2]) << 16) | (((unsigned int)src[3]) << 24);
+}
+
+//Parses the RIFF header, on success the file is positioned at the start of the sample data
+static bool read_wav_format(FILE *file, wav_format_t &format)
+{
+	unsigned char buffer[40];
+	bool haveFormat = false;
+
+	if((fread(buffer, sizeof(unsigned char), 12, file) != 12) || (memcmp(&buffer[0], "RIFF", 4) != 0) || (memcmp(&buffer[8], "WAVE", 4) != 0))
+	{
+		return false;
+	}
+
+	while(fread(buffer, sizeof(unsigned char), 8, file) == 8)
+	{
+		const unsigned int chunkSize = read_uint32_le(&buffer[4]);
+
+		if(memcmp(&buffer[0], "data", 4) == 0)
+		{
+			format.dataSize = chunkSize;
+			return haveFormat;
+		}
+
+		if((memcmp(&buffer[0], "fmt ", 4) == 0) && (chunkSize >= 16))
+		{
+			const size_t len = (chunkSize < sizeof(buffer)) ? chunkSize : sizeof(buffer);
+			if(fread(buffer, sizeof(unsigned char), len, file) != len)
+			{
+				return false;
+			}
+
+			format.formatTag     = read_uint16_le(&buffer[0]);
+			format.channels      = read_uint16_le(&buffer[2]);
+			format.sampleRate    = read_uint32_le(&buffer[4]);
+			format.blockAlign    = read_uint16_le(&buffer[12]);
+			format.bitsPerSample = read_uint16_le(&buffer[14]);
+
+			//WAVE_FORMAT_EXTENSIBLE carries the actual format in the sub-format GUID
+			if((format.formatTag == 0xFFFE) && (len >= 26))
+			{
+				format.formatTag = read_uint16_le(&buffer[24]);
+			}
+
+			haveFormat = true;
+			if(_fseeki64(file, (chunkSize - len) + (chunkSize & 1), SEEK_CUR) != 0)
+			{
+				return false;
+			}
+			continue;
+		}
+
+		if(_fseeki64(file, ((uint64_t) chunkSize) + (chunkSize & 1), SEEK_CUR) != 0)
+		{
+			return false;
+		}
+	}
+
+	return false;
+}
+
+//Converts one block of samples to interleaved stereo, scaled to the 16-Bit range
+static void convert_samples(const unsigned char *src, const size_t frames, const wav_format_t &format, double *dest)
+{
+	const size_t step = format.blockAlign;
+	const size_t bytes = format.bitsPerSample / 8;
+	const size_t right = (format.channels > 1) ? bytes : 0;
+
+	switch((format.formatTag == 3) ? 0 : format.bitsPerSample)
+	{
+	case 0:
+		for(size_t i = 0; i < frames; i++, src += step)
+		{
+			float l, r;
+			memcpy(&l, &src[0], sizeof(float)); memcpy(&r, &src[right], sizeof(float));
+			dest[2*i] = l * 32768.0; dest[2*i+1] = r * 32768.0;
+		}
+		break;
+	case 8:
+		for(size_t i = 0; i < frames; i++, src += step)
+		{
+			dest[2*i] = (((int)src[0]) - 128) * 256.0; dest[2*i+1] = (((int)src[right]) - 128) * 256.0;
+		}
+		break;
+	case 16:
+		for(size_t i = 0; i < frames; i++, src += step)
+		{
+			dest[2*i] = (int16_t) read_uint16_le(&src[0]); dest[2*i+1] = (int16_t) read_uint16_le(&src[right]);
+		}
+		break;
+	case 24:
+		for(size_t i = 0; i < frames; i++, src += step)
+		{
+			dest[2*i]   = ((int32_t)((read_uint16_le(&src[0]) << 8) | (((unsigned int)src[2]) << 24))) / 65536.0;
+			dest[2*i+1] = ((int32_t)((read_uint16_le(&src[right]) << 8) | (((unsigned int)src[right+2]) << 24))) / 65536.0;
+		}
+		break;
+	case 32:
+		for(size_t i = 0; i < frames; i++, src += step)
+		{
+			dest[2*i] = ((int32_t) read_uint32_le(&src[0])) / 65536.0; dest[2*i+1] = ((int32_t) read_uint32_le(&src[right])) / 65536.0;
+		}
+		break;
+	default:
+		throw std::runtime_error("Unsupported sample format!");
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+//Album names are interned, so the ID identifies the album (zero means none)
+static uint32_t album_id(TagJob *job, const std::vector<TagItem*> &common)
+{
+	const uint32_t albumKey = StringPool::intern("Album");
+	for(std::vector<TagItem*>::const_iterator iter = job->getItems().cbegin(); iter != job->getItems().cend(); iter++)
+	{
+		if((*iter)->getTagKeyId() == albumKey) return (*iter)->getTagData()->toStringId();
+	}
+	for(std::vector<TagItem*>::const_iterator iter = common.cbegin(); iter != common.cend(); iter++)
+	{
+		if((*iter)->getTagKeyId() == albumKey) return (*iter)->getTagData()->toStringId();
+	}
+	return 0;
+}
+
+static void set_item(TagJob *job, const char *key, const char *value)
+{
+	const uint32_t keyId = StringPool::intern(key);
+	std::vector<TagItem*> &items = job->getItems();
+	for(std::vector<TagItem*>::iterator iter = items.begin(); iter != items.end();)
+	{
+		if((*iter)->getTagKeyId() == keyId)
+		{
+			delete (*iter);
+			iter = items.erase(iter);
+			continue;
+		}
+		iter++;
+	}
+	items.push_back(TagItem::fromString(key, value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// ReplayGain
+///////////////////////////////////////////////////////////////////////////////
+
+void ReplayGain::analyzeJobs(const std::vector<TagJob*> &jobs, const std::vector<TagItem*> &common, const unsigned int threads)
+{
+	typedef struct
+	{
+		bool valid;
+		double gain;
+		double peak;
+		uint32_t album;
+	}
+	track_t;
+
+	typedef struct
+	{
+		std::vector<unsigned int> histogram;
+		double peak;
+	}
+	album_t;
+
+	std::vector<track_t> tracks(jobs.size());
+	std::map<uint32_t, album_t> albums;
+	std::mutex mutex;
+	std::atomic<size_t> next(0);
+	std::vector<std::thread> workers;
+
+	LOG_SUMMARY("Running ReplayGain analysis on %u file(s)...\n\n", (unsigned int) jobs.size());
+
+	//Analyze all tracks in parallel, the album histograms are accumulated on the fly
+	for(unsigned int t = 0; t < threads; t++)
+	{
+		workers.push_back(std::thread([&]()
+		{
+			Trace::setThreadName("replaygain");
+			std::vector<unsigned int> histogram;
+			for(size_t i = next++; i < jobs.size(); i = next++)
+			{
+				track_t &track = tracks[i];
+				track.valid = analyzeFile(jobs[i]->getFileName(), histogram, track.peak) && computeGain(histogram, track.gain);
+				if(!track.valid)
+				{
+					LOG_SUMMARY("Warning: ReplayGain analysis skipped, not a supported PCM WAV file:\n%s\n\n", jobs[i]->getFileName());
+					continue;
+				}
+
+				track.album = album_id(jobs[i], common);
+				if(track.album == 0)
+				{
+					continue; /*tracks without an album do not share an album gain*/
+				}
+
+				std::lock_guard<std::mutex> lock(mutex);
+				album_t &album = albums[track.album];
+				if(album.histogram.empty())
+				{
+					album.histogram.assign(RG_HISTOGRAM_SIZE, 0);
+					album.peak = 0.0;
+				}
+				for(size_t j = 0; j < RG_HISTOGRAM_SIZE; j++)
+				{
+					album.histogram[j] += histogram[j];
+				}
+				album.peak = (track.peak > album.peak) ? track.peak : album.peak;
+			}
+		}));
+	}
+
+	for(std::vector<std::thread>::iterator iter = workers.begin(); iter != workers.end(); iter++)
+	{
+		iter->join();
+	}
+
+	//Store the results as items of the jobs
+	char buffer[32];
+	for(size_t i = 0; i < jobs.size(); i++)
+	{
+		if(!tracks[i].valid)
+		{
+			continue;
+		}
+
+		sprintf(buffer, "%+.2f dB", tracks[i].gain); set_item(jobs[i], "REPLAYGAIN_TRACK_GAIN", buffer);
+		sprintf(buffer, "%.6f",     tracks[i].peak); set_item(jobs[i], "REPLAYGAIN_TRACK_PEAK", buffer);
+
+		if(tracks[i].album == 0)
+		{
+			continue;
+		}
+
+		const album_t &album = albums[tracks[i].album];
+		double albumGain = 0.0;
+		computeGain(album.histogram, albumGain);
+
+		sprintf(buffer, "%+.2f dB", albumGain);      set_item(jobs[i], "REPLAYGAIN_ALBUM_GAIN", buffer);
+		sprintf(buffer, "%.6f",     album.peak);     set_item(jobs[i], "REPLAYGAIN_ALBUM_PEAK", buffer);
+	}
+}
+
+bool ReplayGain::analyzeFile(const char *fileName, std::vector<unsigned int> &histogram, double &peak)
+{
+	TRACE_SPAN("replaygain", fileName);
+
+	FILE *file = fopen_utf8(fileName, "rbS");
+	if(!file)
+	{
+		return false;
+	}
+
+	wav_format_t format;
+	if(!read_wav_format(file, format))
+	{
+		fclose(file);
+		return false;
+	}
+
+	const bool isFloat = (format.formatTag == 3) && (format.bitsPerSample == 32);
+	const bool isPcm = (format.formatTag == 1) && ((format.bitsPerSample == 8) || (format.bitsPerSample == 16) || (format.bitsPerSample == 24) || (format.bitsPerSample == 32));
+	if((!(isFloat || isPcm)) || (format.channels < 1) || (format.blockAlign < format.channels * (format.bitsPerSample / 8)))
+	{
+		fclose(file);
+		return false;
+	}
+
+	size_t yule = 0;
+	while(g_yuleCoeffs[yule].sampleRate && (g_yuleCoeffs[yule].sampleRate != format.sampleRate))
+	{
+		yule++;
+	}
+	if(!g_yuleCoeffs[yule].sampleRate)
+	{
+		fclose(file);
+		return false;
+	}
+
+	//Both channels are filtered at once, one per SSE2 lane
+	__m128d yb[RG_ORDER + 1], ya[RG_ORDER + 1], bb[3], ba[3];
+	double butterB[3], butterA[3];
+	butterworth_coeffs(format.sampleRate, butterB, butterA);
+	for(size_t k = 0; k <= RG_ORDER; k++)
+	{
+		yb[k] = _mm_set1_pd(g_yuleCoeffs[yule].b[k]);
+		ya[k] = _mm_set1_pd(g_yuleCoeffs[yule].a[k]);
+	}
+	for(size_t k = 0; k < 3; k++)
+	{
+		bb[k] = _mm_set1_pd(butterB[k]);
+		ba[k] = _mm_set1_pd(butterA[k]);
+	}
+
+	//Sample buffers are prefixed with the filter history
+	const size_t bufferSize = (RG_ORDER + RG_BLOCK_FRAMES) * 2;
+	std::vector<unsigned char> raw(RG_BLOCK_FRAMES * format.blockAlign);
+	std::vector<double> input(bufferSize, 0.0), stage(bufferSize, 0.0), output(bufferSize, 0.0);
+
+	const size_t window = (size_t) ceil(format.sampleRate * RG_WINDOW);
+	const __m128d signMask = _mm_set1_pd(-0.0);
+	__m128d sum = _mm_setzero_pd(), maxAbs = _mm_setzero_pd();
+	size_t count = 0;
+
+	histogram.assign(RG_HISTOGRAM_SIZE, 0);
+
+	//Flush denormals to zero, the IIR filters decay into the denormal range on silence
+	const unsigned int csr = _mm_getcsr();
+	_mm_setcsr(csr | 0x8040);
+
+	uint64_t remaining = format.dataSize / format.blockAlign;
+	bool success = true;
+
+	while(remaining > 0)
+	{
+		const size_t frames = (remaining > RG_BLOCK_FRAMES) ? RG_BLOCK_FRAMES : ((size_t) remaining);
+		if(fread(raw.data(), format.blockAlign, frames, file) != frames)
+		{
+			success = false;
+			break;
+		}
+
+		convert_samples(raw.data(), frames, format, &input[RG_ORDER * 2]);
+
+		for(size_t i = 0; i < frames; i++)
+		{
+			const size_t p = (RG_ORDER + i) * 2;
+			const __m128d x = _mm_loadu_pd(&input[p]);
+			maxAbs = _mm_max_pd(maxAbs, _mm_andnot_pd(signMask, x));
+
+			__m128d y = _mm_mul_pd(x, yb[0]);
+			for(size_t k = 1; k <= RG_ORDER; k++)
+			{
+				y = _mm_add_pd(y, _mm_mul_pd(_mm_loadu_pd(&input[p - (2 * k)]), yb[k]));
+				y = _mm_sub_pd(y, _mm_mul_pd(_mm_loadu_pd(&stage[p - (2 * k)]), ya[k]));
+			}
+			_mm_storeu_pd(&stage[p], y);
+
+			__m128d z = _mm_mul_pd(y, bb[0]);
+			z = _mm_add_pd(z, _mm_mul_pd(_mm_loadu_pd(&stage [p - 2]), bb[1]));
+			z = _mm_add_pd(z, _mm_mul_pd(_mm_loadu_pd(&stage [p - 4]), bb[2]));
+			z = _mm_sub_pd(z, _mm_mul_pd(_mm_loadu_pd(&output[p - 2]), ba[1]));
+			z = _mm_sub_pd(z, _mm_mul_pd(_mm_loadu_pd(&output[p - 4]), ba[2]));
+			_mm_storeu_pd(&output[p], z);
+
+			sum = _mm_add_pd(sum, _mm_mul_pd(z, z));
+			if(++count >= window)
+			{
+				double lr[2];
+				_mm_storeu_pd(lr, sum);
+				const double level = RG_STEPS_PER_DB * 10.0 * log10(((lr[0] + lr[1]) / count * 0.5) + 1.0e-37);
+				const size_t index = (level <= 0.0) ? 0 : ((size_t) level);
+				histogram[(index < RG_HISTOGRAM_SIZE) ? index : (RG_HISTOGRAM_SIZE - 1)]++;
+				sum = _mm_setzero_pd();
+				count = 0;
+			}
+		}
+
+		//Keep the last samples as history for the next block
+		memmove(&input [0], &input [frames * 2], RG_ORDER * 2 * sizeof(double));
+		memmove(&stage [0], &stage [frames * 2], RG_ORDER * 2 * sizeof(double));
+		memmove(&output[0], &output[frames * 2], RG_ORDER * 2 * sizeof(double));
+		remaining -= frames;
+	}
+
+	_mm_setcsr(csr);
+	fclose(file);
+
+	double peaks[2];
+	_mm_storeu_pd(peaks, maxAbs);
+	peak = ((peaks[0] > peaks[1]) ? peaks[0] : peaks[1]) / 32768.0;
+
+	return success;
+}
+
+bool ReplayGain::computeGain(const std::vector<unsigned int> &histogram, double &gain)
+{
+	uint64_t elements = 0;
+	for(size_t i = 0; i < histogram.size(); i++)
+	{
+		elements += histogram[i];
+	}
+	if(elements == 0)
+	{
+		return false;
+	}
+
+	//Loudness is the level that is exceeded by 5% of the windows
+	int64_t upper = (int64_t) ceil(elements * (1.0 - RG_PERCENTILE));
+	size_t i = histogram.size();
+	while(i-- > 0)
+	{
+		if((upper -= histogram[i]) <= 0)
+		{
+			break;
+		}
+	}
+
+	gain = RG_PINK_REF - (((double) i) / RG_STEPS_PER_DB);
+	return true;
+}
@@ -0,0 +1,301 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "sink.h"
+#include "unicode_support.h"
+#include "log.h"
+
+//CRT includes
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+//Windows includes
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+static HANDLE open_handle(const char *fileName, const DWORD access)
+{
+	wchar_t *path = utf8_to_utf16(fileName);
+	if(!path)
+	{
+		return INVALID_HANDLE_VALUE;
+	}
+
+	HANDLE handle = CreateFileW(path, access, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	free(path);
+	return handle;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Output Sink
+///////////////////////////////////////////////////////////////////////////////
+
+OutputSink *OutputSink::create(const SinkType type, const char *fileName, const uint64_t offset, const uint64_t length)
+{
+	OutputSink *sink = NULL;
+
+	switch(type)
+	{
+	case SINK_STDIO:
+		sink = new StdioSink();
+		break;
+	case SINK_PWRITE:
+		sink = new PwriteSink();
+		break;
+	case SINK_MMAP:
+		sink = new MmapSink();
+		break;
+	case SINK_MEMORY:
+		sink = new MemorySink();
+		break;
+	default:
+		throw std::runtime_error("Bad sink type!");
+	}
+
+	if(!sink->open(fileName, offset, length))
+	{
+		delete sink;
+		return NULL;
+	}
+
+	return sink;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Stdio Sink
+///////////////////////////////////////////////////////////////////////////////
+
+StdioSink::StdioSink(FILE *stream)
+:
+	m_stream(stream), m_owned(false)
+{
+}
+
+StdioSink::~StdioSink(void)
+{
+	if(m_owned && m_stream)
+	{
+		fclose(m_stream);
+	}
+}
+
+bool StdioSink::open(const char *fileName, const uint64_t offset, const uint64_t length)
+{
+	m_stream = fopen_utf8(fileName, "r+b");
+	if(!m_stream)
+	{
+		return false;
+	}
+
+	m_owned = true;
+	return (_fseeki64(m_stream, offset, SEEK_SET) == 0);
+}
+
+bool StdioSink::write(const void *data, const size_t length)
+{
+	return (fwrite(data, sizeof(unsigned char), length, m_stream) == length);
+}
+
+bool StdioSink::close(void)
+{
+	bool success = true;
+	if(m_stream)
+	{
+		success = m_owned ? (fclose(m_stream) == 0) : (fflush(m_stream) == 0);
+		m_stream = NULL;
+	}
+	return success;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Pwrite Sink
+///////////////////////////////////////////////////////////////////////////////
+
+PwriteSink::PwriteSink(void)
+:
+	m_handle(INVALID_HANDLE_VALUE), m_position(0)
+{
+}
+
+PwriteSink::~PwriteSink(void)
+{
+	close();
+}
+
+bool PwriteSink::open(const char *fileName, const uint64_t offset, const uint64_t length)
+{
+	m_handle = open_handle(fileName, GENERIC_WRITE);
+	m_position = offset;
+	return (m_handle != INVALID_HANDLE_VALUE);
+}
+
+bool PwriteSink::write(const void *data, const size_t length)
+{
+	const unsigned char *pos = (const unsigned char*) data;
+	size_t remaining = length;
+
+	while(remaining > 0)
+	{
+		OVERLAPPED overlapped;
+		memset(&overlapped, 0, sizeof(OVERLAPPED));
+		overlapped.Offset     = (DWORD)(m_position & 0xFFFFFFFF);
+		overlapped.OffsetHigh = (DWORD)(m_position >> 32);
+
+		DWORD written = 0;
+		const DWORD chunk = (remaining > 0x40000000) ? 0x40000000 : ((DWORD) remaining);
+		if((!WriteFile(m_handle, pos, chunk, &written, &overlapped)) || (written == 0))
+		{
+			return false;
+		}
+
+		pos += written;
+		remaining -= written;
+		m_position += written;
+	}
+
+	return true;
+}
+
+bool PwriteSink::close(void)
+{
+	bool success = true;
+	if(m_handle != INVALID_HANDLE_VALUE)
+	{
+		success = (CloseHandle(m_handle) != FALSE);
+		m_handle = INVALID_HANDLE_VALUE;
+	}
+	return success;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Mmap Sink
+///////////////////////////////////////////////////////////////////////////////
+
+MmapSink::MmapSink(void)
+:
+	m_handle(INVALID_HANDLE_VALUE), m_mapping(NULL), m_view(NULL), m_data(NULL), m_length(0), m_position(0)
+{
+}
+
+MmapSink::~MmapSink(void)
+{
+	close();
+}
+
+bool MmapSink::open(const char *fileName, const uint64_t offset, const uint64_t length)
+{
+	if((length == 0) || (length > SIZE_MAX))
+	{
+		return (length == 0); /*nothing to map*/
+	}
+
+	m_handle = open_handle(fileName, GENERIC_READ | GENERIC_WRITE);
+	if(m_handle == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	//Mapping with the final size extends the file, the view must start at a multiple of the allocation granularity
+	const uint64_t fileSize = offset + length;
+	m_mapping = CreateFileMappingW(m_handle, NULL, PAGE_READWRITE, (DWORD)(fileSize >> 32), (DWORD)(fileSize & 0xFFFFFFFF), NULL);
+	if(!m_mapping)
+	{
+		return false;
+	}
+
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	const uint64_t viewOffset = offset - (offset % info.dwAllocationGranularity);
+
+	m_view = (unsigned char*) MapViewOfFile(m_mapping, FILE_MAP_WRITE, (DWORD)(viewOffset >> 32), (DWORD)(viewOffset & 0xFFFFFFFF), (SIZE_T)(fileSize - viewOffset));
+	if(!m_view)
+	{
+		return false;
+	}
+
+	m_data = m_view + (offset - viewOffset);
+	m_length = (size_t) length;
+	return true;
+}
+
+bool MmapSink::write(const void *data, const size_t length)
+{
+	if((!m_data) || (length > (m_length - m_position)))
+	{
+		return false;
+	}
+
+	memcpy(m_data + m_position, data, length);
+	m_position += length;
+	return true;
+}
+
+//The view is flushed, so that write errors are reported here rather than lost on unmap
+bool MmapSink::close(void)
+{
+	bool success = (m_position == m_length);
+	if(m_view)
+	{
+		success = (FlushViewOfFile(m_view, 0) != FALSE) && success;
+		success = (UnmapViewOfFile(m_view) != FALSE) && success;
+		m_view = m_data = NULL;
+	}
+	if(m_mapping)
+	{
+		CloseHandle(m_mapping);
+		m_mapping = NULL;
+	}
+	if(m_handle != INVALID_HANDLE_VALUE)
+	{
+		success = (CloseHandle(m_handle) != FALSE) && success;
+		m_handle = INVALID_HANDLE_VALUE;
+	}
+	return success;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Memory Sink
+///////////////////////////////////////////////////////////////////////////////
+
+bool MemorySink::open(const char *fileName, const uint64_t offset, const uint64_t length)
+{
+	m_data.clear();
+	m_data.reserve((size_t) length);
+	return true;
+}
+
+bool MemorySink::write(const void *data, const size_t length)
+{
+	m_data.insert(m_data.end(), (const unsigned char*) data, ((const unsigned char*) data) + length);
+	return true;
+}
+
+bool MemorySink::close(void)
+{
+	return true;
+}
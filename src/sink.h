@@ -0,0 +1,130 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TAG_SINK_H_INCLUDED
+#define TAG_SINK_H_INCLUDED
+
+#include "options.h"
+
+#include <cstdio>
+#include <vector>
+#include <stdexcept>
+#include <stdint.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Output Sink
+///////////////////////////////////////////////////////////////////////////////
+
+// Destination for tag data. A sink is opened at a fixed file offset and the
+// data is written sequentially from there. The total length must be known in
+// advance, because the memory-mapped sink has to size its view up front.
+class OutputSink
+{
+public:
+	virtual ~OutputSink(void) {}
+
+	virtual bool write(const void *data, const size_t length) = 0;
+	virtual bool close(void) = 0;
+
+	static OutputSink *create(const SinkType type, const char *fileName, const uint64_t offset, const uint64_t length);
+
+protected:
+	virtual bool open(const char *fileName, const uint64_t offset, const uint64_t length) = 0;
+};
+
+//Buffered CRT stream, either opened on a file or wrapping an existing stream (e.g. STDOUT)
+class StdioSink : public OutputSink
+{
+public:
+	StdioSink(FILE *stream = NULL);
+	virtual ~StdioSink(void);
+
+	virtual bool write(const void *data, const size_t length);
+	virtual bool close(void);
+
+protected:
+	virtual bool open(const char *fileName, const uint64_t offset, const uint64_t length);
+
+private:
+	FILE *m_stream;
+	bool m_owned;
+
+	StdioSink &operator=(const StdioSink &rhs) { throw std::runtime_error("Unimplemented!"); }
+};
+
+//Unbuffered positional writes (WriteFile with an explicit offset, like pwrite)
+class PwriteSink : public OutputSink
+{
+public:
+	PwriteSink(void);
+	virtual ~PwriteSink(void);
+
+	virtual bool write(const void *data, const size_t length);
+	virtual bool close(void);
+
+protected:
+	virtual bool open(const char *fileName, const uint64_t offset, const uint64_t length);
+
+private:
+	void *m_handle;
+	uint64_t m_position;
+};
+
+//Memory-mapped view of the file's tail, the file is extended to its final size on open
+class MmapSink : public OutputSink
+{
+public:
+	MmapSink(void);
+	virtual ~MmapSink(void);
+
+	virtual bool write(const void *data, const size_t length);
+	virtual bool close(void);
+
+protected:
+	virtual bool open(const char *fileName, const uint64_t offset, const uint64_t length);
+
+private:
+	void *m_handle;
+	void *m_mapping;
+	unsigned char *m_view;
+	unsigned char *m_data;
+	size_t m_length;
+	size_t m_position;
+};
+
+//Collects the data in memory, the file is left untouched (for tests and benchmarks)
+class MemorySink : public OutputSink
+{
+public:
+	virtual bool write(const void *data, const size_t length);
+	virtual bool close(void);
+
+	inline const std::vector<unsigned char> &getData(void) const { return m_data; }
+
+protected:
+	virtual bool open(const char *fileName, const uint64_t offset, const uint64_t length);
+
+private:
+	std::vector<unsigned char> m_data;
+};
+
+#endif //TAG_SINK_H_INCLUDED
@@ -0,0 +1,123 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "stream_filter.h"
+#include "ape_tag.h"
+#include "sink.h"
+#include "log.h"
+
+//CRT includes
+#include <cstdio>
+#include <vector>
+#include <io.h>
+#include <fcntl.h>
+
+//Windows includes
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+//Const
+static const DWORD PUMP_BUFFER_SIZE = 1024 * 1024;
+
+///////////////////////////////////////////////////////////////////////////////
+// Stream Filter
+///////////////////////////////////////////////////////////////////////////////
+
+bool StreamFilter::run(const std::vector<TagItem*> &items)
+{
+	//The tag is written through the CRT, so it must not translate line endings
+	_setmode(_fileno(stdin),  _O_BINARY);
+	_setmode(_fileno(stdout), _O_BINARY);
+
+	//Binary items are loaded first, so that a missing file fails the command before any output is written
+	std::vector<BinaryData> binaries;
+	if(!ApeTagger::loadBinaries(items, binaries))
+	{
+		return false;
+	}
+
+	if(!pumpStream())
+	{
+		LOG("Stream operation has failed:\nUnable to pass the media stream from STDIN to STDOUT!\n\n");
+		return false;
+	}
+
+	StdioSink sink(stdout);
+	if(!ApeTagger::writeTags(sink, items, binaries))
+	{
+		return false;
+	}
+
+	if(!sink.close())
+	{
+		LOG("Stream operation has failed:\nUnable to flush the tag data to STDOUT!\n\n");
+		return false;
+	}
+
+	return true;
+}
+
+bool StreamFilter::pumpStream(void)
+{
+	const HANDLE input  = GetStdHandle(STD_INPUT_HANDLE);
+	const HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+
+	if((input == INVALID_HANDLE_VALUE) || (output == INVALID_HANDLE_VALUE) || (input == NULL) || (output == NULL))
+	{
+		return false;
+	}
+
+	//Bypass the CRT buffers and hand over large blocks directly between the OS handles
+	std::vector<unsigned char> buffer(PUMP_BUFFER_SIZE);
+
+	for(;;)
+	{
+		DWORD bytesRead = 0;
+		if(!ReadFile(input, buffer.data(), PUMP_BUFFER_SIZE, &bytesRead, NULL))
+		{
+			const DWORD error = GetLastError();
+			if((error == ERROR_BROKEN_PIPE) || (error == ERROR_HANDLE_EOF))
+			{
+				break; /*writer has closed the pipe*/
+			}
+			return false;
+		}
+		if(bytesRead == 0)
+		{
+			break; /*end of stream*/
+		}
+
+		DWORD offset = 0;
+		while(offset < bytesRead)
+		{
+			DWORD bytesWritten = 0;
+			if((!WriteFile(output, buffer.data() + offset, bytesRead - offset, &bytesWritten, NULL)) || (bytesWritten == 0))
+			{
+				return false;
+			}
+			offset += bytesWritten;
+		}
+	}
+
+	return true;
+}
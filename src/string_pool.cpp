@@ -0,0 +1,187 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "string_pool.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+//Const
+static const uint32_t PAGE_BITS = 12;
+static const uint32_t PAGE_SIZE = 1U << PAGE_BITS;
+static const uint32_t MAX_PAGES = 16384;
+static const size_t   ARENA_BLOCK_SIZE = 64 * 1024;
+static const size_t   INITIAL_BUCKETS  = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+static uint32_t hash_string(const char *str, size_t *length)
+{
+	uint32_t hash = 0x811C9DC5;
+	const char *pos = str;
+	for(; *pos; pos++)
+	{
+		hash = (hash ^ ((unsigned char) *pos)) * 0x01000193;
+	}
+	*length = pos - str;
+	return hash;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Pool
+///////////////////////////////////////////////////////////////////////////////
+
+//Strings are packed into arena blocks, the ID table is split into pages that never move
+static struct string_pool_t
+{
+	string_pool_t(void)
+	:
+		count(1), arena(NULL), arenaPos(ARENA_BLOCK_SIZE)
+	{
+		memset(pages, 0, sizeof(pages));
+		pages[0] = new const char*[PAGE_SIZE];
+		pages[0][0] = NULL;
+		buckets.assign(INITIAL_BUCKETS, 0);
+	}
+
+	~string_pool_t(void)
+	{
+		for(uint32_t i = 0; (i < MAX_PAGES) && pages[i]; i++)
+		{
+			delete [] pages[i];
+		}
+		for(std::vector<char*>::iterator iter = blocks.begin(); iter != blocks.end(); iter++)
+		{
+			free(*iter);
+		}
+	}
+
+	inline const char *get(const uint32_t id) const
+	{
+		return pages[id >> PAGE_BITS][id & (PAGE_SIZE - 1)];
+	}
+
+	char *allocate(const size_t size)
+	{
+		if(size > ARENA_BLOCK_SIZE / 4)
+		{
+			blocks.push_back((char*) malloc(size));
+			return blocks.back();
+		}
+		if(ARENA_BLOCK_SIZE - arenaPos < size)
+		{
+			blocks.push_back(arena = (char*) malloc(ARENA_BLOCK_SIZE));
+			arenaPos = 0;
+		}
+		char *const result = &arena[arenaPos];
+		arenaPos += size;
+		return result;
+	}
+
+	void grow(void)
+	{
+		std::vector<uint32_t> table(buckets.size() * 2, 0);
+		const size_t mask = table.size() - 1;
+		size_t length;
+		for(uint32_t id = 1; id < count; id++)
+		{
+			size_t i = hash_string(get(id), &length) & mask;
+			while(table[i]) i = (i + 1) & mask;
+			table[i] = id;
+		}
+		buckets.swap(table);
+	}
+
+	std::mutex mutex;
+	const char **pages[MAX_PAGES];
+	uint32_t count;
+	std::vector<uint32_t> buckets;
+	std::vector<char*> blocks;
+	char *arena;
+	size_t arenaPos;
+}
+g_pool;
+
+///////////////////////////////////////////////////////////////////////////////
+// String Pool
+///////////////////////////////////////////////////////////////////////////////
+
+uint32_t StringPool::intern(const char *str)
+{
+	if(!str)
+	{
+		return 0;
+	}
+
+	size_t length;
+	const uint32_t hash = hash_string(str, &length);
+
+	std::lock_guard<std::mutex> lock(g_pool.mutex);
+
+	//Open addressing with linear probing, a zero bucket is empty
+	size_t mask = g_pool.buckets.size() - 1;
+	size_t i = hash & mask;
+	for(; g_pool.buckets[i]; i = (i + 1) & mask)
+	{
+		if(strcmp(g_pool.get(g_pool.buckets[i]), str) == 0)
+		{
+			return g_pool.buckets[i];
+		}
+	}
+
+	const uint32_t id = g_pool.count;
+	if((id >> PAGE_BITS) >= MAX_PAGES)
+	{
+		throw std::runtime_error("String pool exhausted!");
+	}
+	if(!g_pool.pages[id >> PAGE_BITS])
+	{
+		g_pool.pages[id >> PAGE_BITS] = new const char*[PAGE_SIZE];
+	}
+
+	char *const copy = g_pool.allocate(length + 1);
+	memcpy(copy, str, length + 1);
+	g_pool.pages[id >> PAGE_BITS][id & (PAGE_SIZE - 1)] = copy;
+	g_pool.count++;
+
+	//Keep the load factor below one half
+	if(2 * g_pool.count > g_pool.buckets.size())
+	{
+		g_pool.grow();
+	}
+	else
+	{
+		g_pool.buckets[i] = id;
+	}
+
+	return id;
+}
+
+const char *StringPool::lookup(const uint32_t id)
+{
+	return g_pool.get(id);
+}
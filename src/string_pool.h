@@ -0,0 +1,41 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TAG_STRING_POOL_H_INCLUDED
+#define TAG_STRING_POOL_H_INCLUDED
+
+#include <stdint.h>
+
+// Process-wide pool of interned strings. Each distinct string is stored once
+// and referenced by a compact ID, so that equal strings have equal IDs. The
+// ID zero stands for NULL. Interned strings live until the process exits.
+//
+// Looking up an ID does not take a lock. It is safe on any thread that has
+// received the ID through a synchronizing operation, such as a queue hand-off.
+class StringPool
+{
+public:
+	static uint32_t intern(const char *str);
+	static const char *lookup(const uint32_t id);
+};
+
+#endif //TAG_STRING_POOL_H_INCLUDED
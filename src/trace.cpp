@@ -0,0 +1,241 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "trace.h"
+#include "unicode_support.h"
+#include "log.h"
+
+//CRT includes
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+
+//Windows includes
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+//Const
+static const size_t TRACE_BUFFER_SIZE = 16384;
+static const size_t TRACE_ARG_SIZE = 48;
+static const size_t TRACE_NAME_SIZE = 32;
+
+///////////////////////////////////////////////////////////////////////////////
+// Types
+///////////////////////////////////////////////////////////////////////////////
+
+typedef struct
+{
+	const char *name;
+	uint64_t start;
+	uint64_t end;
+	char arg[TRACE_ARG_SIZE];
+}
+trace_event_t;
+
+//Ring buffer of one thread, the oldest events are overwritten when it is full
+typedef struct trace_buffer_t
+{
+	trace_event_t events[TRACE_BUFFER_SIZE];
+	uint64_t count;
+	unsigned int tid;
+	char threadName[TRACE_NAME_SIZE];
+	trace_buffer_t *next;
+}
+trace_buffer_t;
+
+///////////////////////////////////////////////////////////////////////////////
+// Globals
+///////////////////////////////////////////////////////////////////////////////
+
+bool Trace::s_enabled = false;
+const char *Trace::s_fileName = NULL;
+
+static __declspec(thread) trace_buffer_t *t_buffer = NULL;
+static std::atomic<trace_buffer_t*> g_buffers(NULL);
+static std::atomic<unsigned int> g_nextTid(1);
+static uint64_t g_origin = 0, g_frequency = 1;
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+//Buffers are pushed onto a lock-free list, they live until the process exits
+static trace_buffer_t *get_buffer(void)
+{
+	if(!t_buffer)
+	{
+		trace_buffer_t *const buffer = new trace_buffer_t;
+		buffer->count = 0;
+		buffer->tid = g_nextTid++;
+		buffer->threadName[0] = '\0';
+		buffer->next = g_buffers.load();
+		while(!g_buffers.compare_exchange_weak(buffer->next, buffer));
+		t_buffer = buffer;
+	}
+	return t_buffer;
+}
+
+//Only the tail of long file names is kept, it is the most significant part. The cut is moved
+//forward to the next lead byte, so that no partial UTF-8 sequence ends up in the JSON output
+static void copy_arg(char *dest, const char *src, const size_t size)
+{
+	const size_t len = strlen(src);
+	const char *start = (len < size) ? src : &src[len - (size - 1)];
+	while((start > src) && ((*start & 0xC0) == 0x80))
+	{
+		start++;
+	}
+	strncpy(dest, start, size - 1);
+	dest[size - 1] = '\0';
+}
+
+static void write_json_string(FILE *file, const char *str)
+{
+	fputc('"', file);
+	for(; *str; str++)
+	{
+		const unsigned char c = *str;
+		if((c == '"') || (c == '\\'))
+		{
+			fputc('\\', file); fputc(c, file);
+		}
+		else if(c < 0x20)
+		{
+			fprintf(file, "\\u%04x", c);
+		}
+		else
+		{
+			fputc(c, file);
+		}
+	}
+	fputc('"', file);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Trace
+///////////////////////////////////////////////////////////////////////////////
+
+bool Trace::enable(const char *fileName)
+{
+	LARGE_INTEGER value;
+	if(!QueryPerformanceFrequency(&value))
+	{
+		return false;
+	}
+	g_frequency = value.QuadPart;
+	s_fileName = fileName;
+	s_enabled = true;
+	g_origin = now();
+	return true;
+}
+
+uint64_t Trace::now(void)
+{
+	LARGE_INTEGER value;
+	QueryPerformanceCounter(&value);
+	return value.QuadPart;
+}
+
+void Trace::setThreadName(const char *name)
+{
+	if(s_enabled)
+	{
+		copy_arg(get_buffer()->threadName, name, TRACE_NAME_SIZE);
+	}
+}
+
+void Trace::record(const char *name, const char *arg, const uint64_t start, const uint64_t end)
+{
+	trace_buffer_t *const buffer = get_buffer();
+	trace_event_t &event = buffer->events[buffer->count % TRACE_BUFFER_SIZE];
+
+	event.name = name;
+	event.start = start;
+	event.end = end;
+	if(arg)
+	{
+		copy_arg(event.arg, arg, TRACE_ARG_SIZE);
+	}
+	else
+	{
+		event.arg[0] = '\0';
+	}
+
+	buffer->count++;
+}
+
+bool Trace::dump(void)
+{
+	if(!s_enabled)
+	{
+		return true;
+	}
+
+	FILE *file = fopen_utf8(s_fileName, "wb");
+	if(!file)
+	{
+		LOG("Failed to open trace file for writing:\n%s\n\nInvalid file specified or access denied!\n\n", s_fileName);
+		return false;
+	}
+
+	fputs("{\"traceEvents\":[\n", file);
+	bool first = true;
+
+	for(trace_buffer_t *buffer = g_buffers.load(); buffer; buffer = buffer->next)
+	{
+		if(buffer->threadName[0])
+		{
+			fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", (first ? "" : ",\n"), buffer->tid);
+			write_json_string(file, buffer->threadName);
+			fputs("}}", file);
+			first = false;
+		}
+
+		const uint64_t count = (buffer->count < TRACE_BUFFER_SIZE) ? buffer->count : TRACE_BUFFER_SIZE;
+		for(uint64_t i = buffer->count - count; i < buffer->count; i++)
+		{
+			const trace_event_t &event = buffer->events[i % TRACE_BUFFER_SIZE];
+			const double ts  = ((double)(event.start - g_origin)) * 1000000.0 / g_frequency;
+			const double dur = ((double)(event.end - event.start)) * 1000000.0 / g_frequency;
+			fprintf(file, "%s{\"name\":\"%s\",\"cat\":\"tag\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f", (first ? "" : ",\n"), event.name, buffer->tid, ts, dur);
+			if(event.arg[0])
+			{
+				fputs(",\"args\":{\"file\":", file);
+				write_json_string(file, event.arg);
+				fputc('}', file);
+			}
+			fputc('}', file);
+			first = false;
+		}
+	}
+
+	fputs("\n]}\n", file);
+
+	if(fclose(file) != 0)
+	{
+		LOG("Failed to write trace file:\n%s\n\n", s_fileName);
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,78 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TAG_TRACE_H_INCLUDED
+#define TAG_TRACE_H_INCLUDED
+
+#include <stdint.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Execution Trace
+///////////////////////////////////////////////////////////////////////////////
+
+// Records spans into per-thread ring buffers and writes them as Chrome trace
+// JSON (chrome://tracing, Perfetto). Each thread only writes to its own buffer,
+// so recording takes no locks. When tracing is disabled, a span only tests a
+// flag. The trace must be written after all worker threads have terminated.
+class Trace
+{
+public:
+	static bool enable(const char *fileName);
+	static bool dump(void);
+
+	static inline bool isEnabled(void) { return s_enabled; }
+
+	static void setThreadName(const char *name);
+	static void record(const char *name, const char *arg, const uint64_t start, const uint64_t end);
+	static uint64_t now(void);
+
+private:
+	static bool s_enabled;
+	static const char *s_fileName;
+};
+
+class TraceSpan
+{
+public:
+	inline TraceSpan(const char *name, const char *arg)
+	:
+		m_name(Trace::isEnabled() ? name : 0), m_arg(arg), m_start(m_name ? Trace::now() : 0)
+	{
+	}
+
+	inline ~TraceSpan(void)
+	{
+		if(m_name)
+		{
+			Trace::record(m_name, m_arg, m_start, Trace::now());
+		}
+	}
+
+private:
+	const char *const m_name;
+	const char *const m_arg;
+	const uint64_t m_start;
+};
+
+#define TRACE_SPAN(NAME, ARG) TraceSpan _trace_span(NAME, ARG)
+
+#endif //TAG_TRACE_H_INCLUDED
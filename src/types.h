@@ -23,6 +23,8 @@
 #ifndef TAG_TYPES_H_INCLUDED
 #define TAG_TYPES_H_INCLUDED
 
+#include "string_pool.h"
+
 #include <cstring>
 #include <stdexcept>
 
@@ -34,7 +36,8 @@ typedef enum
 {
 	TAG_TYPE_STRING = 0,
 	TAG_TYPE_NUMBER = 1,
-	TAG_TYPE_DATE   = 2
+	TAG_TYPE_DATE   = 2,
+	TAG_TYPE_BINARY = 3
 }
 TagType;
 
@@ -74,6 +77,7 @@ public:
 	virtual ~TagData(void) {}
 
 	virtual const char        *toString(void) const = 0;
+	virtual const uint32_t     toStringId(void) const = 0;
 	virtual const unsigned int toNumber(void) const = 0;
 	virtual const TagDate     &toDate(void)   const = 0;
 	
@@ -83,21 +87,22 @@ private:
 	TagData &operator=(const TagData &rhs) { throw std::runtime_error("Unimplemented!");}
 };
 
-// String data
+// String data, interned so that equal values share one copy
 class TagData_String : public TagData
 {
 public:
-	TagData_String(const char *str)                      { m_string = (str != NULL) ? _strdup(str) : NULL; }
-	virtual ~TagData_String(void)                        { if(m_string != NULL) { free(m_string); m_string = NULL; } }
+	TagData_String(const char *str)                      { m_string = StringPool::intern(str); }
+	virtual ~TagData_String(void)                        { /*nothing to do*/ }
 
-	virtual const char *toString(void)        const      { return m_string; }
+	virtual const char *toString(void)        const      { return StringPool::lookup(m_string); }
+	virtual const uint32_t toStringId(void)   const      { return m_string; }
 	virtual const unsigned int toNumber(void) const      { throw std::runtime_error("Invalid type requested!"); }
 	virtual const TagDate &toDate(void)       const      { throw std::runtime_error("Invalid type requested!"); }
 
 	virtual const TagType type(void) const               { return TAG_TYPE_STRING; }
 
 private:
-	char *m_string;
+	uint32_t m_string;
 	TagData_String &operator=(const TagData_String &rhs) { throw std::runtime_error("Unimplemented!");}
 };
 
@@ -109,6 +114,7 @@ public:
 	virtual ~TagData_Number(void)                        { /*nothing to do*/ }
 
 	virtual const char *toString(void)        const      { throw std::runtime_error("Invalid type requested!"); }
+	virtual const uint32_t toStringId(void)   const      { throw std::runtime_error("Invalid type requested!"); }
 	virtual const unsigned int toNumber(void) const      { return m_number; }
 	virtual const TagDate &toDate(void)       const      { throw std::runtime_error("Invalid type requested!"); }
 
@@ -127,6 +133,7 @@ public:
 	virtual ~TagData_Date(void)                      { /*nothing to do*/ }
 
 	virtual const char *toString(void)        const  { throw std::runtime_error("Invalid type requested!"); }
+	virtual const uint32_t toStringId(void)   const  { throw std::runtime_error("Invalid type requested!"); }
 	virtual const unsigned int toNumber(void) const  { throw std::runtime_error("Invalid type requested!"); }
 	virtual const TagDate &toDate(void )      const  { return m_date; }
 
@@ -137,6 +144,25 @@ private:
 	TagData_Date &operator=(const TagData_Date &rhs) { throw std::runtime_error("Unimplemented!");}
 };
 
+// Binary data, only the name of the file is kept, its content is loaded through the BinaryCache
+class TagData_Binary : public TagData
+{
+public:
+	TagData_Binary(const char *fileName)                 { m_fileName = StringPool::intern(fileName); }
+	virtual ~TagData_Binary(void)                        { /*nothing to do*/ }
+
+	virtual const char *toString(void)        const      { return StringPool::lookup(m_fileName); }
+	virtual const uint32_t toStringId(void)   const      { return m_fileName; }
+	virtual const unsigned int toNumber(void) const      { throw std::runtime_error("Invalid type requested!"); }
+	virtual const TagDate &toDate(void)       const      { throw std::runtime_error("Invalid type requested!"); }
+
+	virtual const TagType type(void) const               { return TAG_TYPE_BINARY; }
+
+private:
+	uint32_t m_fileName;
+	TagData_Binary &operator=(const TagData_Binary &rhs) { throw std::runtime_error("Unimplemented!");}
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // Tag Item
 ///////////////////////////////////////////////////////////////////////////////
@@ -159,13 +185,18 @@ public:
 		return new TagItem(key, new TagData_Date(y, m ,d));
 	}
 
-	inline const char    *getTagKey(void)  const { return m_key; }
+	static TagItem *fromBinary(const char* key, const char *fileName)
+	{
+		return new TagItem(key, new TagData_Binary(fileName));
+	}
+
+	inline const char    *getTagKey(void)  const { return StringPool::lookup(m_key); }
+	inline const uint32_t getTagKeyId(void) const { return m_key; }
 	inline const TagData *getTagData(void) const { return m_data; }
 
 	~TagItem(void)
 	{
 		delete m_data; m_data = NULL;
-		free(m_key);   m_key  = NULL;
 	}
 
 private:
@@ -173,7 +204,7 @@ private:
 	{
 		if((key != NULL) && (data != NULL))
 		{
-			m_key = _strdup(key);
+			m_key = StringPool::intern(key);
 			m_data = data;
 		}
 		else
@@ -182,7 +213,7 @@ private:
 		}
 	}
 
-	char *m_key;
+	uint32_t m_key;
 	const TagData *m_data;
 
 	TagItem &operator=(const TagItem &rhs) { throw std::runtime_error("Unimplemented!");}
@@ -204,6 +235,8 @@ static const char* type2string(TagType t)
 		return "Numeric";
 	case TAG_TYPE_DATE:
 		return "ISO 8601 Date";
+	case TAG_TYPE_BINARY:
+		return "Binary file";
 	default:
 		return "Unknown";
 	}
@@ -172,6 +172,20 @@ int stat_utf8(const char *path_utf8, struct _stat *buf)
 	return ret;
 }
 
+int stat64_utf8(const char *path_utf8, struct _stat64 *buf)
+{
+	int ret = -1;
+	
+	wchar_t *path_utf16 = utf8_to_utf16(path_utf8);
+	if(path_utf16)
+	{
+		ret = _wstat64(path_utf16, buf);
+		free(path_utf16);
+	}
+	
+	return ret;
+}
+
 int unlink_utf8(const char *path_utf8)
 {
 	int ret = -1;
@@ -186,6 +200,24 @@ int unlink_utf8(const char *path_utf8)
 	return ret;
 }
 
+int rename_utf8(const char *old_path_utf8, const char *new_path_utf8)
+{
+	int ret = -1;
+	
+	wchar_t *old_path_utf16 = utf8_to_utf16(old_path_utf8);
+	wchar_t *new_path_utf16 = utf8_to_utf16(new_path_utf8);
+
+	if(old_path_utf16 && new_path_utf16)
+	{
+		ret = MoveFileExW(old_path_utf16, new_path_utf16, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) ? 0 : -1;
+	}
+
+	if(old_path_utf16) free(old_path_utf16);
+	if(new_path_utf16) free(new_path_utf16);
+
+	return ret;
+}
+
 void init_console_utf8(void)
 {
 	g_old_output_cp = GetConsoleOutputCP();
@@ -39,7 +39,9 @@ void init_commandline_arguments_utf8(int *argc, char ***argv);
 void free_commandline_arguments_utf8(int *argc, char ***argv);
 FILE *fopen_utf8(const char *filename_utf8, const char *mode_utf8);
 int stat_utf8(const char *path_utf8, struct _stat *buf);
+int stat64_utf8(const char *path_utf8, struct _stat64 *buf);
 int unlink_utf8(const char *path_utf8);
+int rename_utf8(const char *old_path_utf8, const char *new_path_utf8);
 void init_console_utf8(void);
 void uninit_console_utf8(void);
 
@@ -0,0 +1,133 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "utils.h"
+#include "types.h"
+
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+//Const
+static const size_t COPY_BUFFER_SIZE = 1024 * 1024;
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+inline static void date2string(const TagDate &date, char *buffer)
+{
+	if(date.getY() < 1)
+	{
+		throw std::runtime_error("Invalid date specification!");
+	}
+	
+	if(date.getM() > 0)
+	{
+		if(date.getD() > 0)
+		{
+			sprintf(buffer, "%04u-%02u-%02u", date.getY(), date.getM(), date.getD());
+		}
+		else
+		{
+			sprintf(buffer, "%04u-%02u", date.getY(), date.getM());
+		}
+	}
+	else
+	{
+		sprintf(buffer, "%04u", date.getY());
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Public functions
+///////////////////////////////////////////////////////////////////////////////
+
+const char *item2string(const TagItem *item, char *buffer)
+{
+	switch(item->getTagData()->type())
+	{
+	case TAG_TYPE_STRING:
+		return item->getTagData()->toString();
+	case TAG_TYPE_NUMBER:
+		sprintf(buffer, "%u", item->getTagData()->toNumber());
+		return buffer;
+	case TAG_TYPE_DATE:
+		date2string(item->getTagData()->toDate(), buffer);
+		return buffer;
+	default:
+		throw std::runtime_error("Bad item type!");
+	}
+}
+
+bool copy_file_data(FILE *src, FILE *dst, const uint64_t length)
+{
+	std::vector<unsigned char> buffer(COPY_BUFFER_SIZE);
+	uint64_t remaining = length;
+
+	while(remaining > 0)
+	{
+		const size_t chunk = (remaining > COPY_BUFFER_SIZE) ? COPY_BUFFER_SIZE : ((size_t) remaining);
+		if(fread(buffer.data(), sizeof(unsigned char), chunk, src) != chunk)
+		{
+			return false;
+		}
+		if(fwrite(buffer.data(), sizeof(unsigned char), chunk, dst) != chunk)
+		{
+			return false;
+		}
+		remaining -= chunk;
+	}
+
+	return true;
+}
+
+bool get_file_size(FILE *file, uint64_t &size)
+{
+	const __int64 position = _ftelli64(file);
+	if((position < 0) || (_fseeki64(file, 0, SEEK_END) != 0))
+	{
+		return false;
+	}
+
+	const __int64 end = _ftelli64(file);
+	if((end < 0) || (_fseeki64(file, position, SEEK_SET) != 0))
+	{
+		return false;
+	}
+
+	size = (uint64_t) end;
+	return true;
+}
+
+uint64_t get_id3v2_size(const unsigned char *header)
+{
+	if(memcmp(header, "ID3", 3) != 0)
+	{
+		return 0;
+	}
+
+	//The size is stored as a syncsafe integer, only ID3v2.4 defines a footer
+	const uint64_t size = ((header[6] & 0x7F) << 21) | ((header[7] & 0x7F) << 14) | ((header[8] & 0x7F) << 7) | (header[9] & 0x7F);
+	return 10 + size + (((header[3] >= 4) && (header[5] & 0x10)) ? 10 : 0);
+}
@@ -0,0 +1,46 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TAG_UTILS_H_INCLUDED
+#define TAG_UTILS_H_INCLUDED
+
+#include <cstdio>
+#include <stdint.h>
+
+class TagItem;
+
+//Size of the buffer that must be passed to item2string()
+static const size_t ITEM_BUFFER_SIZE = 32;
+
+//Converts the item's value to a string (returned pointer is either the item's own string or the given buffer)
+const char *item2string(const TagItem *item, char *buffer);
+
+//Copies 'length' bytes from the current position of 'src' to the current position of 'dst'
+bool copy_file_data(FILE *src, FILE *dst, const uint64_t length);
+
+//Returns the total size of the file, the current position is preserved
+bool get_file_size(FILE *file, uint64_t &size);
+
+//Returns the size of the ID3v2 tag that begins with the given 10-byte header, including its footer (zero if there is no tag)
+uint64_t get_id3v2_size(const unsigned char *header);
+
+#endif //TAG_UTILS_H_INCLUDED
@@ -0,0 +1,182 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "vorbis_comment.h"
+#include "types.h"
+#include "keys.h"
+#include "utils.h"
+#include "log.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+#include <vector>
+
+//Const
+static const char *const DEFAULT_VENDOR = "Simple Tag Creator";
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+inline static unsigned int read_uint32_le(const unsigned char *src)
+{
+	return ((unsigned int)src[0]) | (((unsigned int)src[1]) << 8) | (((unsigned int)src[2]) << 16) | (((unsigned int)src[3]) << 24);
+}
+
+inline static void append_uint32_le(std::vector<unsigned char> &dest, const unsigned int value)
+{
+	dest.push_back((unsigned char)((value >>  0) & 0xFF));
+	dest.push_back((unsigned char)((value >>  8) & 0xFF));
+	dest.push_back((unsigned char)((value >> 16) & 0xFF));
+	dest.push_back((unsigned char)((value >> 24) & 0xFF));
+}
+
+inline static void append_nbytes(std::vector<unsigned char> &dest, const unsigned char *data, const size_t len)
+{
+	dest.insert(dest.end(), data, data + len);
+}
+
+static const char *vorbis_field(const char *key)
+{
+	for(int i = 0; g_tagSpec[i].key; i++)
+	{
+		if(strcmp(key, g_tagSpec[i].key) == 0)
+		{
+			return g_tagSpec[i].vorbis;
+		}
+	}
+	return NULL;
+}
+
+static bool field_matches(const std::vector<unsigned char> &comment, const char *field)
+{
+	const size_t len = strlen(field);
+	if((comment.size() > len) && (comment[len] == '='))
+	{
+		return (_strnicmp((const char*) comment.data(), field, len) == 0);
+	}
+	return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Vorbis Comment
+///////////////////////////////////////////////////////////////////////////////
+
+//Trailing data (framing bit, padding) after the comment list is ignored
+bool VorbisComment::parse(const unsigned char *data, const size_t length, std::vector<unsigned char> &vendor, std::vector<std::vector<unsigned char>> &comments)
+{
+	const unsigned char *pos = data, *const end = data + length;
+
+	//Vendor string
+	if(end - pos < 4) return false;
+	const unsigned int vendorLen = read_uint32_le(pos); pos += 4;
+	if(((size_t)(end - pos)) < vendorLen) return false;
+	vendor.assign(pos, pos + vendorLen); pos += vendorLen;
+
+	//User comments
+	if(end - pos < 4) return false;
+	const unsigned int count = read_uint32_le(pos); pos += 4;
+	for(unsigned int i = 0; i < count; i++)
+	{
+		if(end - pos < 4) return false;
+		const unsigned int len = read_uint32_le(pos); pos += 4;
+		if(((size_t)(end - pos)) < len) return false;
+		comments.push_back(std::vector<unsigned char>(pos, pos + len)); pos += len;
+	}
+
+	return true;
+}
+
+void VorbisComment::build(const std::vector<TagItem*> &items, const std::vector<unsigned char> &vendor, const std::vector<std::vector<unsigned char>> &comments, std::vector<unsigned char> &dest)
+{
+	std::vector<std::string> fields;
+	char tempBuffer[ITEM_BUFFER_SIZE];
+
+	//Create the new comments
+	for(std::vector<TagItem*>::const_iterator iter = items.cbegin(); iter != items.cend(); iter++)
+	{
+		if((*iter)->getTagData()->type() == TAG_TYPE_BINARY)
+		{
+			continue; /*binary items are only stored in APE tags*/
+		}
+		const char *field = vorbis_field((*iter)->getTagKey());
+		if(field == NULL)
+		{
+			throw std::runtime_error("Key has no Vorbis comment mapping!");
+		}
+
+		const char *str = item2string(*iter, tempBuffer);
+		fields.push_back(std::string(field) + "=" + str);
+
+		LOG_VERBOSE("%-11s : %s\n", (*iter)->getTagKey(), str);
+	}
+
+	//Keep the existing comments that are not replaced
+	std::vector<const std::vector<unsigned char>*> retained;
+	for(std::vector<std::vector<unsigned char>>::const_iterator iter = comments.cbegin(); iter != comments.cend(); iter++)
+	{
+		bool replaced = false;
+		for(std::vector<TagItem*>::const_iterator item = items.cbegin(); item != items.cend(); item++)
+		{
+			if((*item)->getTagData()->type() == TAG_TYPE_BINARY)
+			{
+				continue;
+			}
+			if(field_matches(*iter, vorbis_field((*item)->getTagKey())))
+			{
+				replaced = true;
+				break;
+			}
+		}
+		if(!replaced)
+		{
+			retained.push_back(&(*iter));
+		}
+	}
+
+	//Serialize the comment structure
+	dest.clear();
+	if(vendor.empty())
+	{
+		append_uint32_le(dest, strlen(DEFAULT_VENDOR));
+		append_nbytes(dest, (const unsigned char*) DEFAULT_VENDOR, strlen(DEFAULT_VENDOR));
+	}
+	else
+	{
+		append_uint32_le(dest, vendor.size());
+		append_nbytes(dest, vendor.data(), vendor.size());
+	}
+
+	append_uint32_le(dest, retained.size() + fields.size());
+	for(std::vector<const std::vector<unsigned char>*>::const_iterator iter = retained.cbegin(); iter != retained.cend(); iter++)
+	{
+		append_uint32_le(dest, (*iter)->size());
+		append_nbytes(dest, (*iter)->data(), (*iter)->size());
+	}
+	for(std::vector<std::string>::const_iterator iter = fields.cbegin(); iter != fields.cend(); iter++)
+	{
+		append_uint32_le(dest, iter->length());
+		append_nbytes(dest, (const unsigned char*) iter->c_str(), iter->length());
+	}
+}
@@ -0,0 +1,39 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef VORBIS_COMMENT_H_INCLUDED
+#define VORBIS_COMMENT_H_INCLUDED
+
+#include <vector>
+
+class TagItem;
+
+// Vorbis comment structure (vendor string plus "FIELD=value" list), as used
+// by the FLAC VORBIS_COMMENT block and the Vorbis/Opus comment headers.
+class VorbisComment
+{
+public:
+	static bool parse(const unsigned char *data, const size_t length, std::vector<unsigned char> &vendor, std::vector<std::vector<unsigned char>> &comments);
+	static void build(const std::vector<TagItem*> &items, const std::vector<unsigned char> &vendor, const std::vector<std::vector<unsigned char>> &comments, std::vector<unsigned char> &dest);
+};
+
+#endif //VORBIS_COMMENT_H_INCLUDED
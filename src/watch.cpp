@@ -0,0 +1,448 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#include "watch.h"
+#include "job.h"
+#include "types.h"
+#include "parser.h"
+#include "options.h"
+#include "unicode_support.h"
+#include "log.h"
+
+//CRT includes
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/stat.h>
+
+//Windows includes
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+//Const
+static const DWORD NOTIFY_BUFFER_SIZE = 64 * 1024;
+static const size_t MAX_LINE_LENGTH = 65536;
+static const char *const SIDECAR_SUFFIX = ".tags";
+static const unsigned int MAX_BUSY_RETRIES = 20;
+
+///////////////////////////////////////////////////////////////////////////////
+// Types
+///////////////////////////////////////////////////////////////////////////////
+
+//Rules file lines have the form "<pattern>[<TAB><key>=<value>]*"
+typedef struct
+{
+	std::string pattern;
+	std::vector<std::string> specs;
+}
+watch_rule_t;
+
+typedef std::chrono::steady_clock watch_clock_t;
+
+typedef struct
+{
+	int64_t size;
+	int64_t mtime;
+}
+watch_stamp_t;
+
+///////////////////////////////////////////////////////////////////////////////
+// Helper functions
+///////////////////////////////////////////////////////////////////////////////
+
+static bool ends_with(const std::string &str, const char *suffix)
+{
+	const size_t len = strlen(suffix);
+	return (str.length() >= len) && (_stricmp(str.c_str() + (str.length() - len), suffix) == 0);
+}
+
+//Wildcard match ('*' and '?'), case-insensitive for ASCII
+static bool match_pattern(const char *pattern, const char *name)
+{
+	const char *star = NULL, *retry = NULL;
+	while(*name)
+	{
+		if((*pattern == '?') || ((*pattern != '*') && (tolower((unsigned char)*pattern) == tolower((unsigned char)*name))))
+		{
+			pattern++; name++;
+		}
+		else if(*pattern == '*')
+		{
+			star = pattern++; retry = name;
+		}
+		else if(star)
+		{
+			pattern = star + 1; name = ++retry;
+		}
+		else
+		{
+			return false;
+		}
+	}
+	while(*pattern == '*')
+	{
+		pattern++;
+	}
+	return (*pattern == '\0');
+}
+
+static void strip_line(char *line)
+{
+	size_t len = strlen(line);
+	while((len > 0) && ((line[len - 1] == '\r') || (line[len - 1] == '\n')))
+	{
+		line[--len] = '\0';
+	}
+}
+
+static bool load_rules(const char *fileName, const bool normalize, std::vector<watch_rule_t> &rules)
+{
+	FILE *file = fopen_utf8(fileName, "rb");
+	if(!file)
+	{
+		LOG("Failed to open rules file:\n%s\n\nInvalid file specified or access denied!\n\n", fileName);
+		return false;
+	}
+
+	std::vector<char> line(MAX_LINE_LENGTH);
+	bool success = true;
+	while(success && fgets(line.data(), MAX_LINE_LENGTH, file))
+	{
+		strip_line(line.data());
+		if((line[0] == '\0') || (line[0] == '#'))
+		{
+			continue;
+		}
+
+		char *next = strchr(line.data(), '\t');
+		if(next) *next++ = '\0';
+
+		watch_rule_t rule;
+		rule.pattern = line.data();
+
+		//Specs are validated once here, they are parsed again for every file
+		std::vector<TagItem*> items;
+		while(next)
+		{
+			char *spec = next;
+			next = strchr(spec, '\t');
+			if(next) *next++ = '\0';
+			rule.specs.push_back(spec);
+			success = success && TagParser::parseItem(spec, items, normalize);
+		}
+		while(!items.empty())
+		{
+			delete items.back();
+			items.pop_back();
+		}
+
+		rules.push_back(rule);
+	}
+
+	fclose(file);
+	if(!success)
+	{
+		LOG("Invalid tag specification in rules file:\n%s\n\n", fileName);
+	}
+	return success;
+}
+
+//Items parsed later replace the job's items with the same key
+static bool apply_specs(TagJob &job, const std::vector<std::string> &specs, const bool normalize)
+{
+	std::vector<TagItem*> parsed;
+	bool success = true;
+	for(std::vector<std::string>::const_iterator iter = specs.cbegin(); success && (iter != specs.cend()); iter++)
+	{
+		success = TagParser::parseItem(iter->c_str(), parsed, normalize);
+	}
+
+	std::vector<TagItem*> &items = job.getItems();
+	for(std::vector<TagItem*>::iterator iter = parsed.begin(); iter != parsed.end(); iter++)
+	{
+		for(std::vector<TagItem*>::iterator item = items.begin(); item != items.end(); item++)
+		{
+			if((*item)->getTagKeyId() == (*iter)->getTagKeyId())
+			{
+				delete (*item);
+				items.erase(item);
+				break;
+			}
+		}
+		items.push_back(*iter);
+	}
+
+	return success;
+}
+
+//Sidecar files ("<file>.tags") contain one "key=value" item per line
+static bool read_sidecar(const std::string &fileName, std::vector<std::string> &specs)
+{
+	FILE *file = fopen_utf8((fileName + SIDECAR_SUFFIX).c_str(), "rb");
+	if(!file)
+	{
+		return false;
+	}
+
+	std::vector<char> line(MAX_LINE_LENGTH);
+	bool firstLine = true;
+	while(fgets(line.data(), MAX_LINE_LENGTH, file))
+	{
+		char *start = line.data();
+		if(firstLine && (memcmp(start, "\xEF\xBB\xBF", 3) == 0))
+		{
+			start += 3; /*skip the UTF-8 BOM*/
+		}
+		firstLine = false;
+
+		strip_line(start);
+		if(start[0] && (start[0] != '#'))
+		{
+			specs.push_back(start);
+		}
+	}
+
+	fclose(file);
+	return true;
+}
+
+//A file that is still open for writing cannot be opened without sharing
+static bool is_writer_done(const std::string &fileName)
+{
+	wchar_t *path = utf8_to_utf16(fileName.c_str());
+	if(!path)
+	{
+		return false;
+	}
+
+	HANDLE handle = CreateFileW(path, GENERIC_READ, 0, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	free(path);
+
+	if(handle == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+	CloseHandle(handle);
+	return true;
+}
+
+//Fails for anything that is not a regular file, e.g. a sub-directory whose contents have changed
+static bool get_stamp(const std::string &fileName, watch_stamp_t &stamp)
+{
+	struct _stat64 info;
+	if((stat64_utf8(fileName.c_str(), &info) != 0) || ((info.st_mode & _S_IFMT) != _S_IFREG))
+	{
+		return false;
+	}
+	stamp.size = info.st_size;
+	stamp.mtime = info.st_mtime;
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Watcher
+///////////////////////////////////////////////////////////////////////////////
+
+bool Watcher::run(const char *directory, const std::vector<TagItem*> &items, const TagOptions &options)
+{
+	std::vector<watch_rule_t> rules;
+	if(options.rules && (!load_rules(options.rules, options.normalize, rules)))
+	{
+		return false;
+	}
+
+	wchar_t *path = utf8_to_utf16(directory);
+	HANDLE dirHandle = path ? CreateFileW(path, FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, NULL) : INVALID_HANDLE_VALUE;
+	free(path);
+
+	if(dirHandle == INVALID_HANDLE_VALUE)
+	{
+		LOG("Failed to open directory for watching:\n%s\n\nInvalid directory specified or access denied!\n\n", directory);
+		return false;
+	}
+
+	const std::string prefix = std::string(directory) + "\\";
+	const watch_clock_t::duration debounce = std::chrono::milliseconds(options.debounce);
+
+	std::map<std::string, watch_clock_t::time_point> pending;
+	std::map<std::string, unsigned int> busy;
+	bool stopped = false;
+	std::mutex mutex;
+	std::condition_variable wakeup;
+
+	//The notification thread blocks in the system until something changes, each event (re-)arms the debounce timer of its file
+	std::thread notifier([&]()
+	{
+		std::vector<DWORD> buffer(NOTIFY_BUFFER_SIZE / sizeof(DWORD));
+		DWORD bytesReturned = 0;
+		while(ReadDirectoryChangesW(dirHandle, buffer.data(), NOTIFY_BUFFER_SIZE, FALSE, FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE, &bytesReturned, NULL, NULL))
+		{
+			if(bytesReturned == 0)
+			{
+				LOG_SUMMARY("Warning: Change notification buffer overflow, some files may have been missed!\n\n");
+				continue;
+			}
+
+			std::lock_guard<std::mutex> lock(mutex);
+			const unsigned char *pos = (const unsigned char*) buffer.data();
+			for(;;)
+			{
+				const FILE_NOTIFY_INFORMATION *const info = (const FILE_NOTIFY_INFORMATION*) pos;
+				if((info->Action == FILE_ACTION_ADDED) || (info->Action == FILE_ACTION_MODIFIED) || (info->Action == FILE_ACTION_RENAMED_NEW_NAME))
+				{
+					const std::wstring name(info->FileName, info->FileNameLength / sizeof(wchar_t));
+					char *name_utf8 = utf16_to_utf8(name.c_str());
+					if(name_utf8)
+					{
+						pending[prefix + name_utf8] = watch_clock_t::now() + debounce;
+						busy.erase(prefix + name_utf8); /*the file is still changing, so it may stay busy*/
+						free(name_utf8);
+					}
+				}
+				if(info->NextEntryOffset == 0)
+				{
+					break;
+				}
+				pos += info->NextEntryOffset;
+			}
+			wakeup.notify_one();
+		}
+
+		LOG("Failed to watch directory:\n%s\n\nChange notifications are not available!\n\n", directory);
+		std::lock_guard<std::mutex> lock(mutex);
+		stopped = true;
+		wakeup.notify_one();
+	});
+
+	LOG_SUMMARY("Watching for new files, press Ctrl+C to stop...\n\n");
+
+	std::map<std::string, watch_stamp_t> tagged;
+	for(;;)
+	{
+		std::string fileName;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			while(!stopped)
+			{
+				if(pending.empty())
+				{
+					wakeup.wait(lock);
+					continue;
+				}
+
+				std::map<std::string, watch_clock_t::time_point>::iterator next = pending.begin();
+				for(std::map<std::string, watch_clock_t::time_point>::iterator iter = pending.begin(); iter != pending.end(); iter++)
+				{
+					if(iter->second < next->second) next = iter;
+				}
+				if(next->second <= watch_clock_t::now())
+				{
+					fileName = next->first;
+					pending.erase(next);
+					break;
+				}
+				wakeup.wait_until(lock, next->second);
+			}
+		}
+
+		if(fileName.empty())
+		{
+			break; /*the notifier has stopped*/
+		}
+
+		//Sidecars, temporary files and the results of our own writes are not tagged
+		watch_stamp_t stamp;
+		if(ends_with(fileName, SIDECAR_SUFFIX) || ends_with(fileName, ".tmp") || (!get_stamp(fileName, stamp)))
+		{
+			continue;
+		}
+		std::map<std::string, watch_stamp_t>::const_iterator done = tagged.find(fileName);
+		if((done != tagged.end()) && (done->second.size == stamp.size) && (done->second.mtime == stamp.mtime))
+		{
+			continue;
+		}
+
+		//A file that stays locked without any further change is given up, until it changes again
+		if(!is_writer_done(fileName))
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if(++busy[fileName] > MAX_BUSY_RETRIES)
+			{
+				LOG_SUMMARY("Warning: File is still in use, giving up until it changes again:\n%s\n\n", fileName.c_str());
+				busy.erase(fileName);
+				continue;
+			}
+			pending.insert(std::make_pair(fileName, watch_clock_t::now() + debounce));
+			continue;
+		}
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			busy.erase(fileName);
+		}
+
+		//Rules apply in file order, the sidecar takes precedence over all rules
+		TagJob job(fileName.c_str());
+		const char *const baseName = fileName.c_str() + prefix.length();
+		bool success = true;
+		for(std::vector<watch_rule_t>::const_iterator iter = rules.cbegin(); iter != rules.cend(); iter++)
+		{
+			if(match_pattern(iter->pattern.c_str(), baseName))
+			{
+				success = success && apply_specs(job, iter->specs, options.normalize);
+			}
+		}
+
+		std::vector<std::string> sidecar;
+		if(read_sidecar(fileName, sidecar))
+		{
+			success = success && apply_specs(job, sidecar, options.normalize);
+		}
+
+		if(items.empty() && job.getItems().empty() && (!options.checksum))
+		{
+			continue; /*no rule or sidecar applies to this file, and there is no checksum to store*/
+		}
+
+		LOG_CHUNK(fileName.c_str());
+		LOG_SUMMARY("Writing tags to media file:\n%s\n\n", fileName.c_str());
+		success = success && job.stat() && job.readTail() && ((!options.checksum) || job.checksum(1)) && job.serialize(options.formats, items) && job.write(options.formats, options.sink, items) && ((!options.verify) || (job.sync() && job.verify(items)));
+		Log::write(success ? LOG_LEVEL_SUMMARY : LOG_LEVEL_QUIET, success ? "Tags have been written successfully.\n\n" : "An error occurred while trying to write tags!\n\n");
+
+		if(get_stamp(fileName, stamp))
+		{
+			tagged[fileName] = stamp;
+		}
+	}
+
+	//Only reached once change notifications have failed, the notifier has already finished
+	notifier.join();
+	CloseHandle(dirHandle);
+	return false;
+}
@@ -0,0 +1,42 @@
+///////////////////////////////////////////////////////////////////////////////
+// Simple Tag Creator
+// Copyright (C) 2004-2013 LoRd_MuldeR <MuldeR2@GMX.de>
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version, but always including the *additional*
+// restrictions defined in the "License.txt" file.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// http://www.gnu.org/licenses/gpl-2.0.txt
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TAG_WATCH_H_INCLUDED
+#define TAG_WATCH_H_INCLUDED
+
+#include <vector>
+
+class TagItem;
+class TagOptions;
+
+// Watches a drop folder and tags every file that arrives there, until the
+// process is terminated. Change notifications are delivered by the system,
+// so the folder is never rescanned. A file is processed once it has been
+// quiet for the debounce interval and its writer has closed it. Returns
+// false if change notifications stop working.
+class Watcher
+{
+public:
+	static bool run(const char *directory, const std::vector<TagItem*> &items, const TagOptions &options);
+};
+
+#endif //TAG_WATCH_H_INCLUDED